@@ -0,0 +1,33 @@
+file(GLOB bench-srcs benchmarks/host/*.c benchmarks/host/*.cpp benchmarks/host/*.h)
+
+add_custom_target(make_benchmarks)
+
+find_package(Threads REQUIRED)
+
+# Each variant builds its own copy of the library so that different
+# implementations of the same function can be timed on one machine. TEST
+# skips fix16_options.h so that only the listed options apply.
+function(create_benchmark name)
+    add_library(fixmath_bench_${name} STATIC ${libfixmath-srcs})
+    target_compile_definitions(fixmath_bench_${name} PRIVATE TEST ${ARGN})
+    add_executable(bench_${name} ${bench-srcs})
+    target_link_libraries(bench_${name} PRIVATE fixmath_bench_${name} m
+                          Threads::Threads)
+    target_include_directories(bench_${name} PRIVATE ${CMAKE_SOURCE_DIR})
+    target_compile_definitions(bench_${name} PRIVATE PREFIX=${name} TEST ${ARGN})
+    add_dependencies(make_benchmarks bench_${name})
+endfunction()
+
+create_benchmark(harddiv)
+create_benchmark(softdiv FIXMATH_NO_HARD_DIVISION)
+create_benchmark(fastdiv FIXMATH_FAST_DIV FIXMATH_NO_HARD_DIVISION)
+create_benchmark(inline FIXMATH_INLINE)
+create_benchmark(stickyinline FIXMATH_INLINE FIXMATH_STICKY_OVERFLOW)
+create_benchmark(nocache FIXMATH_NO_CACHE)
+create_benchmark(sinlut FIXMATH_SIN_LUT)
+create_benchmark(sinlut8 FIXMATH_SIN_LUT_BITS=8)
+create_benchmark(sinlut10 FIXMATH_SIN_LUT_BITS=10)
+create_benchmark(threadcache FIXMATH_THREAD_CACHE)
+create_benchmark(cachestats FIXMATH_CACHE_STATS)
+create_benchmark(cachestats8 FIXMATH_CACHE_STATS FIXMATH_CACHE_BITS=8)
+create_benchmark(cachestats16 FIXMATH_CACHE_STATS FIXMATH_CACHE_BITS=16)
@@ -0,0 +1,118 @@
+#include "bench.h"
+#include "bench_angle.h"
+#include "bench_cache.h"
+#include "bench_cordic.h"
+#include "bench_core.h"
+#include "bench_div.h"
+#include "bench_dot.h"
+#include "bench_exp.h"
+#include "bench_expr.h"
+#include "bench_fix32.h"
+#include "bench_pack.h"
+#include "bench_reduce.h"
+#include "bench_saturate.h"
+#include "bench_sqrt.h"
+#include "bench_threads.h"
+#include "bench_trig.h"
+#include <string.h>
+#include <time.h>
+
+fix16_t         bench_a[BENCH_SIZE];
+fix16_t         bench_b[BENCH_SIZE];
+fix16_t         bench_out[BENCH_SIZE];
+
+static uint32_t bench_seed = 12345U;
+
+uint64_t        bench_now(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+#else
+    return ((uint64_t)clock() * (1000000000U / CLOCKS_PER_SEC));
+#endif
+}
+
+fix16_t bench_rand(fix16_t lo, fix16_t hi)
+{
+    bench_seed     = (bench_seed * 1103515245U) + 12345U;
+    uint32_t value = (bench_seed >> 16) | (bench_seed << 16);
+    uint32_t range = (uint32_t)hi - (uint32_t)lo + 1U;
+    if (range != 0U)
+        value %= range;
+    return ((fix16_t)((uint32_t)lo + value));
+}
+
+void bench_fill(fix16_t* buf, fix16_t lo, fix16_t hi, int nonzero)
+{
+    for (unsigned i = 0; i < BENCH_SIZE; ++i)
+    {
+        do
+        {
+            buf[i] = bench_rand(lo, hi);
+        } while (nonzero && (buf[i] == 0));
+    }
+}
+
+void bench_clobber(fix16_t* buf)
+{
+#ifdef __GNUC__
+    __asm__ volatile("" : : "r"(buf) : "memory");
+#else
+    static fix16_t* volatile sink;
+    sink = buf;
+#endif
+}
+
+void bench_report(const char* name, uint64_t ns, uint64_t ops)
+{
+    double per_op = (double)ns / (double)ops;
+    printf("  %-36s %8.3f ns/op %10.1f Mop/s\n", name, per_op,
+           (per_op > 0.0) ? (1000.0 / per_op) : 0.0);
+}
+
+/* Runs every benchmark, or only those named on the command line. */
+#define RUN(name)                                                              \
+    do                                                                         \
+    {                                                                          \
+        if (selected(argc, argv, #name))                                       \
+        {                                                                      \
+            printf("%s:\n", #name);                                            \
+            bench_##name();                                                    \
+        }                                                                      \
+    } while (0)
+
+static int selected(int argc, char** argv, const char* name)
+{
+    if (argc < 2)
+        return 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], name) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    printf("VARIANT: " STR2(PREFIX) ", simd: %s\n",
+           fix16_simd_name(fix16_simd_level()));
+    RUN(angle);
+    RUN(cache);
+    RUN(cordic);
+    RUN(core);
+    RUN(div);
+    RUN(dot);
+    RUN(exp);
+    RUN(expr);
+    RUN(fix32);
+    RUN(pack);
+    RUN(reduce);
+    RUN(saturate);
+    RUN(sqrt);
+    RUN(threads);
+    RUN(trig);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <libfixmath/fixmath.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Number of operands per pass and passes per measurement. Every kernel runs
+ * over the same BENCH_SIZE operands so that the data stays in L1.
+ */
+#define BENCH_SIZE   4096
+#define BENCH_PASSES 2000
+
+#define STR(x)       #x
+#define STR2(x)      STR(x)
+
+/* Runs the statement(s) BENCH_PASSES times and prints the time per operation,
+ * where one pass performs BENCH_SIZE operations. The statement has to store
+ * its results so that they are not optimized away.
+ */
+#define BENCH(name, ...)                                                       \
+    do                                                                         \
+    {                                                                          \
+        uint64_t bench_start = bench_now();                                    \
+        for (unsigned bench_pass = 0; bench_pass < BENCH_PASSES; ++bench_pass) \
+        {                                                                      \
+            __VA_ARGS__;                                                       \
+            bench_clobber(bench_out);                                          \
+        }                                                                      \
+        bench_report((name), bench_now() - bench_start,                        \
+                     (uint64_t)BENCH_PASSES * BENCH_SIZE);                     \
+    } while (0)
+
+/* Operand and result buffers shared by all benchmarks. */
+extern fix16_t  bench_a[BENCH_SIZE];
+extern fix16_t  bench_b[BENCH_SIZE];
+extern fix16_t  bench_out[BENCH_SIZE];
+
+/* Monotonic time in nanoseconds. */
+extern uint64_t bench_now(void);
+
+/* Deterministic pseudo-random fix16_t in [lo, hi]. */
+extern fix16_t  bench_rand(fix16_t lo, fix16_t hi);
+
+/* Fills buf with bench_rand(lo, hi), never storing zero if nonzero is set. */
+extern void     bench_fill(fix16_t* buf, fix16_t lo, fix16_t hi, int nonzero);
+
+/* Keeps the compiler from discarding or hoisting the stores to buf. */
+extern void     bench_clobber(fix16_t* buf);
+
+/* Prints one result line: name, ns per operation and million ops per s. */
+extern void     bench_report(const char* name, uint64_t ns, uint64_t ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_H
@@ -0,0 +1,41 @@
+#include "bench_angle.h"
+#include "bench.h"
+
+/* An oscillator as a phase accumulator, in radians with a wrap at pi and
+ * with binary angles, and the binary angle functions against their radian
+ * counterparts.
+ */
+void bench_angle(void)
+{
+    bench_fill(bench_a, -fix16_from_int(100), fix16_from_int(100), 0);
+    bench_fill(bench_b, -fix16_from_int(100), fix16_from_int(100), 0);
+
+    fix16_t       phase  = 0;
+    fix16_t       step   = fix16_from_dbl(0.0123);
+    fix16_angle_t aphase = 0;
+    fix16_angle_t astep  = fix16_angle_from_rad(step);
+
+    BENCH("fix16_sin oscillator", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        phase += step;
+        if (phase > fix16_pi)
+            phase -= (fix16_pi << 1);
+        bench_out[i] = fix16_sin(phase);
+    });
+    BENCH("fix16_angle_sin oscillator",
+          for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+              aphase += astep;
+              bench_out[i] = fix16_angle_sin(aphase);
+          });
+    BENCH("fix16_angle_from_rad", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = (fix16_t)fix16_angle_from_rad(bench_a[i]);
+    });
+    BENCH("fix16_angle_sin", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_angle_sin((fix16_angle_t)bench_a[i]);
+    });
+    BENCH("fix16_atan2", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_atan2(bench_b[i], bench_a[i]);
+    });
+    BENCH("fix16_angle_atan2", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = (fix16_t)fix16_angle_atan2(bench_b[i], bench_a[i]);
+    });
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_ANGLE_H
+#define BENCH_ANGLE_H
+
+void bench_angle(void);
+
+#endif // BENCH_ANGLE_H
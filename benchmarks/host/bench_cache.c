@@ -0,0 +1,156 @@
+#include "bench_cache.h"
+#include "bench.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Replays a trace of fix16_sin, fix16_cos, fix16_atan2 and fix16_exp calls
+ * and reports the time per call and, with FIXMATH_CACHE_STATS, the hit rate
+ * of each memo cache. The trace is read from the file named by the
+ * FIXMATH_CACHE_TRACE environment variable, one call per line:
+ *
+ *     sin <x>
+ *     cos <x>
+ *     atan2 <y> <x>
+ *     exp <x>
+ *
+ * where the arguments are raw fix16_t values in decimal or 0x hex. Without
+ * it a built-in trace is used: a phase accumulator through sin and cos, 64
+ * directions through atan2 and 1024 distinct values through exp.
+ */
+typedef enum
+{
+    bench_cache_sin,
+    bench_cache_cos,
+    bench_cache_atan2,
+    bench_cache_exp,
+} bench_cache_e;
+
+typedef struct
+{
+    bench_cache_e func;
+    fix16_t       a;
+    fix16_t       b;
+} bench_cache_call_t;
+
+static const char* const bench_cache_names[] = {"sin", "cos", "atan2", "exp"};
+
+static bench_cache_call_t* bench_cache_trace;
+static size_t              bench_cache_count;
+static size_t              bench_cache_size;
+
+static void bench_cache_add(bench_cache_e func, fix16_t a, fix16_t b)
+{
+    if (bench_cache_count == bench_cache_size)
+    {
+        bench_cache_size =
+            (bench_cache_size != 0) ? (bench_cache_size * 2) : 4096;
+        bench_cache_trace = (bench_cache_call_t*)realloc(
+            bench_cache_trace, bench_cache_size * sizeof(bench_cache_call_t));
+        if (bench_cache_trace == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    bench_cache_trace[bench_cache_count].func = func;
+    bench_cache_trace[bench_cache_count].a    = a;
+    bench_cache_trace[bench_cache_count].b    = b;
+    bench_cache_count++;
+}
+
+static int bench_cache_read(const char* path)
+{
+    FILE* file = fopen(path, "r");
+    char  line[128];
+    if (file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 0;
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[16];
+        long a = 0;
+        long b = 0;
+        int  n = sscanf(line, "%15s %li %li", name, &a, &b);
+        for (unsigned f = 0; (n >= 2) && (f < 4); ++f)
+        {
+            if (strcmp(name, bench_cache_names[f]) == 0)
+                bench_cache_add((bench_cache_e)f, (fix16_t)a, (fix16_t)b);
+        }
+    }
+    fclose(file);
+    return 1;
+}
+
+static void bench_cache_synthesize(void)
+{
+    fix16_t phase = 0;
+    for (unsigned i = 0; i < 16384; ++i)
+    {
+        bench_cache_add(bench_cache_sin, phase, 0);
+        bench_cache_add(bench_cache_cos, phase, 0);
+        phase += F16(0.01);
+    }
+    for (unsigned i = 0; i < 16384; ++i)
+    {
+        fix16_t angle = (fix16_t)(i % 64U) * (fix16_pi / 32);
+        bench_cache_add(bench_cache_atan2, fix16_sin(angle), fix16_cos(angle));
+    }
+    for (unsigned i = 0; i < 1024; ++i)
+        bench_a[i] = bench_rand(-fix16_from_int(10), fix16_from_int(10));
+    for (unsigned i = 0; i < 16384; ++i)
+        bench_cache_add(bench_cache_exp, bench_a[bench_rand(0, 1023)], 0);
+}
+
+void bench_cache(void)
+{
+    const char* path = getenv("FIXMATH_CACHE_TRACE");
+    bench_cache_count = 0;
+    if ((path == NULL) || !bench_cache_read(path))
+        bench_cache_synthesize();
+
+#ifdef FIXMATH_CACHE_STATS
+    fix16_cache_stats_clear();
+#endif
+    uint64_t start = bench_now();
+    fix16_t  sink  = 0;
+    for (size_t i = 0; i < bench_cache_count; ++i)
+    {
+        const bench_cache_call_t* call = &bench_cache_trace[i];
+        switch (call->func)
+        {
+        case bench_cache_sin:
+            sink ^= fix16_sin(call->a);
+            break;
+        case bench_cache_cos:
+            sink ^= fix16_cos(call->a);
+            break;
+        case bench_cache_atan2:
+            sink ^= fix16_atan2(call->a, call->b);
+            break;
+        case bench_cache_exp:
+        default:
+            sink ^= fix16_exp(call->a);
+            break;
+        }
+    }
+    bench_out[0] = sink;
+    bench_clobber(bench_out);
+    bench_report("replay", bench_now() - start, bench_cache_count);
+
+#ifdef FIXMATH_CACHE_STATS
+    static const char* const names[] = {"sin cache", "atan2 cache",
+                                        "exp cache"};
+    for (unsigned c = 0; c < fix16_cache_count; ++c)
+    {
+        fix16_cache_stats_t stats = fix16_cache_stats((fix16_cache_e)c);
+        uint32_t            calls = stats.hits + stats.misses;
+        printf("  %-36s %8u hits %8u misses %8u evictions %5.1f%%\n",
+               names[c], stats.hits, stats.misses, stats.evictions,
+               (calls != 0) ? (100.0 * stats.hits / calls) : 0.0);
+    }
+#else
+    printf("  (build with FIXMATH_CACHE_STATS for the hit rates)\n");
+#endif
+}
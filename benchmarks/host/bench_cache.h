@@ -0,0 +1,6 @@
+#ifndef BENCH_CACHE_H
+#define BENCH_CACHE_H
+
+void bench_cache(void);
+
+#endif // BENCH_CACHE_H
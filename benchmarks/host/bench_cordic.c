@@ -0,0 +1,52 @@
+#include "bench_cordic.h"
+#include "bench.h"
+
+/* The CORDIC functions at a few iteration counts against fix16_sincos and
+ * against fix16_atan2 plus the length from fix16_sqrt. bench_softdiv shows
+ * them on a target without hardware division.
+ */
+void bench_cordic(void)
+{
+    static const unsigned iterations[] = {12, 16, 20, 24};
+    static fix16_t        hypot[BENCH_SIZE];
+    char                  name[48];
+
+    bench_fill(bench_a, -fix16_from_int(100), fix16_from_int(100), 0);
+    bench_fill(bench_b, -fix16_from_int(100), fix16_from_int(100), 0);
+
+    BENCH("fix16_sincos", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        fix16_t c;
+        fix16_sincos(bench_a[i], &bench_out[i], &c);
+        bench_out[i] += c;
+    });
+    for (unsigned k = 0; k < sizeof(iterations) / sizeof(iterations[0]); ++k)
+    {
+        unsigned n = iterations[k];
+        snprintf(name, sizeof(name), "fix16_cordic_sincos, %u", n);
+        BENCH(name, for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+            fix16_t c;
+            fix16_cordic_sincos(bench_a[i], &bench_out[i], &c, n);
+            bench_out[i] += c;
+        });
+    }
+
+    BENCH("fix16_atan2 + sqrt", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        fix16_t x = bench_a[i] >> 8;
+        fix16_t y = bench_b[i] >> 8;
+        bench_out[i] =
+            fix16_atan2(y, x) +
+            fix16_sqrt(fix16_add(fix16_mul(x, x), fix16_mul(y, y)));
+    });
+    for (unsigned k = 0; k < sizeof(iterations) / sizeof(iterations[0]); ++k)
+    {
+        unsigned n = iterations[k];
+        snprintf(name, sizeof(name), "fix16_cordic_atan2, %u", n);
+        BENCH(name, for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+            bench_out[i] = fix16_cordic_atan2(bench_b[i] >> 8,
+                                              bench_a[i] >> 8, &hypot[i], n);
+        });
+    }
+    BENCH("fix16_cordic_atan2_array, 24",
+          fix16_cordic_atan2_array(bench_out, hypot, bench_b, bench_a,
+                                   BENCH_SIZE, fix16_cordic_iterations));
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_CORDIC_H
+#define BENCH_CORDIC_H
+
+void bench_cordic(void);
+
+#endif // BENCH_CORDIC_H
@@ -0,0 +1,40 @@
+#include "bench_core.h"
+#include "bench.h"
+
+/* Tight loops over the core operations. Compare bench_inline, which is built
+ * with FIXMATH_INLINE, against bench_harddiv to see the cost of the calls, and
+ * bench_stickyinline against bench_inline for FIXMATH_STICKY_OVERFLOW.
+ */
+void bench_core(void)
+{
+    bench_fill(bench_a, -fix16_from_int(100), fix16_from_int(100), 0);
+    bench_fill(bench_b, -fix16_from_int(100), fix16_from_int(100), 1);
+
+    BENCH("fix16_add", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_add(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_sub", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sub(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_sadd", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sadd(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_mul", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_mul(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_smul", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_smul(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_div", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_div(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_mul by constant", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_mul(bench_a[i], fix16_pi);
+    });
+    BENCH("fix16_add(fix16_mul) chain", {
+        fix16_t sum = 0;
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            sum = fix16_add(sum, fix16_mul(bench_a[i], bench_b[i]));
+        bench_out[0] = sum;
+    });
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_CORE_H
+#define BENCH_CORE_H
+
+void bench_core(void);
+
+#endif // BENCH_CORE_H
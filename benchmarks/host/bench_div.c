@@ -0,0 +1,35 @@
+#include "bench_div.h"
+#include "bench.h"
+
+/* fix16_div as built in this variant (hardware, software or FIXMATH_FAST_DIV)
+ * against the reciprocal and the precomputed divisor.
+ */
+void bench_div(void)
+{
+    bench_fill(bench_a, -fix16_from_int(1000), fix16_from_int(1000), 0);
+    bench_fill(bench_b, -fix16_from_int(100), fix16_from_int(100), 1);
+
+    BENCH("fix16_div", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_div(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_div(fix16_one, b)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_div(fix16_one, bench_b[i]);
+    });
+    BENCH("fix16_recip", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_recip(bench_b[i]);
+    });
+    BENCH("fix16_div_array", fix16_div_array(bench_out, bench_a, bench_b,
+                                             BENCH_SIZE));
+
+    fix16_divisor_t d = fix16_divisor_create(bench_b[0]);
+    BENCH("fix16_div, invariant divisor",
+          for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+              bench_out[i] = fix16_div(bench_a[i], bench_b[0]);
+          });
+    BENCH("fix16_div_by", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_div_by(bench_a[i], &d);
+    });
+    BENCH("fix16_divisor_create", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = (fix16_t)fix16_divisor_create(bench_b[i]).inverse;
+    });
+}
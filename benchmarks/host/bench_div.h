@@ -0,0 +1,6 @@
+#ifndef BENCH_DIV_H
+#define BENCH_DIV_H
+
+void bench_div(void);
+
+#endif // BENCH_DIV_H
@@ -0,0 +1,42 @@
+#include "bench_dot.h"
+#include "bench.h"
+
+/* A sum of fix16_mul products against fix16_dot, per multiply-add, for one
+ * long vector and for the 4-element rows of a matrix-vector product.
+ */
+void bench_dot(void)
+{
+    bench_fill(bench_a, -fix16_from_int(8), fix16_from_int(8), 0);
+    bench_fill(bench_b, -fix16_from_int(8), fix16_from_int(8), 0);
+
+    BENCH("fix16_mul sum", {
+        fix16_t sum = 0;
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            sum += fix16_mul(bench_a[i], bench_b[i]);
+        bench_out[0] = sum;
+    });
+    BENCH("fix16_fma sum", {
+        fix16_t sum = 0;
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            sum = fix16_fma(bench_a[i], bench_b[i], sum);
+        bench_out[0] = sum;
+    });
+    BENCH("fix16_dot",
+          bench_out[0] = fix16_dot(bench_a, bench_b, BENCH_SIZE));
+
+    BENCH("fix16_mul sum, 4 terms", for (unsigned i = 0; i < BENCH_SIZE;
+                                         i += 4) {
+        bench_out[i >> 2] = fix16_mul(bench_a[i], bench_b[i]) +
+                            fix16_mul(bench_a[i + 1], bench_b[i + 1]) +
+                            fix16_mul(bench_a[i + 2], bench_b[i + 2]) +
+                            fix16_mul(bench_a[i + 3], bench_b[i + 3]);
+    });
+    BENCH("fix16_dot, 4 terms", for (unsigned i = 0; i < BENCH_SIZE; i += 4) {
+        bench_out[i >> 2] = fix16_dot(&bench_a[i], &bench_b[i], 4);
+    });
+    BENCH("fix16_dot_strided, 4 terms",
+          for (unsigned i = 0; i < BENCH_SIZE; i += 4) {
+              bench_out[i >> 2] = fix16_dot_strided(&bench_a[i], 1,
+                                                    &bench_b[i], 1, 4);
+          });
+}
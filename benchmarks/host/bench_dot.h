@@ -0,0 +1,6 @@
+#ifndef BENCH_DOT_H
+#define BENCH_DOT_H
+
+void bench_dot(void);
+
+#endif // BENCH_DOT_H
@@ -0,0 +1,184 @@
+#include "bench_exp.h"
+#include "bench.h"
+#include <math.h>
+
+/* Prints the largest difference of fn from libm over the operands in LSB. */
+static void bench_exp_error(const char* name, fix16_t (*fn)(fix16_t),
+                            double (*ref)(double))
+{
+    double max = 0.0;
+    for (unsigned i = 0; i < BENCH_SIZE; ++i)
+    {
+        double r = ref(fix16_to_dbl(bench_a[i])) * fix16_one;
+        double e = fabs(fn(bench_a[i]) - r);
+        if (e > max)
+            max = e;
+    }
+    printf("  %-36s %8.2f LSB max\n", name, max);
+}
+
+/* fix16_log before the table-driven version, Newton's method on fix16_exp,
+ * for comparison.
+ */
+static fix16_t bench_log_newton(fix16_t inValue)
+{
+    fix16_t guess = F16(2);
+    fix16_t delta;
+    int     scaling = 0;
+    int     count   = 0;
+
+    if (inValue <= 0)
+        return (fix16_minimum);
+
+    const fix16_t e_to_fourth = 3578144;
+    while (inValue > F16(100))
+    {
+        inValue = fix16_div(inValue, e_to_fourth);
+        scaling += 4;
+    }
+    while (inValue < fix16_one)
+    {
+        inValue = fix16_mul(inValue, e_to_fourth);
+        scaling -= 4;
+    }
+
+    do
+    {
+        fix16_t e = fix16_exp(guess);
+        delta     = fix16_div(inValue - e, e);
+        if (delta > F16(3))
+            delta = F16(3);
+        guess += delta;
+    } while ((count++ < 10) && ((delta > 1) || (delta < -1)));
+
+    return guess + fix16_from_int(scaling);
+}
+
+/* fix16_log2 before the table-driven version, one squaring per result bit,
+ * for comparison.
+ */
+static fix16_t bench_log2_inner(fix16_t x)
+{
+    fix16_t result = 0;
+    while (x >= F16(2))
+    {
+        result++;
+        x = (x >> 1) + (x & 1);
+    }
+    if (x == 0)
+        return (result << 16);
+
+    for (int i = 16; i > 0; i--)
+    {
+        x = fix16_mul(x, x);
+        result <<= 1;
+        if (x >= F16(2))
+        {
+            result |= 1;
+            x = (x >> 1) + (x & 1);
+        }
+    }
+    x = fix16_mul(x, x);
+    if (x >= F16(2))
+        result++;
+    return (result);
+}
+
+static fix16_t bench_log2_squaring(fix16_t x)
+{
+    if (x <= 0)
+        return (fix16_overflow);
+    if (x < fix16_one)
+    {
+        if (x == 1)
+            return fix16_from_int(-16);
+        return -bench_log2_inner(fix16_recip(x));
+    }
+    return (bench_log2_inner(x));
+}
+
+/* Gamma correction with the exponent 1/2.2, by fix16_pow and by the chain
+ * of fix16_exp and fix16_log it replaces.
+ */
+static const fix16_t bench_gamma = F16(1 / 2.2);
+
+static fix16_t bench_gamma_pow(fix16_t x)
+{
+    return (fix16_pow(x, bench_gamma));
+}
+
+static fix16_t bench_gamma_chain(fix16_t x)
+{
+    return (fix16_exp(fix16_mul(bench_gamma, fix16_log(x))));
+}
+
+static double bench_gamma_ref(double x)
+{
+    return (pow(x, fix16_to_dbl(bench_gamma)));
+}
+
+/* Unless the variant has FIXMATH_NO_CACHE, the passes after the first find
+ * most results of fix16_exp in the memo cache.
+ */
+void bench_exp(void)
+{
+    bench_fill(bench_a, -fix16_from_int(11), fix16_from_int(10), 0);
+    bench_exp_error("fix16_exp error", fix16_exp, exp);
+
+    BENCH("fix16_exp", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_exp(bench_a[i]);
+    });
+    BENCH("fix16_exp_array", fix16_exp_array(bench_out, bench_a, BENCH_SIZE));
+
+    /* The logarithms over the whole positive range, with the versions they
+     * replaced.
+     */
+    bench_fill(bench_a, 1, fix16_maximum, 0);
+    bench_exp_error("fix16_log error", fix16_log, log);
+    bench_exp_error("fix16_log (Newton) error", bench_log_newton, log);
+    bench_exp_error("fix16_log2 error", fix16_log2, log2);
+    bench_exp_error("fix16_log2 (squaring) error", bench_log2_squaring, log2);
+    bench_exp_error("fix16_log10 error", fix16_log10, log10);
+
+    BENCH("fix16_log", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_log(bench_a[i]);
+    });
+    BENCH("fix16_log (Newton)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = bench_log_newton(bench_a[i]);
+    });
+    BENCH("fix16_log2", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_log2(bench_a[i]);
+    });
+    BENCH("fix16_log2 (squaring)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = bench_log2_squaring(bench_a[i]);
+    });
+    BENCH("fix16_log10", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_log10(bench_a[i]);
+    });
+    BENCH("fix16_log_array", fix16_log_array(bench_out, bench_a, BENCH_SIZE));
+
+    bench_fill(bench_a, -fix16_from_int(16), fix16_from_int(14), 0);
+    bench_exp_error("fix16_exp2 error", fix16_exp2, exp2);
+    BENCH("fix16_exp2", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_exp2(bench_a[i]);
+    });
+
+    /* Gamma correction of values in (0, 1]. */
+    bench_fill(bench_a, 1, fix16_one, 0);
+    bench_exp_error("fix16_pow gamma error", bench_gamma_pow, bench_gamma_ref);
+    bench_exp_error("fix16_exp(y * log) gamma error", bench_gamma_chain,
+                    bench_gamma_ref);
+    BENCH("fix16_pow", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_pow(bench_a[i], bench_gamma);
+    });
+    BENCH("fix16_exp(y * log)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = bench_gamma_chain(bench_a[i]);
+    });
+    BENCH("fix16_pow_array",
+          fix16_pow_array(bench_out, bench_a, bench_gamma, BENCH_SIZE));
+
+    bench_fill(bench_a, fix16_one / 2, fix16_from_int(4), 0);
+    BENCH("fix16_powi(x, 7)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_powi(bench_a[i], 7);
+    });
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_EXP_H
+#define BENCH_EXP_H
+
+void bench_exp(void);
+
+#endif // BENCH_EXP_H
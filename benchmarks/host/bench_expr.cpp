@@ -0,0 +1,35 @@
+#include "bench_expr.h"
+#include "bench.h"
+
+using fixmath::expr::lazy;
+
+/* Fix16 operators against fixmath::expr for a 2x2 determinant, a d - b c,
+ * and a lerp, a + t (b - a).
+ */
+void bench_expr(void)
+{
+    bench_fill(bench_a, -fix16_from_int(100), fix16_from_int(100), 0);
+    bench_fill(bench_b, -fix16_from_int(100), fix16_from_int(100), 0);
+
+    BENCH("Fix16 a * d - b * c", for (unsigned i = 0; i < BENCH_SIZE;
+                                      i += 2) {
+        Fix16 a = bench_a[i], b = bench_a[i + 1];
+        Fix16 c = bench_b[i], d = bench_b[i + 1];
+        bench_out[i >> 1] = (a * d - b * c).value;
+    });
+    BENCH("expr a * d - b * c", for (unsigned i = 0; i < BENCH_SIZE; i += 2) {
+        Fix16 a = bench_a[i], b = bench_a[i + 1];
+        Fix16 c = bench_b[i], d = bench_b[i + 1];
+        bench_out[i >> 1] = Fix16(lazy(a) * d - lazy(b) * c).value;
+    });
+    BENCH("Fix16 a + t * (b - a)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        Fix16 a = bench_a[i], b = bench_b[i];
+        Fix16 t = (fix16_t)(bench_b[i] & 0xFFFF);
+        bench_out[i] = (a + t * (b - a)).value;
+    });
+    BENCH("expr a + t * (b - a)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        Fix16 a = bench_a[i], b = bench_b[i];
+        Fix16 t = (fix16_t)(bench_b[i] & 0xFFFF);
+        bench_out[i] = Fix16(a + t * (lazy(b) - a)).value;
+    });
+}
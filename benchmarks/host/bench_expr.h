@@ -0,0 +1,15 @@
+#ifndef BENCH_EXPR_H
+#define BENCH_EXPR_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    void bench_expr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_EXPR_H
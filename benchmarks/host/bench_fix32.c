@@ -0,0 +1,60 @@
+#include "bench_fix32.h"
+#include "bench.h"
+
+static fix32_t bench_fix32_a[BENCH_SIZE];
+static fix32_t bench_fix32_b[BENCH_SIZE];
+static fix32_t bench_fix32_out[BENCH_SIZE];
+
+/* The Q32.32 operations next to their fix16_t counterparts. The operands
+ * are the fix16_t ones with random low fraction bits, so that they use the
+ * whole 64 bit word.
+ */
+void bench_fix32(void)
+{
+    bench_fill(bench_a, -fix16_from_int(1000), fix16_from_int(1000), 0);
+    bench_fill(bench_b, fix16_one / 64, fix16_from_int(100), 1);
+    for (unsigned i = 0; i < BENCH_SIZE; ++i)
+    {
+        uint32_t lo      = (uint32_t)bench_rand(0, 0xFFFF);
+        bench_fix32_a[i] = int64_add(fix32_from_fix16(bench_a[i]),
+                                     int64_const(0, lo));
+        bench_fix32_b[i] = int64_add(fix32_from_fix16(bench_b[i]),
+                                     int64_const(0, lo));
+    }
+
+    BENCH("fix16_mul", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_mul(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix32_mul", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_fix32_out[i] = fix32_mul(bench_fix32_a[i], bench_fix32_b[i]);
+    });
+    BENCH("fix32_add_array", fix32_add_array(bench_fix32_out, bench_fix32_a,
+                                             bench_fix32_b, BENCH_SIZE));
+    BENCH("fix32_mul_array", fix32_mul_array(bench_fix32_out, bench_fix32_a,
+                                             bench_fix32_b, BENCH_SIZE));
+    BENCH("fix16_div", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_div(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix32_div", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_fix32_out[i] = fix32_div(bench_fix32_a[i], bench_fix32_b[i]);
+    });
+    BENCH("fix16_sqrt", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sqrt(bench_b[i]);
+    });
+    BENCH("fix32_sqrt", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_fix32_out[i] = fix32_sqrt(bench_fix32_b[i]);
+    });
+    BENCH("fix16_sin", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sin(bench_b[i]);
+    });
+    BENCH("fix32_sin", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_fix32_out[i] = fix32_sin(bench_fix32_b[i]);
+    });
+    BENCH("fix32_exp", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        fix32_t x          = int64_div_i64_i32(bench_fix32_a[i], 64);
+        bench_fix32_out[i] = fix32_exp(x);
+    });
+    BENCH("fix32_log", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_fix32_out[i] = fix32_log(bench_fix32_b[i]);
+    });
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_FIX32_H
+#define BENCH_FIX32_H
+
+void bench_fix32(void);
+
+#endif // BENCH_FIX32_H
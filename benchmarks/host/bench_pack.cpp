@@ -0,0 +1,41 @@
+#include "bench_pack.h"
+#include "bench.h"
+
+/* Fix16 against Fix16x4 and Fix16x8 for a * b + a, and for the product
+ * clamped to [-1, 1].
+ */
+void bench_pack(void)
+{
+    bench_fill(bench_a, -fix16_from_int(100), fix16_from_int(100), 0);
+    bench_fill(bench_b, -fix16_from_int(100), fix16_from_int(100), 0);
+
+    BENCH("Fix16 a * b + a", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        Fix16 a      = bench_a[i];
+        bench_out[i] = (a * Fix16(bench_b[i]) + a).value;
+    });
+    BENCH("Fix16x4 a * b + a", for (unsigned i = 0; i < BENCH_SIZE; i += 4) {
+        Fix16x4 a = Fix16x4::load(bench_a + i);
+        (a * Fix16x4::load(bench_b + i) + a).store(bench_out + i);
+    });
+    BENCH("Fix16x8 a * b + a", for (unsigned i = 0; i < BENCH_SIZE; i += 8) {
+        Fix16x8 a = Fix16x8::load(bench_a + i);
+        (a * Fix16x8::load(bench_b + i) + a).store(bench_out + i);
+    });
+
+    BENCH("Fix16 clamp(a * b)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_clamp(fix16_mul(bench_a[i], bench_b[i]),
+                                   -fix16_one, fix16_one);
+    });
+    BENCH("Fix16x4 clamp(a * b)", for (unsigned i = 0; i < BENCH_SIZE;
+                                       i += 4) {
+        Fix16x4 p = Fix16x4::load(bench_a + i) * Fix16x4::load(bench_b + i);
+        fixmath::clamp(p, Fix16x4(Fix16(-1.0)), Fix16x4(Fix16(1.0)))
+            .store(bench_out + i);
+    });
+    BENCH("Fix16x8 clamp(a * b)", for (unsigned i = 0; i < BENCH_SIZE;
+                                       i += 8) {
+        Fix16x8 p = Fix16x8::load(bench_a + i) * Fix16x8::load(bench_b + i);
+        fixmath::clamp(p, Fix16x8(Fix16(-1.0)), Fix16x8(Fix16(1.0)))
+            .store(bench_out + i);
+    });
+}
@@ -0,0 +1,15 @@
+#ifndef BENCH_PACK_H
+#define BENCH_PACK_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    void bench_pack(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_PACK_H
@@ -0,0 +1,37 @@
+#include "bench_reduce.h"
+#include "bench.h"
+
+/* The array reductions against the scalar loops they replace. */
+void bench_reduce(void)
+{
+    bench_fill(bench_a, fix16_minimum, fix16_maximum, 0);
+
+    BENCH("double sum", {
+        double sum = 0.0;
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            sum += fix16_to_dbl(bench_a[i]);
+        bench_out[0] = fix16_from_dbl(sum / BENCH_SIZE);
+    });
+    BENCH("fix16_acc_add loop", {
+        fix16_acc_t acc = fix16_acc_zero();
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            acc = fix16_acc_add(acc, bench_a[i]);
+        bench_out[0] = fix16_acc_to_fix16(acc);
+    });
+    BENCH("fix16_sum_array",
+          bench_out[0] = fix16_acc_to_fix16(
+              fix16_sum_array(bench_a, BENCH_SIZE)));
+    BENCH("fix16_acc_mac loop", {
+        fix16_acc_t acc = fix16_acc_zero();
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            acc = fix16_acc_mac(acc, bench_a[i], bench_a[i]);
+        bench_out[0] = fix16_acc_to_fix16(acc);
+    });
+    BENCH("fix16_sumsq_array",
+          bench_out[0] = fix16_acc_to_fix16(
+              fix16_sumsq_array(bench_a, BENCH_SIZE)));
+    BENCH("fix16_min_array",
+          bench_out[0] = fix16_min_array(bench_a, BENCH_SIZE));
+    BENCH("fix16_argmax_array",
+          bench_out[0] = (fix16_t)fix16_argmax_array(bench_a, BENCH_SIZE));
+}
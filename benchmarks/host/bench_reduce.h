@@ -0,0 +1,6 @@
+#ifndef BENCH_REDUCE_H
+#define BENCH_REDUCE_H
+
+void bench_reduce(void);
+
+#endif // BENCH_REDUCE_H
@@ -0,0 +1,59 @@
+#include "bench_saturate.h"
+#include "bench.h"
+
+/* The saturating operations on random-sign operands where about a quarter of
+ * the sums and a third of the products overflow, so a branch on the result
+ * is mispredicted often. The wrappers replicate the former implementation,
+ * which branched on the fix16_overflow sentinel, for comparison. Build with
+ * FIXMATH_INLINE (bench_inline) to compare the operations and not the calls.
+ */
+static fix16_t bench_sadd_wrapper(fix16_t a, fix16_t b)
+{
+    fix16_t result = fix16_add(a, b);
+    if (result == fix16_overflow)
+        result = (a >= 0) ? fix16_maximum : fix16_minimum;
+    return (result);
+}
+
+static fix16_t bench_smul_wrapper(fix16_t a, fix16_t b)
+{
+    fix16_t result = fix16_mul(a, b);
+    if (result == fix16_overflow)
+        result = ((a >= 0) == (b >= 0)) ? fix16_maximum : fix16_minimum;
+    return (result);
+}
+
+void bench_saturate(void)
+{
+    bench_fill(bench_a, fix16_minimum, fix16_maximum, 0);
+    bench_fill(bench_b, fix16_minimum, fix16_maximum, 0);
+
+    BENCH("fix16_sadd", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sadd(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_sadd, sentinel wrapper",
+          for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+              bench_out[i] = bench_sadd_wrapper(bench_a[i], bench_b[i]);
+          });
+    BENCH("fix16_ssub", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_ssub(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_sadd_array",
+          fix16_sadd_array(bench_out, bench_a, bench_b, BENCH_SIZE));
+
+    bench_fill(bench_a, -fix16_from_int(362), fix16_from_int(362), 0);
+    bench_fill(bench_b, -fix16_from_int(362), fix16_from_int(362), 0);
+
+    BENCH("fix16_smul", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_smul(bench_a[i], bench_b[i]);
+    });
+    BENCH("fix16_smul, sentinel wrapper",
+          for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+              bench_out[i] = bench_smul_wrapper(bench_a[i], bench_b[i]);
+          });
+    BENCH("fix16_smul_array",
+          fix16_smul_array(bench_out, bench_a, bench_b, BENCH_SIZE));
+    BENCH("fix16_sdiv", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sdiv(bench_a[i], bench_b[i] | 1);
+    });
+}
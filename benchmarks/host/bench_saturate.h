@@ -0,0 +1,6 @@
+#ifndef BENCH_SATURATE_H
+#define BENCH_SATURATE_H
+
+void bench_saturate(void);
+
+#endif // BENCH_SATURATE_H
@@ -0,0 +1,110 @@
+#include "bench_sqrt.h"
+#include "bench.h"
+#include <libfixmath/fix16_array.h>
+
+/* fix16_sqrt before the version built on fix16_rsqrt, the bit-by-bit
+ * algorithm, for comparison.
+ */
+static fix16_t bench_sqrt_restoring(fix16_t inValue)
+{
+    uint32_t num    = fix_abs(inValue);
+    uint32_t result = 0;
+    uint32_t bit    = ((num & 0xFFF00000U) != 0U) ? (1U << 30) : (1U << 18);
+    while (bit > num)
+        bit >>= 2;
+    for (int n = 0; n < 2; n++)
+    {
+        while (bit != 0U)
+        {
+            if (num >= result + bit)
+            {
+                num -= result + bit;
+                result = (result >> 1) + bit;
+            }
+            else
+            {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        if (n == 0)
+        {
+            if (num > 65535U)
+            {
+                num    = ((num - result) << 16) - 0x8000U;
+                result = (result << 16) + 0x8000U;
+            }
+            else
+            {
+                num <<= 16;
+                result <<= 16;
+            }
+            bit = 1U << 14;
+        }
+    }
+#ifndef FIXMATH_NO_ROUNDING
+    if (num > result)
+        result++;
+#endif
+    return ((inValue < 0) ? -(fix16_t)result : (fix16_t)result);
+}
+
+/* Normalization as it was written before fix16_normalize3, a square root
+ * and three divisions.
+ */
+static fix16_t bench_normalize3_div(fix16_t* x, fix16_t* y, fix16_t* z)
+{
+    fix16_t length = fix16_sqrt(
+        fix16_add(fix16_add(fix16_mul(*x, *x), fix16_mul(*y, *y)),
+                  fix16_mul(*z, *z)));
+    if (length != 0)
+    {
+        *x = fix16_div(*x, length);
+        *y = fix16_div(*y, length);
+        *z = fix16_div(*z, length);
+    }
+    return (length);
+}
+
+void bench_sqrt(void)
+{
+    bench_fill(bench_a, 1, fix16_maximum, 0);
+    BENCH("fix16_sqrt", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sqrt(bench_a[i]);
+    });
+    BENCH("fix16_sqrt (restoring)", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = bench_sqrt_restoring(bench_a[i]);
+    });
+    BENCH("fix16_sqrt_array", fix16_sqrt_array(bench_out, bench_a, BENCH_SIZE));
+    BENCH("fix16_rsqrt", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_rsqrt(bench_a[i]);
+    });
+    BENCH("fix16_div(1, fix16_sqrt)", for (unsigned i = 0; i < BENCH_SIZE;
+                                           ++i) {
+        bench_out[i] = fix16_div(fix16_one, fix16_sqrt(bench_a[i]));
+    });
+    BENCH("fix16_rsqrt_array",
+          fix16_rsqrt_array(bench_out, bench_a, BENCH_SIZE));
+
+    /* Direction vectors with components in [-100, 100], copied every pass
+     * since normalization is in place. The times are per component, a
+     * third of the time per vector.
+     */
+    static fix16_t src[BENCH_SIZE];
+    const unsigned n = BENCH_SIZE / 3;
+    bench_fill(src, -fix16_from_int(100), fix16_from_int(100), 1);
+    BENCH("fix16_normalize3", for (unsigned i = 0; i < n; ++i) {
+        fix16_t* v = &bench_out[3 * i];
+        v[0]       = src[3 * i];
+        v[1]       = src[3 * i + 1];
+        v[2]       = src[3 * i + 2];
+        fix16_normalize3(&v[0], &v[1], &v[2]);
+    });
+    BENCH("fix16_sqrt + 3 fix16_div", for (unsigned i = 0; i < n; ++i) {
+        fix16_t* v = &bench_out[3 * i];
+        v[0]       = src[3 * i];
+        v[1]       = src[3 * i + 1];
+        v[2]       = src[3 * i + 2];
+        bench_normalize3_div(&v[0], &v[1], &v[2]);
+    });
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_SQRT_H
+#define BENCH_SQRT_H
+
+void bench_sqrt(void);
+
+#endif // BENCH_SQRT_H
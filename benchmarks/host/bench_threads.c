@@ -0,0 +1,110 @@
+#include "bench_threads.h"
+#include "bench.h"
+#include <pthread.h>
+
+/* fix16_sin, fix16_atan2 and fix16_exp on 1 to 8 threads at once, each on its
+ * own operands from the same range, so that they compete for the same slots
+ * of the memo caches. Reports the total throughput, which should grow with
+ * the threads, and the number of results that differ from a single-threaded
+ * run. The shared caches of the default build can return the value of
+ * another thread's input, FIXMATH_THREAD_CACHE and FIXMATH_NO_CACHE cannot.
+ */
+#define BENCH_THREADS_MAX    8
+#define BENCH_THREADS_PASSES (BENCH_PASSES / 10)
+
+typedef enum
+{
+    bench_threads_sin,
+    bench_threads_atan2,
+    bench_threads_exp,
+} bench_threads_e;
+
+typedef struct
+{
+    bench_threads_e func;
+    fix16_t         a[BENCH_SIZE];
+    fix16_t         b[BENCH_SIZE];
+    fix16_t         expected[BENCH_SIZE];
+    fix16_t         out[BENCH_SIZE];
+    unsigned        mismatches;
+} bench_threads_t;
+
+static bench_threads_t bench_threads_state[BENCH_THREADS_MAX];
+
+static fix16_t         bench_threads_eval(bench_threads_e func, fix16_t a,
+                                          fix16_t b)
+{
+    switch (func)
+    {
+    case bench_threads_sin:
+        return (fix16_sin(a));
+    case bench_threads_atan2:
+        return (fix16_atan2(a, b));
+    case bench_threads_exp:
+    default:
+        return (fix16_exp(a));
+    }
+}
+
+static void* bench_threads_run(void* arg)
+{
+    bench_threads_t* t = (bench_threads_t*)arg;
+    for (unsigned pass = 0; pass < BENCH_THREADS_PASSES; ++pass)
+    {
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            t->out[i] = bench_threads_eval(t->func, t->a[i], t->b[i]);
+        bench_clobber(t->out);
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            t->mismatches += (t->out[i] != t->expected[i]);
+    }
+    return (NULL);
+}
+
+static void bench_threads_func(const char* name, bench_threads_e func,
+                               fix16_t lo, fix16_t hi)
+{
+    for (unsigned k = 0; k < BENCH_THREADS_MAX; ++k)
+    {
+        bench_threads_t* t = &bench_threads_state[k];
+        t->func            = func;
+        bench_fill(t->a, lo, hi, 0);
+        bench_fill(t->b, lo, hi, 0);
+        for (unsigned i = 0; i < BENCH_SIZE; ++i)
+            t->expected[i] = bench_threads_eval(func, t->a[i], t->b[i]);
+    }
+
+    for (unsigned n = 1; n <= BENCH_THREADS_MAX; n *= 2)
+    {
+        pthread_t thread[BENCH_THREADS_MAX];
+        unsigned  mismatches = 0;
+        char      label[64];
+
+        uint64_t  start      = bench_now();
+        for (unsigned k = 0; k < n; ++k)
+        {
+            bench_threads_state[k].mismatches = 0;
+            pthread_create(&thread[k], NULL, bench_threads_run,
+                           &bench_threads_state[k]);
+        }
+        for (unsigned k = 0; k < n; ++k)
+        {
+            pthread_join(thread[k], NULL);
+            mismatches += bench_threads_state[k].mismatches;
+        }
+
+        snprintf(label, sizeof(label), "%s, %u threads, %u wrong", name, n,
+                 mismatches);
+        bench_report(label, bench_now() - start,
+                     (uint64_t)n * BENCH_THREADS_PASSES * BENCH_SIZE);
+    }
+}
+
+void bench_threads(void)
+{
+    bench_threads_func("fix16_sin", bench_threads_sin, -fix16_from_int(100),
+                       fix16_from_int(100));
+    bench_threads_func("fix16_atan2", bench_threads_atan2,
+                       -fix16_from_int(100), fix16_from_int(100));
+    bench_threads_func("fix16_exp", bench_threads_exp, -fix16_from_int(10),
+                       fix16_from_int(10));
+}
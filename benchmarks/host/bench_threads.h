@@ -0,0 +1,6 @@
+#ifndef BENCH_THREADS_H
+#define BENCH_THREADS_H
+
+void bench_threads(void);
+
+#endif // BENCH_THREADS_H
@@ -0,0 +1,47 @@
+#include "bench_trig.h"
+#include "bench.h"
+#include <math.h>
+
+/* Prints the largest and the mean difference of fix16_sin from libm over the
+ * operands, to compare the accuracy of the variants along with their speed.
+ */
+static void bench_trig_error(void)
+{
+    uint32_t max = 0;
+    double   sum = 0.0;
+    for (unsigned i = 0; i < BENCH_SIZE; ++i)
+    {
+        fix16_t  ref   = fix16_from_dbl(sin(fix16_to_dbl(bench_a[i])));
+        fix16_t  out   = fix16_sin(bench_a[i]);
+        uint32_t error = (out > ref) ? (uint32_t)(out - ref)
+                                     : (uint32_t)(ref - out);
+        if (error > max)
+            max = error;
+        sum += error;
+    }
+    printf("  %-36s %8u LSB max %10.3f LSB mean\n", "fix16_sin error", max,
+           sum / BENCH_SIZE);
+}
+
+/* fix16_sin and fix16_cos of the same angle against fix16_sincos. Unless the
+ * variant has FIXMATH_NO_CACHE or FIXMATH_SIN_LUT, the two calls may find
+ * earlier passes in the memo cache, which fix16_sincos does not use.
+ */
+void bench_trig(void)
+{
+    bench_fill(bench_a, -fix16_from_int(100), fix16_from_int(100), 0);
+    bench_trig_error();
+
+    BENCH("fix16_sin", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sin(bench_a[i]);
+    });
+    BENCH("fix16_sin + fix16_cos", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        bench_out[i] = fix16_sin(bench_a[i]);
+        bench_b[i]   = fix16_cos(bench_a[i]);
+    });
+    BENCH("fix16_sincos", for (unsigned i = 0; i < BENCH_SIZE; ++i) {
+        fix16_sincos(bench_a[i], &bench_out[i], &bench_b[i]);
+    });
+    BENCH("fix16_sincos_array",
+          fix16_sincos_array(bench_out, bench_b, bench_a, BENCH_SIZE));
+}
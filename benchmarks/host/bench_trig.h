@@ -0,0 +1,6 @@
+#ifndef BENCH_TRIG_H
+#define BENCH_TRIG_H
+
+void bench_trig(void);
+
+#endif // BENCH_TRIG_H
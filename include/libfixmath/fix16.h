@@ -16,10 +16,14 @@ extern "C"
 
 /* These options may let the optimizer to remove some calls to the functions.
  * Refer to http://gcc.gnu.org/onlinedocs/gcc/Function-Attributes.html
+ * With FIXMATH_STICKY_OVERFLOW the functions write the overflow flag, so they
+ * are not const.
  */
 #ifndef FIXMATH_FUNC_ATTRS
 #ifdef __GNUC__
-#if __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ > 6)
+#ifdef FIXMATH_STICKY_OVERFLOW
+#define FIXMATH_FUNC_ATTRS __attribute__((nothrow))
+#elif __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ > 6)
 #define FIXMATH_FUNC_ATTRS __attribute__((leaf, nothrow, const))
 #else
 #define FIXMATH_FUNC_ATTRS __attribute__((nothrow, const))
@@ -29,6 +33,55 @@ extern "C"
 #endif
 #endif
 
+/* With FIXMATH_INLINE the core operations (fix16_add, fix16_sub, fix16_mul,
+ * fix16_div and their saturating variants) are static inline functions from
+ * fix16_inline.h, so that they can be inlined and vectorized in the caller.
+ * The library exports them either way.
+ */
+#if defined(FIXMATH_INLINE) && !defined(FIXMATH_INLINE_DEFINE)
+#define FIXMATH_INLINE_API   static inline
+#define FIXMATH_INLINE_ATTRS
+#else
+#define FIXMATH_INLINE_API   extern
+#define FIXMATH_INLINE_ATTRS FIXMATH_FUNC_ATTRS
+#endif
+
+/* FIXMATH_STICKY_OVERFLOW records overflows in a per-thread flag, see
+ * fix16_overflow_status(). The flag needs a thread-local variable, where the
+ * compiler has none it is shared by all threads.
+ *
+ * FIXMATH_THREAD_CACHE gives each thread its own memo caches for fix16_sin,
+ * fix16_atan2 and fix16_exp, so that threads never see each other's
+ * half-written entries. Where the compiler has no thread-local variables
+ * the caches are disabled instead.
+ */
+#ifdef FIXMATH_STICKY_OVERFLOW
+#ifdef FIXMATH_NO_OVERFLOW
+#error "FIXMATH_STICKY_OVERFLOW cannot be used with FIXMATH_NO_OVERFLOW"
+#endif
+#endif
+
+/* The reciprocal division only pays off without a hardware divider; with one
+ * it is slower than the hardware fix16_div and less accurate.
+ */
+#if defined(FIXMATH_FAST_DIV) && !defined(FIXMATH_NO_HARD_DIVISION)
+#error "FIXMATH_FAST_DIV requires FIXMATH_NO_HARD_DIVISION"
+#endif
+#if defined(FIXMATH_STICKY_OVERFLOW) || defined(FIXMATH_THREAD_CACHE)
+#if defined(__GNUC__)
+#define FIXMATH_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define FIXMATH_THREAD_LOCAL __declspec(thread)
+#elif defined(__cplusplus) && __cplusplus >= 201103L
+#define FIXMATH_THREAD_LOCAL thread_local
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define FIXMATH_THREAD_LOCAL _Thread_local
+#else
+#define FIXMATH_THREAD_LOCAL
+#define FIXMATH_NO_THREAD_LOCAL
+#endif
+#endif
+
 /* Automatically define FIXMATH_NO_HARD_DIVISION to maintain backwards
  * compatibility with usage of FIXMATH_OPTIMIZE_8BIT.
  */
@@ -36,6 +89,13 @@ extern "C"
 #define FIXMATH_NO_HARD_DIVISION
 #endif
 
+/* FIXMATH_SIN_LUT_BITS selects the interpolated table, a smaller variant of
+ * FIXMATH_SIN_LUT.
+ */
+#if defined(FIXMATH_SIN_LUT_BITS) && !defined(FIXMATH_SIN_LUT)
+#define FIXMATH_SIN_LUT
+#endif
+
 #ifdef __KERNEL__
 #include <linux/types.h>
 #else
@@ -159,6 +219,38 @@ extern "C"
         return (fix16_min(fix16_max(x, lo), hi));
     }
 
+#ifdef FIXMATH_STICKY_OVERFLOW
+    /** Nonzero once an operation of the calling thread has overflowed, see
+     * fix16_overflow_status(). Only the inline operations access it
+     * directly.
+     */
+    extern FIXMATH_THREAD_LOCAL uint16_t fix16_overflow_sticky;
+
+    /** Returns nonzero if fix16_add, fix16_sub, fix16_mul, fix16_div or one
+     * of their saturating variants has overflowed in the calling thread since
+     * the last fix16_overflow_clear(). Division by zero counts as overflow.
+     * The results are the same as without FIXMATH_STICKY_OVERFLOW, so that
+     * a block of operations can run without a branch per result and be
+     * checked once at the end.
+     */
+    extern int  fix16_overflow_status(void);
+
+    /** Clears the sticky overflow flag of the calling thread.
+     */
+    extern void fix16_overflow_clear(void);
+#endif
+
+    /* Returns fix16_overflow after recording it in the sticky flag, if there
+     * is one.
+     */
+    static inline fix16_t fix16_overflow_raise(void)
+    {
+#ifdef FIXMATH_STICKY_OVERFLOW
+        fix16_overflow_sticky = 1U;
+#endif
+        return (fix16_overflow);
+    }
+
 /* Subtraction and addition with (optional) overflow detection. */
 #ifdef FIXMATH_NO_OVERFLOW
 
@@ -173,35 +265,103 @@ extern "C"
 
 #else
 
-extern fix16_t fix16_add(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
-extern fix16_t fix16_sub(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
+FIXMATH_INLINE_API fix16_t fix16_add(fix16_t a, fix16_t b) FIXMATH_INLINE_ATTRS;
+FIXMATH_INLINE_API fix16_t fix16_sub(fix16_t a, fix16_t b) FIXMATH_INLINE_ATTRS;
 
 /* Saturating arithmetic */
-extern fix16_t fix16_sadd(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
-extern fix16_t fix16_ssub(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
+FIXMATH_INLINE_API fix16_t fix16_sadd(fix16_t a,
+                                      fix16_t b) FIXMATH_INLINE_ATTRS;
+FIXMATH_INLINE_API fix16_t fix16_ssub(fix16_t a,
+                                      fix16_t b) FIXMATH_INLINE_ATTRS;
 
 #endif
 
     /** Multiplies the two given fix16_t's and returns the result.
      */
-    extern fix16_t fix16_mul(fix16_t inArg0, fix16_t inArg1) FIXMATH_FUNC_ATTRS;
+    FIXMATH_INLINE_API fix16_t fix16_mul(fix16_t inArg0,
+                                         fix16_t inArg1) FIXMATH_INLINE_ATTRS;
 
     /** Divides the first given fix16_t by the second and returns the result.
+     * With FIXMATH_FAST_DIV, meant for targets without a hardware divider,
+     * this multiplies by a 32-bit reciprocal of the divisor instead. The
+     * result is then never below the exact one in magnitude and at most 3 LSB
+     * above it, and close to the overflow limit it may return fix16_overflow
+     * early. That version is never inlined.
      */
+#ifdef FIXMATH_FAST_DIV
     extern fix16_t fix16_div(fix16_t inArg0, fix16_t inArg1) FIXMATH_FUNC_ATTRS;
+#else
+    FIXMATH_INLINE_API fix16_t fix16_div(fix16_t inArg0,
+                                         fix16_t inArg1) FIXMATH_INLINE_ATTRS;
+#endif
+
+    /** Returns a * b + c with a single rounding of the full 64-bit sum.
+     * The result is rounded like fix16_mul and saturates to fix16_maximum or
+     * fix16_minimum unless FIXMATH_NO_OVERFLOW is defined.
+     */
+    extern fix16_t fix16_fma(fix16_t a, fix16_t b,
+                             fix16_t c) FIXMATH_FUNC_ATTRS;
 
 #ifndef FIXMATH_NO_OVERFLOW
     /** Performs a saturated multiplication (overflow-protected) of the two
      * given fix16_t's and returns the result.
      */
-    extern fix16_t fix16_smul(fix16_t inArg0,
-                              fix16_t inArg1) FIXMATH_FUNC_ATTRS;
+    FIXMATH_INLINE_API fix16_t fix16_smul(fix16_t inArg0,
+                                          fix16_t inArg1) FIXMATH_INLINE_ATTRS;
 
     /** Performs a saturated division (overflow-protected) of the first fix16_t
      * by the second and returns the result.
      */
-    extern fix16_t fix16_sdiv(fix16_t inArg0,
-                              fix16_t inArg1) FIXMATH_FUNC_ATTRS;
+    FIXMATH_INLINE_API fix16_t fix16_sdiv(fix16_t inArg0,
+                                          fix16_t inArg1) FIXMATH_INLINE_ATTRS;
+#endif
+
+    /** Precomputed divisor for repeated division by the same fix16_t.
+     * Holds the normalized magnitude of the divisor and its 32-bit
+     * reciprocal, so that each division costs two multiplications instead
+     * of a full division. Create it with fix16_divisor_create().
+     */
+    typedef struct
+    {
+        uint32_t divider; /**< |divisor| shifted so that bit 31 is set */
+        uint32_t inverse; /**< floor((2^64 - 1) / divider) - 2^32 */
+        uint32_t limit;   /**< dividends with |a| >= limit overflow */
+        uint8_t  shift;   /**< the shift applied to divider */
+        uint8_t  negative; /**< 1 if the divisor is negative */
+    } fix16_divisor_t;
+
+    /** Precomputes the given divisor for fix16_div_by().
+     */
+    extern fix16_divisor_t fix16_divisor_create(fix16_t inDivisor);
+
+    /** Divides the given fix16_t by a precomputed divisor. The quotient is
+     * exact before rounding, so the result is the same as fix16_div()
+     * without FIXMATH_FAST_DIV, including division by zero and the
+     * fix16_overflow result. With FIXMATH_NO_OVERFLOW the result of an
+     * overflowing division is unspecified, as it is for fix16_div().
+     */
+    extern fix16_t fix16_div_by(fix16_t                inArg0,
+                                const fix16_divisor_t* inDivisor);
+
+#ifndef FIXMATH_NO_OVERFLOW
+    /** Saturated division by a precomputed divisor, see fix16_sdiv().
+     */
+    extern fix16_t fix16_sdiv_by(fix16_t                inArg0,
+                                 const fix16_divisor_t* inDivisor);
+#endif
+
+    /** Returns the reciprocal 1 / x of the given fix16_t. A seed table and
+     * two Newton-Raphson iterations give a close estimate that is corrected
+     * using the exact remainder, so the result is the same as the software
+     * fix16_div(fix16_one, x), including division by zero and overflow for
+     * |x| <= 2 LSB.
+     */
+    extern fix16_t fix16_recip(fix16_t inArg) FIXMATH_FUNC_ATTRS;
+
+#ifndef FIXMATH_NO_OVERFLOW
+    /** Saturated reciprocal, see fix16_sdiv().
+     */
+    extern fix16_t fix16_srecip(fix16_t inArg) FIXMATH_FUNC_ATTRS;
 #endif
 
     /** Divides the first given fix16_t by the second and returns the result.
@@ -230,6 +390,14 @@ extern fix16_t fix16_ssub(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
      */
     extern fix16_t fix16_cos(fix16_t inAngle) FIXMATH_FUNC_ATTRS;
 
+    /** Stores the sine and the cosine of the given fix16_t, reducing the
+     * angle only once. The results are the same as those of fix16_sin() and
+     * fix16_cos(), except within pi/2 of fix16_maximum where fix16_cos()
+     * wraps around. It does not use the memo cache of fix16_sin().
+     */
+    extern void fix16_sincos(fix16_t inAngle, fix16_t* outSin,
+                             fix16_t* outCos);
+
     /** Returns the tangent of the given fix16_t.
      */
     extern fix16_t fix16_tan(fix16_t inAngle) FIXMATH_FUNC_ATTRS;
@@ -250,6 +418,27 @@ extern fix16_t fix16_ssub(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
      */
     extern fix16_t fix16_atan2(fix16_t inY, fix16_t inX) FIXMATH_FUNC_ATTRS;
 
+    /** Iterations of the CORDIC functions that give the full accuracy, larger
+     * counts are treated as this one. Each iteration adds about one bit, the
+     * results are within 1 LSB from 20 on.
+     */
+    static const unsigned fix16_cordic_iterations = 24;
+
+    /** Stores the sine and the cosine of the given fix16_t, computed with
+     * the given number of CORDIC rotations. Uses only shifts, additions and
+     * a 24 entry table, no multiplication or division.
+     */
+    extern void fix16_cordic_sincos(fix16_t inAngle, fix16_t* outSin,
+                                    fix16_t* outCos, unsigned iterations);
+
+    /** Returns the arctangent of inY/inX and stores the length of the vector
+     * (inX, inY), saturated to fix16_maximum, in outHypot unless it is NULL.
+     * Both come from one pass of the given number of CORDIC rotations, the
+     * length needs one multiplication by the gain.
+     */
+    extern fix16_t fix16_cordic_atan2(fix16_t inY, fix16_t inX,
+                                      fix16_t* outHypot, unsigned iterations);
+
     static const fix16_t  fix16_rad_to_deg_mult = 3754936;
     static inline fix16_t fix16_rad_to_deg(fix16_t radians)
     {
@@ -262,10 +451,32 @@ extern fix16_t fix16_ssub(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
         return (fix16_mul(degrees, fix16_deg_to_rad_mult));
     }
 
-    /** Returns the square root of the given fix16_t.
+    /** Returns the square root of the given fix16_t, or -sqrt(-inValue) for
+     * negative values. Computed from fix16_rsqrt() and corrected to the
+     * results of the bit-by-bit algorithm it replaces.
      */
     extern fix16_t fix16_sqrt(fix16_t inValue) FIXMATH_FUNC_ATTRS;
 
+    /** Returns the inverse square root 1 / sqrt(inValue), correctly rounded
+     * or truncated with FIXMATH_NO_ROUNDING, and -1 / sqrt(-inValue) for
+     * negative values like fix16_sqrt(). Returns fix16_overflow for 0.
+     */
+    extern fix16_t fix16_rsqrt(fix16_t inValue) FIXMATH_FUNC_ATTRS;
+
+    /** Scales the vector (*x, *y) to unit length in place and returns its
+     * previous length, saturated to fix16_maximum. The length is correctly
+     * rounded and the components are within 1/2 LSB plus 2^-9 of the unit
+     * vector. With FIXMATH_NO_ROUNDING the length is truncated and the
+     * components are less than 1 LSB off. The zero vector is left as it is
+     * and returns 0.
+     */
+    extern fix16_t fix16_normalize2(fix16_t* x, fix16_t* y);
+
+    /** Scales the vector (*x, *y, *z) to unit length in place, see
+     * fix16_normalize2().
+     */
+    extern fix16_t fix16_normalize3(fix16_t* x, fix16_t* y, fix16_t* z);
+
     /** Returns the square of the given fix16_t.
      */
     static inline fix16_t fix16_sq(fix16_t x)
@@ -277,11 +488,13 @@ extern fix16_t fix16_ssub(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
      */
     extern fix16_t fix16_exp(fix16_t inValue) FIXMATH_FUNC_ATTRS;
 
-    /** Returns the natural logarithm of the given fix16_t.
+    /** Returns the natural logarithm of the given fix16_t, or fix16_minimum
+     * for inValue <= 0. Within 1 LSB, in a fixed number of operations.
      */
     extern fix16_t fix16_log(fix16_t inValue) FIXMATH_FUNC_ATTRS;
 
-    /** Returns the base 2 logarithm of the given fix16_t.
+    /** Returns the base 2 logarithm of the given fix16_t, or fix16_overflow
+     * for x <= 0. Within 1 LSB, in a fixed number of operations.
      */
     extern fix16_t fix16_log2(fix16_t x) FIXMATH_FUNC_ATTRS;
 
@@ -289,6 +502,78 @@ extern fix16_t fix16_ssub(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
      */
     extern fix16_t fix16_slog2(fix16_t x) FIXMATH_FUNC_ATTRS;
 
+    /** Returns the base 10 logarithm of the given fix16_t, or fix16_minimum
+     * for inValue <= 0. Within 1 LSB, in a fixed number of operations.
+     */
+    extern fix16_t fix16_log10(fix16_t inValue) FIXMATH_FUNC_ATTRS;
+
+    /** Returns 2 to the power of the given fix16_t, saturated like
+     * fix16_exp(). Within 0.5 LSB plus 2^-30 of the result.
+     */
+    extern fix16_t fix16_exp2(fix16_t inValue) FIXMATH_FUNC_ATTRS;
+
+    /** Returns x to the integer power n by squaring and multiplying, with
+     * the products rounded to 32 bits, so that the result is within 1 LSB
+     * plus |n| * 2^-31 of it. x^0 is fix16_one, also for x == 0. Returns
+     * fix16_overflow if the result does not fit, including 0 to a negative
+     * power.
+     */
+    extern fix16_t fix16_powi(fix16_t x, int32_t n) FIXMATH_FUNC_ATTRS;
+
+    /** Returns x to the power y as 2^(y log2(x)), in a fixed number of
+     * operations. The result is within 1 LSB plus |y| * 2^-25 of it. An
+     * integer y is passed to fix16_powi(), which also takes negative x.
+     * Returns fix16_overflow if the result does not fit, for 0 to a
+     * negative power and for negative x with a fractional y.
+     */
+    extern fix16_t fix16_pow(fix16_t x, fix16_t y) FIXMATH_FUNC_ATTRS;
+
+#ifndef FIXMATH_NO_OVERFLOW
+    /** Saturated integer power, see fix16_powi(). 0 to a negative power
+     * saturates to fix16_maximum.
+     */
+    extern fix16_t fix16_spowi(fix16_t x, int32_t n) FIXMATH_FUNC_ATTRS;
+
+    /** Saturated power, see fix16_pow(). Negative x with a fractional y
+     * still returns fix16_overflow, as it has no real power.
+     */
+    extern fix16_t fix16_spow(fix16_t x, fix16_t y) FIXMATH_FUNC_ATTRS;
+#endif
+
+#ifdef FIXMATH_CACHE_STATS
+    /** The memo caches of fix16_sin (also used by fix16_cos and fix16_tan),
+     * fix16_atan2 (also fix16_atan, fix16_asin and fix16_acos) and fix16_exp.
+     */
+    typedef enum
+    {
+        fix16_cache_sin = 0,
+        fix16_cache_atan2,
+        fix16_cache_exp,
+        fix16_cache_count,
+    } fix16_cache_e;
+
+    /** Counters of one memo cache.
+     */
+    typedef struct
+    {
+        uint32_t hits;      /**< calls answered from the cache */
+        uint32_t misses;    /**< calls that computed and stored the result */
+        uint32_t evictions; /**< misses that replaced another input's entry */
+    } fix16_cache_stats_t;
+
+    /** Returns the counters of the given cache since the last
+     * fix16_cache_stats_clear(). With FIXMATH_THREAD_CACHE they count the
+     * calls of the calling thread, otherwise those of all threads, which may
+     * lose counts when threads call concurrently. Caches that are disabled,
+     * such as the sine cache with FIXMATH_SIN_LUT, count nothing.
+     */
+    extern fix16_cache_stats_t fix16_cache_stats(fix16_cache_e cache);
+
+    /** Resets the counters of all caches.
+     */
+    extern void fix16_cache_stats_clear(void);
+#endif
+
     /** Convert fix16_t value to a string.
      * Required buffer length for largest values is 13 bytes.
      */
@@ -377,6 +662,10 @@ extern fix16_t fix16_ssub(fix16_t a, fix16_t b) FIXMATH_FUNC_ATTRS;
                    ? -FIXMATH_COMBINE_I_M((unsigned)(((i) * -1)), m)           \
                    : FIXMATH_COMBINE_I_M((unsigned)i, m)))
 
+#if defined(FIXMATH_INLINE) && !defined(FIXMATH_INLINE_DEFINE)
+#include "fix16_inline.h"
+#endif
+
 #ifdef __cplusplus
 }
 #include "fix16.hpp"
@@ -2,688 +2,2512 @@
 #define libfixmath_fix16_hpp__
 
 #include "fix16.h"
+#ifdef FIXMATH_SIN_LUT_BITS
+#include "fix16_trig_sin_lut_small.h"
+#endif
+
+/* With C++14 or later, Fixed<I, F> is a literal type and its constructors,
+ * operators and conversions are constexpr, so that tables declared constexpr
+ * are built by the compiler. Fix16 forwards to the C functions at run time
+ * and switches to the constexpr kernels below during constant evaluation,
+ * which needs __builtin_is_constant_evaluated (GCC 9, Clang 9, MSVC 19.25 or
+ * later). FIXMATH_CONSTEXPR_FIX16 is defined where it is available, without
+ * it Fix16 arithmetic is evaluated at run time only.
+ */
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define FIXMATH_CONSTEXPR constexpr
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define FIXMATH_CONSTEXPR_FIX16
+#endif
+#endif
+#if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) ||            \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define FIXMATH_CONSTEXPR_FIX16
+#endif
+#else
+#define FIXMATH_CONSTEXPR
+#endif
+
+#ifdef FIXMATH_CONSTEXPR_FIX16
+#define FIXMATH_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define FIXMATH_CONSTANT_EVALUATED() false
+#endif
+
+/* Fix16x4 and Fix16x8 use the SIMD instructions that the compiler targets,
+ * see Fix16xN below.
+ */
+#if !defined(FIXMATH_NO_SIMD) && !defined(FIXMATH_OPTIMIZE_8BIT) &&            \
+    !defined(FIXMATH_STICKY_OVERFLOW)
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FIXMATH_PACK_SSE2
+#include <emmintrin.h>
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+#endif
+#ifdef __AVX2__
+#define FIXMATH_PACK_AVX2
+#include <immintrin.h>
+#endif
+#endif
 
-class Fix16
+namespace fixmath
 {
-  public:
-    fix16_t value;
 
-    Fix16()
+/* How results with more fraction bits than the format are rounded. Nearest
+ * rounds halves away from zero. Truncate drops the extra bits like
+ * FIXMATH_NO_ROUNDING does, so products round toward minus infinity and
+ * quotients toward zero.
+ */
+enum class Rounding
+{
+    Nearest,
+    Truncate
+};
+
+/* What happens when a result does not fit. Wrap keeps the low 32 bits like
+ * FIXMATH_NO_OVERFLOW, Flag returns the overflow value (the minimum of the
+ * format) like fix16_add and friends, and Saturate clamps to the limit with
+ * the sign of the exact result.
+ */
+enum class Overflow
+{
+    Wrap,
+    Flag,
+    Saturate
+};
+
+template <Rounding R, Overflow O> struct Policy
+{
+    static constexpr Rounding rounding = R;
+    static constexpr Overflow overflow = O;
+};
+
+/* The policy matching the C functions in this build. */
+#ifdef FIXMATH_NO_ROUNDING
+static constexpr Rounding default_rounding = Rounding::Truncate;
+#else
+static constexpr Rounding default_rounding = Rounding::Nearest;
+#endif
+#if defined(FIXMATH_NO_OVERFLOW)
+static constexpr Overflow default_overflow = Overflow::Wrap;
+#elif defined(FIXMATH_SATURATING_ARITHMETIC)
+static constexpr Overflow default_overflow = Overflow::Saturate;
+#else
+static constexpr Overflow default_overflow = Overflow::Flag;
+#endif
+
+typedef Policy<default_rounding, default_overflow> DefaultPolicy;
+
+namespace detail
+{
+
+/* A 64 bit magnitude as two words. The kernels below work on these rather
+ * than int64.h, so that they are constexpr and need no 64 bit type with
+ * FIXMATH_NO_64BIT.
+ */
+struct Wide
+{
+    uint32_t hi;
+    uint32_t lo;
+};
+
+FIXMATH_CONSTEXPR inline uint32_t magnitude(int32_t x)
+{
+    return (x < 0 ? 0U - (uint32_t)x : (uint32_t)x);
+}
+
+FIXMATH_CONSTEXPR inline Wide wide_add(Wide x, Wide y)
+{
+    uint32_t lo = x.lo + y.lo;
+    return (Wide{x.hi + y.hi + (lo < x.lo), lo});
+}
+
+/* Shifts by s bits, 0 <= s < 64. */
+FIXMATH_CONSTEXPR inline Wide wide_shl(Wide x, int s)
+{
+    if (s >= 32)
+        return (Wide{x.lo << (s - 32), 0U});
+    if (s == 0)
+        return (x);
+    return (Wide{(x.hi << s) | (x.lo >> (32 - s)), x.lo << s});
+}
+
+FIXMATH_CONSTEXPR inline Wide wide_shr(Wide x, int s)
+{
+    if (s >= 32)
+        return (Wide{0U, x.hi >> (s - 32)});
+    if (s == 0)
+        return (x);
+    return (Wide{x.hi >> s, (x.lo >> s) | (x.hi << (32 - s))});
+}
+
+/* Full 32*32->64 bit unsigned product. */
+FIXMATH_CONSTEXPR inline Wide wide_mul(uint32_t x, uint32_t y)
+{
+#ifndef FIXMATH_NO_64BIT
+    uint64_t product = (uint64_t)x * y;
+    return (Wide{(uint32_t)(product >> 32U), (uint32_t)product});
+#else
+    uint32_t ll  = (x & 0xFFFFU) * (y & 0xFFFFU);
+    uint32_t lh  = (x & 0xFFFFU) * (y >> 16U);
+    uint32_t hl  = (x >> 16U) * (y & 0xFFFFU);
+    uint32_t hh  = (x >> 16U) * (y >> 16U);
+    uint32_t mid = (ll >> 16U) + (lh & 0xFFFFU) + (hl & 0xFFFFU);
+    return (Wide{hh + (lh >> 16U) + (hl >> 16U) + (mid >> 16U),
+                 (mid << 16U) | (ll & 0xFFFFU)});
+#endif
+}
+
+/* Result of an overflowing operation whose exact result has the given sign.
+ * Not used with Overflow::Wrap. Constant evaluation does not set the sticky
+ * overflow flag.
+ */
+template <class P> FIXMATH_CONSTEXPR inline int32_t overflowed(bool negative)
+{
+    if (P::overflow == Overflow::Saturate)
+        return (negative ? fix16_minimum : fix16_maximum);
+#ifdef FIXMATH_STICKY_OVERFLOW
+    if (!FIXMATH_CONSTANT_EVALUATED())
+        return (fix16_overflow_raise());
+#endif
+    return (fix16_overflow);
+}
+
+template <class P> FIXMATH_CONSTEXPR inline int32_t add(int32_t a, int32_t b)
+{
+    uint32_t sum = (uint32_t)a + (uint32_t)b;
+    if (P::overflow != Overflow::Wrap &&
+        ((~((uint32_t)a ^ (uint32_t)b) & ((uint32_t)a ^ sum)) >> 31U))
+        return (overflowed<P>(a < 0));
+    return ((int32_t)sum);
+}
+
+template <class P> FIXMATH_CONSTEXPR inline int32_t sub(int32_t a, int32_t b)
+{
+    uint32_t diff = (uint32_t)a - (uint32_t)b;
+    if (P::overflow != Overflow::Wrap &&
+        ((((uint32_t)a ^ (uint32_t)b) & ((uint32_t)a ^ diff)) >> 31U))
+        return (overflowed<P>(a < 0));
+    return ((int32_t)diff);
+}
+
+/* Shifts the magnitude m right by S bits, 0 <= S < 63, rounding as the
+ * policy says, and applies the sign. Rounding the magnitude gives the same
+ * results as fix16_mul for in range products.
+ */
+template <int S, class P>
+FIXMATH_CONSTEXPR inline int32_t narrow(bool negative, Wide m)
+{
+    static_assert(S >= 0 && S < 63, "shift out of range");
+
+    if (S > 0)
     {
-        value = 0;
+        Wide bias = {0U, 0U};
+        if (P::rounding == Rounding::Nearest)
+            bias = wide_shl(Wide{0U, 1U}, S > 0 ? S - 1 : 0);
+        else if (negative)
+            bias = wide_add(wide_shl(Wide{0U, 1U}, S), Wide{~0U, ~0U});
+        m = wide_shr(wide_add(m, bias), S);
     }
-    Fix16(const Fix16& inValue)
+
+    if (P::overflow != Overflow::Wrap &&
+        (m.hi != 0U || m.lo > 0x7FFFFFFFU + (uint32_t)negative))
+        return (overflowed<P>(negative));
+    return ((int32_t)(negative ? 0U - m.lo : m.lo));
+}
+
+/* Rescales v by 2^S, where a negative S shifts right. */
+template <int S, class P> FIXMATH_CONSTEXPR inline int32_t rescale(int32_t v)
+{
+    static_assert(S > -32 && S < 32, "shift out of range");
+
+    Wide m = {0U, magnitude(v)};
+    if (S > 0)
+        m = wide_shl(m, S > 0 ? S : 0);
+    return (narrow<(S < 0 ? -S : 0), P>(v < 0, m));
+}
+
+/* Product of a and b shifted right by S bits. */
+template <int S, class P>
+FIXMATH_CONSTEXPR inline int32_t mul(int32_t a, int32_t b)
+{
+    return (narrow<S, P>((a ^ b) < 0, wide_mul(magnitude(a), magnitude(b))));
+}
+
+/* Divides n by d and stores the remainder in r. */
+FIXMATH_CONSTEXPR inline Wide udiv(Wide n, uint32_t d, uint32_t& r)
+{
+#ifndef FIXMATH_NO_64BIT
+    uint64_t x = ((uint64_t)n.hi << 32U) | n.lo;
+    uint64_t q = x / d;
+    r          = (uint32_t)(x - q * d);
+    return (Wide{(uint32_t)(q >> 32U), (uint32_t)q});
+#else
+    // Binary restoring division, one quotient bit per step.
+    Wide q = {0U, 0U};
+    r      = 0U;
+    for (int i = 63; i >= 0; --i)
+    {
+        uint32_t carry = r >> 31U;
+        uint32_t bit   = (i >= 32) ? (n.hi >> (i - 32)) : (n.lo >> i);
+        r              = (r << 1U) | (bit & 1U);
+        if (carry || r >= d)
+        {
+            r -= d;
+            if (i >= 32)
+                q.hi |= 1U << (i - 32);
+            else
+                q.lo |= 1U << i;
+        }
+    }
+    return (q);
+#endif
+}
+
+/* Quotient of a * 2^S by b, 0 <= S <= 32, rounded and checked like
+ * fix16_div: division by zero returns the overflow value and a quotient with
+ * a magnitude of 2^31 overflows.
+ */
+template <int S, class P>
+FIXMATH_CONSTEXPR inline int32_t div(int32_t a, int32_t b)
+{
+    static_assert(S >= 0 && S <= 32, "shift out of range");
+
+    bool negative = ((a ^ b) < 0);
+    if (b == 0)
     {
-        value = inValue.value;
+        if (P::overflow == Overflow::Saturate)
+            return (negative ? fix16_minimum : fix16_maximum);
+        return (overflowed<Policy<P::rounding, Overflow::Flag>>(negative));
+    }
+
+    uint32_t d = magnitude(b);
+    uint32_t r = 0U;
+    Wide     q = udiv(wide_shl(Wide{0U, magnitude(a)}, S), d, r);
+    if (P::rounding == Rounding::Nearest && r >= d - r)
+        q = wide_add(q, Wide{0U, 1U});
+
+    if (P::overflow != Overflow::Wrap && (q.hi != 0U || q.lo > 0x7FFFFFFFU))
+        return (overflowed<P>(negative));
+    return ((int32_t)(negative ? 0U - q.lo : q.lo));
+}
+
+/* Constant evaluation versions of the fix16_t functions that Fixed<16, 16>
+ * wraps. They follow the C code without its caches, multiply like fix16_mul
+ * and divide like the software fix16_div. With FIXMATH_SIN_LUT_BITS the
+ * sine interpolates the same constant table. The full table of
+ * FIXMATH_SIN_LUT is too large to include here, so with it the constant
+ * sine uses the polynomial and may differ from fix16_sin().
+ */
+namespace constant
+{
+
+FIXMATH_CONSTEXPR inline int32_t mul(int32_t a, int32_t b)
+{
+    return (detail::mul<16, DefaultPolicy>(a, b));
+}
+
+FIXMATH_CONSTEXPR inline int32_t div(int32_t a, int32_t b)
+{
+    return (detail::div<16, DefaultPolicy>(a, b));
+}
+
+/* Plain int32_t addition and subtraction where the C code lets them wrap,
+ * as for the fix16_overflow that atan2 gets from asin(1).
+ */
+FIXMATH_CONSTEXPR inline int32_t wrap_add(int32_t a, int32_t b)
+{
+    return (detail::add<Policy<default_rounding, Overflow::Wrap>>(a, b));
+}
+
+FIXMATH_CONSTEXPR inline int32_t wrap_sub(int32_t a, int32_t b)
+{
+    return (detail::sub<Policy<default_rounding, Overflow::Wrap>>(a, b));
+}
+
+FIXMATH_CONSTEXPR inline int32_t sqrt(int32_t x)
+{
+    uint32_t num    = magnitude(x);
+    uint32_t result = 0U;
+    uint32_t bit    = (num & 0xFFF00000U) ? 1U << 30U : 1U << 18U;
+
+    while (bit > num)
+        bit >>= 2U;
+
+    // The top 24 bits of the root, then the low 8 bits, see fix16_sqrt().
+    for (int n = 0; n < 2; n++)
+    {
+        while (bit != 0U)
+        {
+            if (num >= result + bit)
+            {
+                num -= result + bit;
+                result = (result >> 1U) + bit;
+            }
+            else
+                result >>= 1U;
+            bit >>= 2U;
+        }
+
+        if (n == 0)
+        {
+            if (num > 65535U)
+            {
+                num -= result;
+                num    = (num << 16U) - 0x8000U;
+                result = (result << 16U) + 0x8000U;
+            }
+            else
+            {
+                num <<= 16U;
+                result <<= 16U;
+            }
+            bit = 1U << 14U;
+        }
     }
-    Fix16(const fix16_t inValue)
+
+#ifndef FIXMATH_NO_ROUNDING
+    if (num > result)
+        result++;
+#endif
+    return (x < 0 ? -(int32_t)result : (int32_t)result);
+}
+
+#ifdef FIXMATH_SIN_LUT_BITS
+/* fix16_angle_from_rad(). */
+FIXMATH_CONSTEXPR inline uint32_t angle_from_rad(int32_t x)
+{
+    uint64_t frac = (uint64_t)((int64_t)x * 1625002897) + 0x80000000U;
+    return (((uint32_t)x * 10430U) + (uint32_t)(frac >> 32U));
+}
+
+/* fix16_angle_sin(). */
+FIXMATH_CONSTEXPR inline int32_t angle_sin(uint32_t angle)
+{
+    uint32_t quarter = angle & 0x3FFFFFFFU;
+    if (angle & 0x40000000U)
+        quarter = 0x40000000U - quarter;
+
+    uint32_t index = quarter >> (30 - FIXMATH_SIN_LUT_BITS);
+    int32_t  frac  = (int32_t)((quarter >> (14 - FIXMATH_SIN_LUT_BITS)) &
+                              0xFFFFU);
+    int32_t  a     = _fix16_sin_lut_small[index];
+    int32_t  b     = _fix16_sin_lut_small[index + 1];
+    int32_t  out   = a + (((b - a) * frac + 0x8000) >> 16);
+
+    return ((angle & 0x80000000U) ? -out : out);
+}
+#endif
+
+FIXMATH_CONSTEXPR inline int32_t sin(int32_t x)
+{
+#ifdef FIXMATH_SIN_LUT_BITS
+    return (angle_sin(angle_from_rad(x)));
+#else
+    int32_t angle = x % (fix16_pi << 1);
+    if (angle > fix16_pi)
+        angle -= (fix16_pi << 1);
+    else if (angle < -fix16_pi)
+        angle += (fix16_pi << 1);
+
+    int32_t angle_sq = mul(angle, angle);
+#ifndef FIXMATH_FAST_SIN
+    int32_t out      = angle;
+    angle            = mul(angle, angle_sq);
+    out -= (angle / 6);
+    angle = mul(angle, angle_sq);
+    out += (angle / 120);
+    angle = mul(angle, angle_sq);
+    out -= (angle / 5040);
+    angle = mul(angle, angle_sq);
+    out += (angle / 362880);
+    angle = mul(angle, angle_sq);
+    out -= (angle / 39916800);
+#else
+    int32_t out = mul(-13, angle_sq) + 546;
+    out         = mul(out, angle_sq) - 10923;
+    out         = mul(out, angle_sq) + 65536;
+    out         = mul(out, angle);
+#endif
+    return (out);
+#endif
+}
+
+FIXMATH_CONSTEXPR inline int32_t cos(int32_t x)
+{
+#ifdef FIXMATH_SIN_LUT_BITS
+    return (angle_sin(angle_from_rad(x) + 0x40000000U));
+#else
+    return (sin(wrap_add(x, fix16_pi >> 1)));
+#endif
+}
+
+FIXMATH_CONSTEXPR inline int32_t tan(int32_t x)
+{
+#ifndef FIXMATH_NO_OVERFLOW
+    return (detail::div<16, Policy<default_rounding, Overflow::Saturate>>(
+        sin(x), cos(x)));
+#else
+    return (div(sin(x), cos(x)));
+#endif
+}
+
+FIXMATH_CONSTEXPR inline int32_t atan2(int32_t y, int32_t x)
+{
+    int32_t mask  = y >> 31;
+    int32_t abs_y = wrap_add(y, mask) ^ mask;
+    int32_t r     = (x >= 0) ? div(wrap_sub(x, abs_y), wrap_add(x, abs_y))
+                             : div(wrap_add(x, abs_y), wrap_sub(abs_y, x));
+    int32_t r_3   = mul(mul(r, r), r);
+    int32_t angle = wrap_add(wrap_sub(mul(0x00003240, r_3), mul(0x0000FB50, r)),
+                             (x >= 0) ? PI_DIV_4 : THREE_PI_DIV_4);
+    return (y < 0 ? wrap_sub(0, angle) : angle);
+}
+
+FIXMATH_CONSTEXPR inline int32_t atan(int32_t x)
+{
+    return (atan2(x, fix16_one));
+}
+
+FIXMATH_CONSTEXPR inline int32_t asin(int32_t x)
+{
+    if (x > fix16_one || x < -fix16_one)
+        return (0);
+    return (atan(div(x, sqrt(fix16_one - mul(x, x)))));
+}
+
+FIXMATH_CONSTEXPR inline int32_t acos(int32_t x)
+{
+    return ((fix16_pi >> 1) - asin(x));
+}
+
+/* 2^(k/32) * 2^31, the table of fix16_exp(). */
+static FIXMATH_CONSTEXPR const uint32_t exp2_table[32] = {
+    2147483648U, 2194507417U, 2242560872U, 2291666561U, 2341847524U,
+    2393127307U, 2445529972U, 2499080105U, 2553802834U, 2609723834U,
+    2666869345U, 2725266179U, 2784941738U, 2845924021U, 2908241642U,
+    2971923842U, 3037000500U, 3103502151U, 3171459999U, 3240905930U,
+    3311872529U, 3384393094U, 3458501653U, 3534232978U, 3611622603U,
+    3690706840U, 3771522796U, 3854108391U, 3938502376U, 4024744348U,
+    4112874773U, 4202935003U,
+};
+
+FIXMATH_CONSTEXPR inline uint32_t mulhi(uint32_t x, uint32_t y)
+{
+    return (wide_mul(x, y).hi);
+}
+
+/* 2^(f / 2^32) * 2^31, see fix16_exp2_frac(). */
+FIXMATH_CONSTEXPR inline uint32_t exp2_frac(uint32_t f)
+{
+    uint32_t t  = exp2_table[f >> 27];
+    uint32_t u  = mulhi(f & 0x07FFFFFFU, 2977044472U);
+    uint32_t u2 = mulhi(u, u);
+    uint32_t u3 = mulhi(u2, u);
+    uint32_t u4 = mulhi(u3, u);
+    uint32_t p  = u + (u2 >> 1) + mulhi(u3, 715827883U) +
+                 mulhi(u4, 178956971U);
+    return (t + mulhi(t, p));
+}
+
+/* 2^n * m / 2^31, see fix16_exp2_scale(). */
+FIXMATH_CONSTEXPR inline int32_t exp2_scale(int32_t n, uint32_t m)
+{
+    int shift = 15 - n;
+    if (shift <= 0)
+    {
+        if ((shift < 0) || (m > (uint32_t)fix16_maximum))
+            return (fix16_maximum);
+        return ((int32_t)m);
+    }
+    if (shift > 32)
+        return (0);
+#ifndef FIXMATH_NO_ROUNDING
+    if (shift == 32)
+        return (1);
+    uint32_t result = (m >> shift) + ((m >> (shift - 1)) & 1U);
+    return ((result > (uint32_t)fix16_maximum) ? fix16_maximum
+                                               : (int32_t)result);
+#else
+    if (shift == 32)
+        return (0);
+    return ((int32_t)(m >> shift));
+#endif
+}
+
+FIXMATH_CONSTEXPR inline int32_t exp(int32_t x)
+{
+    if (x == 0)
+        return (fix16_one);
+    if (x == fix16_one)
+        return (fix16_e);
+    if (x >= 681391)
+        return (fix16_maximum);
+    if (x <= -772243)
+        return (0);
+
+    /* x log2(e) * 2^46 as a two's complement 64 bit number. */
+    Wide t = wide_mul(magnitude(x), 1549082005U);
+    if (x < 0)
+        t = wide_add(Wide{~t.hi, ~t.lo}, Wide{0U, 1U});
+    int32_t  n = (int32_t)t.hi >> 14;
+    uint32_t f = (t.hi << 18) | (t.lo >> 14);
+    return (exp2_scale(n, exp2_frac(f)));
+}
+
+/* The tables of fix16_log2_q26(). */
+static FIXMATH_CONSTEXPR const uint32_t log2_inv[32] = {
+    4294967295U, 4164816772U, 4042322161U, 3926827242U, 3817748708U,
+    3714566310U, 3616814565U, 3524075730U, 3435973837U, 3352169597U,
+    3272356035U, 3196254732U, 3123612579U, 3054198966U, 2987803336U,
+    2924233053U, 2863311531U, 2804876601U, 2748779069U, 2694881441U,
+    2643056798U, 2593187801U, 2545165805U, 2498890063U, 2454267026U,
+    2411209710U, 2369637129U, 2329473788U, 2290649225U, 2253097598U,
+    2216757314U, 2181570690U,
+};
+
+static FIXMATH_CONSTEXPR const uint32_t log2_table[32] = {
+    0U,          95335645U,   187825021U,  277633165U,  364911162U,
+    449797678U,  532420281U,  612896598U,  691335320U,  767837083U,
+    842495250U,  915396590U,  986621888U,  1056246482U, 1124340739U,
+    1190970490U, 1256197405U, 1320079339U, 1382670639U, 1444022426U,
+    1504182841U, 1563197273U, 1621108567U, 1677957208U, 1733781493U,
+    1788617686U, 1842500157U, 1895461516U, 1947532725U, 1998743213U,
+    2049120974U, 2098692655U,
+};
+
+/* log2(x / 2^16) * 2^26 for x > 0, see fix16_log2_q26(). */
+FIXMATH_CONSTEXPR inline int32_t log2_q26(int32_t x)
+{
+    uint32_t m  = (uint32_t)x;
+    int32_t  lz = 0;
+    while ((m & 0x80000000U) == 0U)
+    {
+        m <<= 1;
+        ++lz;
+    }
+    uint32_t k  = (m >> 26) & 31U;
+    uint32_t s  = mulhi((m & 0x03FFFFFFU) << 6, log2_inv[k]);
+    uint32_t s2 = mulhi(s, s);
+    uint32_t s3 = mulhi(s2, s);
+    uint32_t s4 = mulhi(s3, s);
+    uint32_t l  = s - (s2 >> 6) + (mulhi(s3, 1431655765U) >> 10) - (s4 >> 17);
+    uint32_t f  = log2_table[k] + (mulhi(l, 3098164009U) >> 5);
+    return ((15 - lz) * (1 << 26) + (int32_t)((f + 16U) >> 5));
+}
+
+FIXMATH_CONSTEXPR inline int32_t log(int32_t x)
+{
+    if (x <= 0)
+        return (fix16_minimum);
+
+    // log2(x) ln(2), see fix16_log().
+    int32_t  v = log2_q26(x);
+    Wide     t = wide_mul(magnitude(v), 1488522236U);
+    if (v < 0)
+        t = wide_add(Wide{~t.hi, ~t.lo}, Wide{0U, 1U});
+#ifndef FIXMATH_NO_ROUNDING
+    return (((int32_t)t.hi + (1 << 8)) >> 9);
+#else
+    return ((int32_t)t.hi >> 9);
+#endif
+}
+
+} // namespace constant
+
+/* The kernels of Fixed<I, F, P>. The generic ones are inline templates, the
+ * Q16.16 formats whose policy matches the build forward to the C functions
+ * at run time, so that Fix16 keeps using the library's optimized paths.
+ */
+template <int F, class P> struct Ops
+{
+    static FIXMATH_CONSTEXPR int32_t add(int32_t a, int32_t b)
     {
-        value = inValue;
+        return (detail::add<P>(a, b));
     }
-    Fix16(const float inValue)
+    static FIXMATH_CONSTEXPR int32_t sub(int32_t a, int32_t b)
     {
-        value = fix16_from_float(inValue);
+        return (detail::sub<P>(a, b));
     }
-    Fix16(const double inValue)
+    static FIXMATH_CONSTEXPR int32_t mul(int32_t a, int32_t b)
     {
-        value = fix16_from_dbl(inValue);
+        return (detail::mul<F, P>(a, b));
     }
-    Fix16(const int16_t inValue)
+    static FIXMATH_CONSTEXPR int32_t div(int32_t a, int32_t b)
     {
-        value = fix16_from_int(inValue);
+        return (detail::div<F, P>(a, b));
     }
+};
+
+#ifndef FIXMATH_NO_OVERFLOW
+template <> struct Ops<16, Policy<default_rounding, Overflow::Flag>>
+{
+    typedef Policy<default_rounding, Overflow::Flag> P;
 
-    operator fix16_t() const
+    static FIXMATH_CONSTEXPR int32_t add(int32_t a, int32_t b)
     {
-        return value;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::add<P>(a, b)
+                                             : fix16_add(a, b));
     }
-    operator double() const
+    static FIXMATH_CONSTEXPR int32_t sub(int32_t a, int32_t b)
     {
-        return fix16_to_dbl(value);
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::sub<P>(a, b)
+                                             : fix16_sub(a, b));
     }
-    operator float() const
+    static FIXMATH_CONSTEXPR int32_t mul(int32_t a, int32_t b)
     {
-        return fix16_to_float(value);
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::mul<16, P>(a, b)
+                                             : fix16_mul(a, b));
     }
-    operator int16_t() const
+    static FIXMATH_CONSTEXPR int32_t div(int32_t a, int32_t b)
     {
-        return (int16_t)fix16_to_int(value);
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::div<16, P>(a, b)
+                                             : fix16_div(a, b));
     }
+};
+
+template <> struct Ops<16, Policy<default_rounding, Overflow::Saturate>>
+{
+    typedef Policy<default_rounding, Overflow::Saturate> P;
 
-    Fix16& operator=(const Fix16& rhs)
+    static FIXMATH_CONSTEXPR int32_t add(int32_t a, int32_t b)
     {
-        value = rhs.value;
-        return *this;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::add<P>(a, b)
+                                             : fix16_sadd(a, b));
     }
-    Fix16& operator=(const fix16_t rhs)
+    static FIXMATH_CONSTEXPR int32_t sub(int32_t a, int32_t b)
     {
-        value = rhs;
-        return *this;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::sub<P>(a, b)
+                                             : fix16_ssub(a, b));
     }
-    Fix16& operator=(const double rhs)
+    static FIXMATH_CONSTEXPR int32_t mul(int32_t a, int32_t b)
     {
-        value = fix16_from_dbl(rhs);
-        return *this;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::mul<16, P>(a, b)
+                                             : fix16_smul(a, b));
     }
-    Fix16& operator=(const float rhs)
+    static FIXMATH_CONSTEXPR int32_t div(int32_t a, int32_t b)
     {
-        value = fix16_from_float(rhs);
-        return *this;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::div<16, P>(a, b)
+                                             : fix16_sdiv(a, b));
     }
-    Fix16& operator=(const int16_t rhs)
+};
+#else
+template <> struct Ops<16, Policy<default_rounding, Overflow::Wrap>>
+{
+    typedef Policy<default_rounding, Overflow::Wrap> P;
+
+    static FIXMATH_CONSTEXPR int32_t add(int32_t a, int32_t b)
     {
-        value = fix16_from_int(rhs);
-        return *this;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::add<P>(a, b)
+                                             : fix16_add(a, b));
     }
-
-#if defined(FIXMATH_SATURATING_ARITHMETIC) && !defined(FIXMATH_NO_OVERFLOW)
-    Fix16& operator+=(const Fix16& rhs)
+    static FIXMATH_CONSTEXPR int32_t sub(int32_t a, int32_t b)
     {
-        value = fix16_sadd(value, rhs.value);
-        return *this;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::sub<P>(a, b)
+                                             : fix16_sub(a, b));
     }
-    Fix16& operator+=(const fix16_t rhs)
+    static FIXMATH_CONSTEXPR int32_t mul(int32_t a, int32_t b)
     {
-        value = fix16_sadd(value, rhs);
-        return *this;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::mul<16, P>(a, b)
+                                             : fix16_mul(a, b));
     }
-    Fix16& operator+=(const double rhs)
+    static FIXMATH_CONSTEXPR int32_t div(int32_t a, int32_t b)
     {
-        value = fix16_sadd(value, fix16_from_dbl(rhs));
-        return *this;
+        return (FIXMATH_CONSTANT_EVALUATED() ? detail::div<16, P>(a, b)
+                                             : fix16_div(a, b));
+    }
+};
+#endif
+
+} // namespace detail
+
+/* A signed 32 bit fixed point number with I integer bits, including the
+ * sign, and F fraction bits. Multiplication, division and the conversions
+ * between formats are resolved at compile time for the format and the
+ * policy, so Q8.24 and Q24.8 get their own kernels without runtime
+ * branches. Fix16 is Fixed<16, 16>.
+ *
+ * Conversions from int16_t, like fix16_from_int, do not check for overflow.
+ * The members sin() to log() call the fix16_t functions, or their versions
+ * in detail::constant during constant evaluation, and are only available
+ * for Q16.16.
+ */
+template <int I, int F, class P = DefaultPolicy> class Fixed
+{
+    static_assert(I + F == 32, "Fixed<I, F> needs I + F == 32");
+    static_assert(F > 0 && F < 32, "Fixed<I, F> needs 0 < F < 32");
+
+    typedef detail::Ops<F, P>                                      ops;
+    typedef detail::Ops<F, Policy<P::rounding, Overflow::Saturate>> sops;
+
+    static FIXMATH_CONSTEXPR int32_t from_int(int16_t inValue)
+    {
+        return ((int32_t)((uint32_t)(int32_t)inValue << F));
     }
-    Fix16& operator+=(const float rhs)
+    static FIXMATH_CONSTEXPR int32_t from_dbl(double inValue)
     {
-        value = fix16_sadd(value, fix16_from_float(rhs));
-        return *this;
+        double temp = inValue * (double)(1ULL << F);
+#ifndef FIXMATH_NO_ROUNDING
+        temp += (temp >= 0) ? 0.5 : -0.5;
+#endif
+        return ((int32_t)temp);
     }
-    Fix16& operator+=(const int16_t rhs)
+    static FIXMATH_CONSTEXPR int32_t from_float(float inValue)
     {
-        value = fix16_sadd(value, fix16_from_int(rhs));
-        return *this;
+        float temp = inValue * (float)(1ULL << F);
+#ifndef FIXMATH_NO_ROUNDING
+        temp += (temp >= 0) ? 0.5f : -0.5f;
+#endif
+        return ((int32_t)temp);
     }
 
-    Fix16& operator-=(const Fix16& rhs)
+  public:
+    typedef P policy;
+
+    static const int int_bits  = I;
+    static const int frac_bits = F;
+
+    int32_t          value;
+
+    constexpr Fixed() : value(0)
     {
-        value = fix16_ssub(value, rhs.value);
-        return *this;
     }
-    Fix16& operator-=(const fix16_t rhs)
+    constexpr Fixed(const Fixed& inValue) : value(inValue.value)
     {
-        value = fix16_ssub(value, rhs);
-        return *this;
     }
-    Fix16& operator-=(const double rhs)
+    constexpr Fixed(const int32_t inValue) : value(inValue)
     {
-        value = fix16_ssub(value, fix16_from_dbl(rhs));
-        return *this;
     }
-    Fix16& operator-=(const float rhs)
+    FIXMATH_CONSTEXPR Fixed(const float inValue) : value(from_float(inValue))
     {
-        value = fix16_ssub(value, fix16_from_float(rhs));
-        return *this;
     }
-    Fix16& operator-=(const int16_t rhs)
+    FIXMATH_CONSTEXPR Fixed(const double inValue) : value(from_dbl(inValue))
+    {
+    }
+    FIXMATH_CONSTEXPR Fixed(const int16_t inValue) : value(from_int(inValue))
     {
-        value = fix16_ssub(value, fix16_from_int(rhs));
-        return *this;
     }
 
-    Fix16& operator*=(const Fix16& rhs)
+    /* Conversion from another format, rounded and checked by this policy. */
+    template <int I2, int F2, class P2>
+    FIXMATH_CONSTEXPR explicit Fixed(const Fixed<I2, F2, P2>& inValue)
+        : value(detail::rescale<F - F2, P>(inValue.value))
     {
-        value = fix16_smul(value, rhs.value);
-        return *this;
     }
-    Fix16& operator*=(const fix16_t rhs)
+
+    FIXMATH_CONSTEXPR operator int32_t() const
     {
-        value = fix16_smul(value, rhs);
-        return *this;
+        return value;
     }
-    Fix16& operator*=(const double rhs)
+    FIXMATH_CONSTEXPR operator double() const
     {
-        value = fix16_smul(value, fix16_from_dbl(rhs));
-        return *this;
+        return ((double)value / (double)(1ULL << F));
     }
-    Fix16& operator*=(const float rhs)
+    FIXMATH_CONSTEXPR operator float() const
     {
-        value = fix16_smul(value, fix16_from_float(rhs));
-        return *this;
+        return ((float)value / (float)(1ULL << F));
     }
-    Fix16& operator*=(const int16_t rhs)
+    FIXMATH_CONSTEXPR operator int16_t() const
     {
-        value *= rhs;
-        return *this;
+#ifdef FIXMATH_NO_ROUNDING
+        return (int16_t)(value >> F);
+#else
+        // Divide by 2^F in two steps, 2^31 does not fit an int32_t.
+        const int32_t half = (int32_t)(1U << (F - 1));
+        if (value >= 0)
+            return (int16_t)((value + half) / half / 2);
+        return (int16_t)((value - half) / half / 2);
+#endif
     }
 
-    Fix16& operator/=(const Fix16& rhs)
+    FIXMATH_CONSTEXPR Fixed& operator=(const Fixed& rhs)
     {
-        value = fix16_sdiv(value, rhs.value);
+        value = rhs.value;
         return *this;
     }
-    Fix16& operator/=(const fix16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator=(const int32_t rhs)
     {
-        value = fix16_sdiv(value, rhs);
+        value = rhs;
         return *this;
     }
-    Fix16& operator/=(const double rhs)
+    FIXMATH_CONSTEXPR Fixed& operator=(const double rhs)
     {
-        value = fix16_sdiv(value, fix16_from_dbl(rhs));
+        value = from_dbl(rhs);
         return *this;
     }
-    Fix16& operator/=(const float rhs)
+    FIXMATH_CONSTEXPR Fixed& operator=(const float rhs)
     {
-        value = fix16_sdiv(value, fix16_from_float(rhs));
+        value = from_float(rhs);
         return *this;
     }
-    Fix16& operator/=(const int16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator=(const int16_t rhs)
     {
-        value /= rhs;
+        value = from_int(rhs);
         return *this;
     }
-#else
-    Fix16& operator+=(const Fix16& rhs)
+
+    FIXMATH_CONSTEXPR Fixed& operator+=(const Fixed& rhs)
     {
-        value += rhs.value;
+        value = ops::add(value, rhs.value);
         return *this;
     }
-    Fix16& operator+=(const fix16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator+=(const int32_t rhs)
     {
-        value += rhs;
+        value = ops::add(value, rhs);
         return *this;
     }
-    Fix16& operator+=(const double rhs)
+    FIXMATH_CONSTEXPR Fixed& operator+=(const double rhs)
     {
-        value += fix16_from_dbl(rhs);
+        value = ops::add(value, from_dbl(rhs));
         return *this;
     }
-    Fix16& operator+=(const float rhs)
+    FIXMATH_CONSTEXPR Fixed& operator+=(const float rhs)
     {
-        value += fix16_from_float(rhs);
+        value = ops::add(value, from_float(rhs));
         return *this;
     }
-    Fix16& operator+=(const int16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator+=(const int16_t rhs)
     {
-        value += fix16_from_int(rhs);
+        value = ops::add(value, from_int(rhs));
         return *this;
     }
 
-    Fix16& operator-=(const Fix16& rhs)
+    FIXMATH_CONSTEXPR Fixed& operator-=(const Fixed& rhs)
     {
-        value -= rhs.value;
+        value = ops::sub(value, rhs.value);
         return *this;
     }
-    Fix16& operator-=(const fix16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator-=(const int32_t rhs)
     {
-        value -= rhs;
+        value = ops::sub(value, rhs);
         return *this;
     }
-    Fix16& operator-=(const double rhs)
+    FIXMATH_CONSTEXPR Fixed& operator-=(const double rhs)
     {
-        value -= fix16_from_dbl(rhs);
+        value = ops::sub(value, from_dbl(rhs));
         return *this;
     }
-    Fix16& operator-=(const float rhs)
+    FIXMATH_CONSTEXPR Fixed& operator-=(const float rhs)
     {
-        value -= fix16_from_float(rhs);
+        value = ops::sub(value, from_float(rhs));
         return *this;
     }
-    Fix16& operator-=(const int16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator-=(const int16_t rhs)
     {
-        value -= fix16_from_int(rhs);
+        value = ops::sub(value, from_int(rhs));
         return *this;
     }
 
-    Fix16& operator*=(const Fix16& rhs)
+    FIXMATH_CONSTEXPR Fixed& operator*=(const Fixed& rhs)
     {
-        value = fix16_mul(value, rhs.value);
+        value = ops::mul(value, rhs.value);
         return *this;
     }
-    Fix16& operator*=(const fix16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator*=(const int32_t rhs)
     {
-        value = fix16_mul(value, rhs);
+        value = ops::mul(value, rhs);
         return *this;
     }
-    Fix16& operator*=(const double rhs)
+    FIXMATH_CONSTEXPR Fixed& operator*=(const double rhs)
     {
-        value = fix16_mul(value, fix16_from_dbl(rhs));
+        value = ops::mul(value, from_dbl(rhs));
         return *this;
     }
-    Fix16& operator*=(const float rhs)
+    FIXMATH_CONSTEXPR Fixed& operator*=(const float rhs)
     {
-        value = fix16_mul(value, fix16_from_float(rhs));
+        value = ops::mul(value, from_float(rhs));
         return *this;
     }
-    Fix16& operator*=(const int16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator*=(const int16_t rhs)
     {
         value *= rhs;
         return *this;
     }
 
-    Fix16& operator/=(const Fix16& rhs)
+    FIXMATH_CONSTEXPR Fixed& operator/=(const Fixed& rhs)
     {
-        value = fix16_div(value, rhs.value);
+        value = ops::div(value, rhs.value);
         return *this;
     }
-    Fix16& operator/=(const fix16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator/=(const int32_t rhs)
     {
-        value = fix16_div(value, rhs);
+        value = ops::div(value, rhs);
         return *this;
     }
-    Fix16& operator/=(const double rhs)
+    FIXMATH_CONSTEXPR Fixed& operator/=(const double rhs)
     {
-        value = fix16_div(value, fix16_from_dbl(rhs));
+        value = ops::div(value, from_dbl(rhs));
         return *this;
     }
-    Fix16& operator/=(const float rhs)
+    FIXMATH_CONSTEXPR Fixed& operator/=(const float rhs)
     {
-        value = fix16_div(value, fix16_from_float(rhs));
+        value = ops::div(value, from_float(rhs));
         return *this;
     }
-    Fix16& operator/=(const int16_t rhs)
+    FIXMATH_CONSTEXPR Fixed& operator/=(const int16_t rhs)
     {
         value /= rhs;
         return *this;
     }
-#endif
 
-    const Fix16 operator+(const Fix16& other) const
+    FIXMATH_CONSTEXPR const Fixed operator+(const Fixed& other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret += other;
         return ret;
     }
-    const Fix16 operator+(const fix16_t other) const
+    FIXMATH_CONSTEXPR const Fixed operator+(const int32_t other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret += other;
         return ret;
     }
-    const Fix16 operator+(const double other) const
+    FIXMATH_CONSTEXPR const Fixed operator+(const double other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret += other;
         return ret;
     }
-    const Fix16 operator+(const float other) const
+    FIXMATH_CONSTEXPR const Fixed operator+(const float other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret += other;
         return ret;
     }
-    const Fix16 operator+(const int16_t other) const
+    FIXMATH_CONSTEXPR const Fixed operator+(const int16_t other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret += other;
         return ret;
     }
 
-#ifndef FIXMATH_NO_OVERFLOW
-    const Fix16 sadd(const Fix16& other) const
+    FIXMATH_CONSTEXPR const Fixed sadd(const Fixed& other) const
     {
-        Fix16 ret = fix16_sadd(value, other.value);
-        return ret;
+        return Fixed(sops::add(value, other.value));
     }
-    const Fix16 sadd(const fix16_t other) const
+    FIXMATH_CONSTEXPR const Fixed sadd(const int32_t other) const
     {
-        Fix16 ret = fix16_sadd(value, other);
-        return ret;
+        return Fixed(sops::add(value, other));
     }
-    const Fix16 sadd(const double other) const
+    FIXMATH_CONSTEXPR const Fixed sadd(const double other) const
     {
-        Fix16 ret = fix16_sadd(value, fix16_from_dbl(other));
-        return ret;
+        return Fixed(sops::add(value, from_dbl(other)));
     }
-    const Fix16 sadd(const float other) const
+    FIXMATH_CONSTEXPR const Fixed sadd(const float other) const
     {
-        Fix16 ret = fix16_sadd(value, fix16_from_float(other));
-        return ret;
+        return Fixed(sops::add(value, from_float(other)));
     }
-    const Fix16 sadd(const int16_t other) const
+    FIXMATH_CONSTEXPR const Fixed sadd(const int16_t other) const
     {
-        Fix16 ret = fix16_sadd(value, fix16_from_int(other));
-        return ret;
+        return Fixed(sops::add(value, from_int(other)));
     }
-#endif
 
-    const Fix16 operator-(const Fix16& other) const
+    FIXMATH_CONSTEXPR const Fixed operator-(const Fixed& other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret -= other;
         return ret;
     }
-    const Fix16 operator-(const fix16_t other) const
+    FIXMATH_CONSTEXPR const Fixed operator-(const int32_t other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret -= other;
         return ret;
     }
-    const Fix16 operator-(const double other) const
+    FIXMATH_CONSTEXPR const Fixed operator-(const double other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret -= other;
         return ret;
     }
-    const Fix16 operator-(const float other) const
+    FIXMATH_CONSTEXPR const Fixed operator-(const float other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret -= other;
         return ret;
     }
-    const Fix16 operator-(const int16_t other) const
+    FIXMATH_CONSTEXPR const Fixed operator-(const int16_t other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret -= other;
         return ret;
     }
-    const Fix16 operator-() const
+    FIXMATH_CONSTEXPR const Fixed operator-() const
     {
-        return -value;
+        return Fixed(-value);
     }
 
-#ifndef FIXMATH_NO_OVERFLOW
-    const Fix16 ssub(const Fix16& other) const
+    FIXMATH_CONSTEXPR const Fixed ssub(const Fixed& other) const
     {
-        Fix16 ret = fix16_sadd(value, -other.value);
-        return ret;
+        return Fixed(sops::sub(value, other.value));
     }
-    const Fix16 ssub(const fix16_t other) const
+    FIXMATH_CONSTEXPR const Fixed ssub(const int32_t other) const
     {
-        Fix16 ret = fix16_sadd(value, -other);
-        return ret;
+        return Fixed(sops::sub(value, other));
     }
-    const Fix16 ssub(const double other) const
+    FIXMATH_CONSTEXPR const Fixed ssub(const double other) const
     {
-        Fix16 ret = fix16_sadd(value, -fix16_from_dbl(other));
-        return ret;
+        return Fixed(sops::sub(value, from_dbl(other)));
     }
-    const Fix16 ssub(const float other) const
+    FIXMATH_CONSTEXPR const Fixed ssub(const float other) const
     {
-        Fix16 ret = fix16_sadd(value, -fix16_from_float(other));
-        return ret;
+        return Fixed(sops::sub(value, from_float(other)));
     }
-    const Fix16 ssub(const int16_t other) const
+    FIXMATH_CONSTEXPR const Fixed ssub(const int16_t other) const
     {
-        Fix16 ret = fix16_sadd(value, -fix16_from_int(other));
-        return ret;
+        return Fixed(sops::sub(value, from_int(other)));
     }
-#endif
 
-    const Fix16 operator*(const Fix16& other) const
+    FIXMATH_CONSTEXPR const Fixed operator*(const Fixed& other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret *= other;
         return ret;
     }
-    const Fix16 operator*(const fix16_t other) const
+    FIXMATH_CONSTEXPR const Fixed operator*(const int32_t other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret *= other;
         return ret;
     }
-    const Fix16 operator*(const double other) const
+    FIXMATH_CONSTEXPR const Fixed operator*(const double other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret *= other;
         return ret;
     }
-    const Fix16 operator*(const float other) const
+    FIXMATH_CONSTEXPR const Fixed operator*(const float other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret *= other;
         return ret;
     }
-    const Fix16 operator*(const int16_t other) const
+    FIXMATH_CONSTEXPR const Fixed operator*(const int16_t other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret *= other;
         return ret;
     }
 
-#ifndef FIXMATH_NO_OVERFLOW
-    const Fix16 smul(const Fix16& other) const
+    FIXMATH_CONSTEXPR const Fixed smul(const Fixed& other) const
     {
-        Fix16 ret = fix16_smul(value, other.value);
-        return ret;
+        return Fixed(sops::mul(value, other.value));
     }
-    const Fix16 smul(const fix16_t other) const
+    FIXMATH_CONSTEXPR const Fixed smul(const int32_t other) const
     {
-        Fix16 ret = fix16_smul(value, other);
-        return ret;
+        return Fixed(sops::mul(value, other));
     }
-    const Fix16 smul(const double other) const
+    FIXMATH_CONSTEXPR const Fixed smul(const double other) const
     {
-        Fix16 ret = fix16_smul(value, fix16_from_dbl(other));
-        return ret;
+        return Fixed(sops::mul(value, from_dbl(other)));
     }
-    const Fix16 smul(const float other) const
+    FIXMATH_CONSTEXPR const Fixed smul(const float other) const
     {
-        Fix16 ret = fix16_smul(value, fix16_from_float(other));
-        return ret;
+        return Fixed(sops::mul(value, from_float(other)));
     }
-    const Fix16 smul(const int16_t other) const
+    FIXMATH_CONSTEXPR const Fixed smul(const int16_t other) const
     {
-        Fix16 ret = fix16_smul(value, fix16_from_int(other));
-        return ret;
+        return Fixed(sops::mul(value, from_int(other)));
     }
-#endif
 
-    const Fix16 operator/(const Fix16& other) const
+    FIXMATH_CONSTEXPR const Fixed operator/(const Fixed& other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret /= other;
         return ret;
     }
-    const Fix16 operator/(const fix16_t other) const
+    FIXMATH_CONSTEXPR const Fixed operator/(const int32_t other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret /= other;
         return ret;
     }
-    const Fix16 operator/(const double other) const
+    FIXMATH_CONSTEXPR const Fixed operator/(const double other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret /= other;
         return ret;
     }
-    const Fix16 operator/(const float other) const
+    FIXMATH_CONSTEXPR const Fixed operator/(const float other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret /= other;
         return ret;
     }
-    const Fix16 operator/(const int16_t other) const
+    FIXMATH_CONSTEXPR const Fixed operator/(const int16_t other) const
     {
-        Fix16 ret = *this;
+        Fixed ret = *this;
         ret /= other;
         return ret;
     }
 
-#ifndef FIXMATH_NO_OVERFLOW
-    const Fix16 sdiv(const Fix16& other) const
+    FIXMATH_CONSTEXPR const Fixed sdiv(const Fixed& other) const
     {
-        Fix16 ret = fix16_sdiv(value, other.value);
-        return ret;
+        return Fixed(sops::div(value, other.value));
     }
-    const Fix16 sdiv(const fix16_t other) const
+    FIXMATH_CONSTEXPR const Fixed sdiv(const int32_t other) const
     {
-        Fix16 ret = fix16_sdiv(value, other);
-        return ret;
+        return Fixed(sops::div(value, other));
     }
-    const Fix16 sdiv(const double other) const
+    FIXMATH_CONSTEXPR const Fixed sdiv(const double other) const
     {
-        Fix16 ret = fix16_sdiv(value, fix16_from_dbl(other));
-        return ret;
+        return Fixed(sops::div(value, from_dbl(other)));
     }
-    const Fix16 sdiv(const float other) const
+    FIXMATH_CONSTEXPR const Fixed sdiv(const float other) const
     {
-        Fix16 ret = fix16_sdiv(value, fix16_from_float(other));
-        return ret;
+        return Fixed(sops::div(value, from_float(other)));
     }
-    const Fix16 sdiv(const int16_t other) const
+    FIXMATH_CONSTEXPR const Fixed sdiv(const int16_t other) const
     {
-        Fix16 ret = fix16_sdiv(value, fix16_from_int(other));
-        return ret;
+        return Fixed(sops::div(value, from_int(other)));
     }
-#endif
 
-    int operator==(const Fix16& other) const
+    FIXMATH_CONSTEXPR int operator==(const Fixed& other) const
     {
         return (value == other.value);
     }
-    int operator==(const fix16_t other) const
+    FIXMATH_CONSTEXPR int operator==(const int32_t other) const
     {
         return (value == other);
     }
-    int operator==(const double other) const
+    FIXMATH_CONSTEXPR int operator==(const double other) const
     {
-        return (value == fix16_from_dbl(other));
+        return (value == from_dbl(other));
     }
-    int operator==(const float other) const
+    FIXMATH_CONSTEXPR int operator==(const float other) const
     {
-        return (value == fix16_from_float(other));
+        return (value == from_float(other));
     }
-    int operator==(const int16_t other) const
+    FIXMATH_CONSTEXPR int operator==(const int16_t other) const
     {
-        return (value == fix16_from_int(other));
+        return (value == from_int(other));
     }
 
-    int operator!=(const Fix16& other) const
+    FIXMATH_CONSTEXPR int operator!=(const Fixed& other) const
     {
         return (value != other.value);
     }
-    int operator!=(const fix16_t other) const
+    FIXMATH_CONSTEXPR int operator!=(const int32_t other) const
     {
         return (value != other);
     }
-    int operator!=(const double other) const
+    FIXMATH_CONSTEXPR int operator!=(const double other) const
     {
-        return (value != fix16_from_dbl(other));
+        return (value != from_dbl(other));
     }
-    int operator!=(const float other) const
+    FIXMATH_CONSTEXPR int operator!=(const float other) const
     {
-        return (value != fix16_from_float(other));
+        return (value != from_float(other));
     }
-    int operator!=(const int16_t other) const
+    FIXMATH_CONSTEXPR int operator!=(const int16_t other) const
     {
-        return (value != fix16_from_int(other));
+        return (value != from_int(other));
     }
 
-    int operator<=(const Fix16& other) const
+    FIXMATH_CONSTEXPR int operator<=(const Fixed& other) const
     {
         return (value <= other.value);
     }
-    int operator<=(const fix16_t other) const
+    FIXMATH_CONSTEXPR int operator<=(const int32_t other) const
     {
         return (value <= other);
     }
-    int operator<=(const double other) const
+    FIXMATH_CONSTEXPR int operator<=(const double other) const
     {
-        return (value <= fix16_from_dbl(other));
+        return (value <= from_dbl(other));
     }
-    int operator<=(const float other) const
+    FIXMATH_CONSTEXPR int operator<=(const float other) const
     {
-        return (value <= fix16_from_float(other));
+        return (value <= from_float(other));
     }
-    int operator<=(const int16_t other) const
+    FIXMATH_CONSTEXPR int operator<=(const int16_t other) const
     {
-        return (value <= fix16_from_int(other));
+        return (value <= from_int(other));
     }
 
-    int operator>=(const Fix16& other) const
+    FIXMATH_CONSTEXPR int operator>=(const Fixed& other) const
     {
         return (value >= other.value);
     }
-    int operator>=(const fix16_t other) const
+    FIXMATH_CONSTEXPR int operator>=(const int32_t other) const
     {
         return (value >= other);
     }
-    int operator>=(const double other) const
+    FIXMATH_CONSTEXPR int operator>=(const double other) const
     {
-        return (value >= fix16_from_dbl(other));
+        return (value >= from_dbl(other));
     }
-    int operator>=(const float other) const
+    FIXMATH_CONSTEXPR int operator>=(const float other) const
     {
-        return (value >= fix16_from_float(other));
+        return (value >= from_float(other));
     }
-    int operator>=(const int16_t other) const
+    FIXMATH_CONSTEXPR int operator>=(const int16_t other) const
     {
-        return (value >= fix16_from_int(other));
+        return (value >= from_int(other));
     }
 
-    int operator<(const Fix16& other) const
+    FIXMATH_CONSTEXPR int operator<(const Fixed& other) const
     {
         return (value < other.value);
     }
-    int operator<(const fix16_t other) const
+    FIXMATH_CONSTEXPR int operator<(const int32_t other) const
     {
         return (value < other);
     }
-    int operator<(const double other) const
+    FIXMATH_CONSTEXPR int operator<(const double other) const
     {
-        return (value < fix16_from_dbl(other));
+        return (value < from_dbl(other));
     }
-    int operator<(const float other) const
+    FIXMATH_CONSTEXPR int operator<(const float other) const
     {
-        return (value < fix16_from_float(other));
+        return (value < from_float(other));
     }
-    int operator<(const int16_t other) const
+    FIXMATH_CONSTEXPR int operator<(const int16_t other) const
     {
-        return (value < fix16_from_int(other));
+        return (value < from_int(other));
     }
 
-    int operator>(const Fix16& other) const
+    FIXMATH_CONSTEXPR int operator>(const Fixed& other) const
     {
         return (value > other.value);
     }
-    int operator>(const fix16_t other) const
+    FIXMATH_CONSTEXPR int operator>(const int32_t other) const
     {
         return (value > other);
     }
-    int operator>(const double other) const
+    FIXMATH_CONSTEXPR int operator>(const double other) const
     {
-        return (value > fix16_from_dbl(other));
+        return (value > from_dbl(other));
     }
-    int operator>(const float other) const
+    FIXMATH_CONSTEXPR int operator>(const float other) const
     {
-        return (value > fix16_from_float(other));
+        return (value > from_float(other));
     }
-    int operator>(const int16_t other) const
+    FIXMATH_CONSTEXPR int operator>(const int16_t other) const
     {
-        return (value > fix16_from_int(other));
+        return (value > from_int(other));
     }
 
-    Fix16 sin() const
+    FIXMATH_CONSTEXPR Fixed sin() const
+    {
+        static_assert(F == 16, "only Q16.16 has sin()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::sin(value)
+                         : fix16_sin(value));
+    }
+    FIXMATH_CONSTEXPR Fixed cos() const
+    {
+        static_assert(F == 16, "only Q16.16 has cos()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::cos(value)
+                         : fix16_cos(value));
+    }
+    FIXMATH_CONSTEXPR Fixed tan() const
     {
-        return Fix16(fix16_sin(value));
+        static_assert(F == 16, "only Q16.16 has tan()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::tan(value)
+                         : fix16_tan(value));
     }
-    Fix16 cos() const
+    FIXMATH_CONSTEXPR Fixed asin() const
     {
-        return Fix16(fix16_cos(value));
+        static_assert(F == 16, "only Q16.16 has asin()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::asin(value)
+                         : fix16_asin(value));
     }
-    Fix16 tan() const
+    FIXMATH_CONSTEXPR Fixed acos() const
     {
-        return Fix16(fix16_tan(value));
+        static_assert(F == 16, "only Q16.16 has acos()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::acos(value)
+                         : fix16_acos(value));
     }
-    Fix16 asin() const
+    FIXMATH_CONSTEXPR Fixed atan() const
     {
-        return Fix16(fix16_asin(value));
+        static_assert(F == 16, "only Q16.16 has atan()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::atan(value)
+                         : fix16_atan(value));
     }
-    Fix16 acos() const
+    FIXMATH_CONSTEXPR Fixed atan2(const Fixed& inY) const
     {
-        return Fix16(fix16_acos(value));
+        static_assert(F == 16, "only Q16.16 has atan2()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::atan2(value, inY.value)
+                         : fix16_atan2(value, inY.value));
     }
-    Fix16 atan() const
+    FIXMATH_CONSTEXPR Fixed sqrt() const
     {
-        return Fix16(fix16_atan(value));
+        static_assert(F == 16, "only Q16.16 has sqrt()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::sqrt(value)
+                         : fix16_sqrt(value));
     }
-    Fix16 atan2(const Fix16& inY) const
+    FIXMATH_CONSTEXPR Fixed exp() const
     {
-        return Fix16(fix16_atan2(value, inY.value));
+        static_assert(F == 16, "only Q16.16 has exp()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::exp(value)
+                         : fix16_exp(value));
     }
-    Fix16 sqrt() const
+    FIXMATH_CONSTEXPR Fixed log() const
     {
-        return Fix16(fix16_sqrt(value));
+        static_assert(F == 16, "only Q16.16 has log()");
+        return Fixed(FIXMATH_CONSTANT_EVALUATED()
+                         ? detail::constant::log(value)
+                         : fix16_log(value));
     }
 };
 
+/* Multiplies numbers of two formats into the format R with one rounding.
+ * The shift of the 64 bit product is Fa + Fb - R::frac_bits.
+ */
+template <class R, int Ia, int Fa, class Pa, int Ib, int Fb, class Pb>
+FIXMATH_CONSTEXPR inline R mul(const Fixed<Ia, Fa, Pa>& a,
+                                const Fixed<Ib, Fb, Pb>& b)
+{
+    return R(detail::mul<Fa + Fb - R::frac_bits, typename R::policy>(a.value,
+                                                                     b.value));
+}
+
+/* Divides numbers of two formats into the format R, shifting the dividend
+ * up by R::frac_bits + Fb - Fa bits, which must be in [0, 32].
+ */
+template <class R, int Ia, int Fa, class Pa, int Ib, int Fb, class Pb>
+FIXMATH_CONSTEXPR inline R div(const Fixed<Ia, Fa, Pa>& a,
+                                const Fixed<Ib, Fb, Pb>& b)
+{
+    return R(detail::div<R::frac_bits + Fb - Fa, typename R::policy>(a.value,
+                                                                     b.value));
+}
+
+/* Opt-in expression templates for sums and products of Fixed values.
+ * Wrapping an operand in expr::lazy() makes the arithmetic on it build a
+ * tree instead of a value. The tree is evaluated exactly in a 64 bit
+ * accumulator and rounded and saturated once, when it is converted to a
+ * Fixed or passed to expr::eval(). With Fix16 a, b, c and d,
+ *
+ *     Fix16 r = expr::lazy(a) * b + expr::lazy(c) * d;
+ *
+ * rounds a * b + c * d once instead of three times, without the overflow
+ * checks in between. One operand of every product has to be an expression
+ * already, otherwise it is a Fix16 product with its own rounding.
+ *
+ * The accumulator keeps all fraction bits, so a product of two Q16.16
+ * values has 32. Intermediate values are not checked, they have to fit in
+ * the 64 bits, which holds for example for sums of Q16.16 products as long
+ * as every partial sum is below 2^31. The result is rounded as the policy
+ * of its format says and always saturates.
+ */
+namespace expr
+{
+
+/* int64_t is the emulated struct with FIXMATH_NO_64BIT, long long is always
+ * available in C++.
+ */
+typedef long long          Acc;
+typedef unsigned long long UAcc;
+
+template <class E> struct Node;
+
+/* Rounds the value of e to the format R and saturates it. */
+template <class R = Fixed<16, 16>, class E>
+FIXMATH_CONSTEXPR inline R eval(const Node<E>& e)
+{
+    typedef Policy<R::policy::rounding, Overflow::Saturate> P;
+    const int S = E::frac_bits - R::frac_bits;
+
+    Acc  x        = e.self().value();
+    bool negative = (x < 0);
+    UAcc m        = negative ? 0ULL - (UAcc)x : (UAcc)x;
+    if (S < 0)
+    {
+        if (m > ((UAcc)0x7FFFFFFFU + negative) >> (S < 0 ? -S : 0))
+            return (R(negative ? fix16_minimum : fix16_maximum));
+        m <<= (S < 0 ? -S : 0);
+    }
+    return (R(detail::narrow<(S > 0 ? S : 0), P>(
+        negative, detail::Wide{(uint32_t)(m >> 32U), (uint32_t)m})));
+}
+
+/* Base of the nodes of an expression tree. Each node E has the number of
+ * fraction bits of its value as E::frac_bits, and E::value() returns the
+ * exact value, wrapped to 64 bits.
+ */
+template <class E> struct Node
+{
+    FIXMATH_CONSTEXPR const E& self() const
+    {
+        return (static_cast<const E&>(*this));
+    }
+
+    template <int I, int F, class P>
+    FIXMATH_CONSTEXPR operator Fixed<I, F, P>() const
+    {
+        return (eval<Fixed<I, F, P>>(*this));
+    }
+};
+
+/* Shifts x left by S bits. */
+template <int S> FIXMATH_CONSTEXPR inline Acc align(Acc x)
+{
+    return ((Acc)((UAcc)x << S));
+}
+
+template <int F> struct Value : Node<Value<F>>
+{
+    static const int frac_bits = F;
+    int32_t          v;
+
+    FIXMATH_CONSTEXPR explicit Value(int32_t inValue) : v(inValue)
+    {
+    }
+    FIXMATH_CONSTEXPR Acc value() const
+    {
+        return (v);
+    }
+};
+
+template <class A> struct Negate : Node<Negate<A>>
+{
+    static const int frac_bits = A::frac_bits;
+    A                a;
+
+    FIXMATH_CONSTEXPR explicit Negate(const A& inA) : a(inA)
+    {
+    }
+    FIXMATH_CONSTEXPR Acc value() const
+    {
+        return ((Acc)(0ULL - (UAcc)a.value()));
+    }
+};
+
+template <class A, class B> struct Sum : Node<Sum<A, B>>
+{
+    static const int frac_bits =
+        (A::frac_bits > B::frac_bits) ? A::frac_bits : B::frac_bits;
+    A a;
+    B b;
+
+    FIXMATH_CONSTEXPR Sum(const A& inA, const B& inB) : a(inA), b(inB)
+    {
+    }
+    FIXMATH_CONSTEXPR Acc value() const
+    {
+        return ((Acc)((UAcc)align<frac_bits - A::frac_bits>(a.value()) +
+                      (UAcc)align<frac_bits - B::frac_bits>(b.value())));
+    }
+};
+
+template <class A, class B> struct Difference : Node<Difference<A, B>>
+{
+    static const int frac_bits =
+        (A::frac_bits > B::frac_bits) ? A::frac_bits : B::frac_bits;
+    A a;
+    B b;
+
+    FIXMATH_CONSTEXPR Difference(const A& inA, const B& inB) : a(inA), b(inB)
+    {
+    }
+    FIXMATH_CONSTEXPR Acc value() const
+    {
+        return ((Acc)((UAcc)align<frac_bits - A::frac_bits>(a.value()) -
+                      (UAcc)align<frac_bits - B::frac_bits>(b.value())));
+    }
+};
+
+template <class A, class B> struct Product : Node<Product<A, B>>
+{
+    static const int frac_bits = A::frac_bits + B::frac_bits;
+    static_assert(frac_bits < 63, "too many fraction bits for 64 bits");
+    A a;
+    B b;
+
+    FIXMATH_CONSTEXPR Product(const A& inA, const B& inB) : a(inA), b(inB)
+    {
+    }
+    FIXMATH_CONSTEXPR Acc value() const
+    {
+        return ((Acc)((UAcc)a.value() * (UAcc)b.value()));
+    }
+};
+
+/* Starts an expression from a Fixed value. */
+template <int I, int F, class P>
+FIXMATH_CONSTEXPR inline Value<F> lazy(const Fixed<I, F, P>& x)
+{
+    return (Value<F>(x.value));
+}
+
+template <class A>
+FIXMATH_CONSTEXPR inline Negate<A> operator-(const Node<A>& a)
+{
+    return (Negate<A>(a.self()));
+}
+
+template <class A, class B>
+FIXMATH_CONSTEXPR inline Sum<A, B> operator+(const Node<A>& a,
+                                             const Node<B>& b)
+{
+    return (Sum<A, B>(a.self(), b.self()));
+}
+template <class A, int I, int F, class P>
+FIXMATH_CONSTEXPR inline Sum<A, Value<F>> operator+(const Node<A>&         a,
+                                                    const Fixed<I, F, P>& b)
+{
+    return (Sum<A, Value<F>>(a.self(), lazy(b)));
+}
+template <int I, int F, class P, class B>
+FIXMATH_CONSTEXPR inline Sum<Value<F>, B> operator+(const Fixed<I, F, P>& a,
+                                                    const Node<B>&         b)
+{
+    return (Sum<Value<F>, B>(lazy(a), b.self()));
+}
+
+template <class A, class B>
+FIXMATH_CONSTEXPR inline Difference<A, B> operator-(const Node<A>& a,
+                                                    const Node<B>& b)
+{
+    return (Difference<A, B>(a.self(), b.self()));
+}
+template <class A, int I, int F, class P>
+FIXMATH_CONSTEXPR inline Difference<A, Value<F>>
+operator-(const Node<A>& a, const Fixed<I, F, P>& b)
+{
+    return (Difference<A, Value<F>>(a.self(), lazy(b)));
+}
+template <int I, int F, class P, class B>
+FIXMATH_CONSTEXPR inline Difference<Value<F>, B>
+operator-(const Fixed<I, F, P>& a, const Node<B>& b)
+{
+    return (Difference<Value<F>, B>(lazy(a), b.self()));
+}
+
+template <class A, class B>
+FIXMATH_CONSTEXPR inline Product<A, B> operator*(const Node<A>& a,
+                                                 const Node<B>& b)
+{
+    return (Product<A, B>(a.self(), b.self()));
+}
+template <class A, int I, int F, class P>
+FIXMATH_CONSTEXPR inline Product<A, Value<F>>
+operator*(const Node<A>& a, const Fixed<I, F, P>& b)
+{
+    return (Product<A, Value<F>>(a.self(), lazy(b)));
+}
+template <int I, int F, class P, class B>
+FIXMATH_CONSTEXPR inline Product<Value<F>, B>
+operator*(const Fixed<I, F, P>& a, const Node<B>& b)
+{
+    return (Product<Value<F>, B>(lazy(a), b.self()));
+}
+
+} // namespace expr
+
+/* Packs of 4 and 8 Q16.16 numbers for writing vectorized code with the Fix16
+ * operators. Each lane gives the same result as Fix16, bit for bit, so packs
+ * and scalars can be mixed freely.
+ *
+ * Unlike the array kernels of fix16_array.h, which pick an instruction set
+ * at run time, the packs use what the compiler targets: SSE2, or SSE4.1
+ * with -msse4.1, for Fix16x4 and AVX2 with -mavx2 for Fix16x8, which is two
+ * Fix16x4 otherwise. Without SSE2 they are plain loops over the lanes.
+ * Addition, subtraction and multiplication are vectorized. Division has no
+ * exact lane-wise form and always calls fix16_div per lane. So do all
+ * operations with FIXMATH_OPTIMIZE_8BIT and FIXMATH_STICKY_OVERFLOW, and
+ * the saturating ones with FIXMATH_NO_OVERFLOW.
+ *
+ * Comparisons return a Mask with all bits set in the lanes where they hold.
+ * select(m, a, b) takes the lanes of a where m is set and those of b
+ * elsewhere.
+ */
+namespace detail
+{
+namespace pack
+{
+
+typedef Ops<16, DefaultPolicy>                                ops;
+typedef Ops<16, Policy<default_rounding, Overflow::Saturate>> sops;
+
+/* Kernels on a single lane, for the fallbacks. */
+struct Lane
+{
+    static inline int32_t add(int32_t a, int32_t b)
+    {
+        return (ops::add(a, b));
+    }
+    static inline int32_t sub(int32_t a, int32_t b)
+    {
+        return (ops::sub(a, b));
+    }
+    static inline int32_t mul(int32_t a, int32_t b)
+    {
+        return (ops::mul(a, b));
+    }
+    static inline int32_t div(int32_t a, int32_t b)
+    {
+        return (ops::div(a, b));
+    }
+    static inline int32_t sadd(int32_t a, int32_t b)
+    {
+        return (sops::add(a, b));
+    }
+    static inline int32_t ssub(int32_t a, int32_t b)
+    {
+        return (sops::sub(a, b));
+    }
+    static inline int32_t smul(int32_t a, int32_t b)
+    {
+        return (sops::mul(a, b));
+    }
+    static inline int32_t sdiv(int32_t a, int32_t b)
+    {
+        return (sops::div(a, b));
+    }
+    static inline int32_t bit_and(int32_t a, int32_t b)
+    {
+        return (a & b);
+    }
+    static inline int32_t bit_or(int32_t a, int32_t b)
+    {
+        return (a | b);
+    }
+    static inline int32_t bit_xor(int32_t a, int32_t b)
+    {
+        return (a ^ b);
+    }
+    static inline int32_t cmpeq(int32_t a, int32_t b)
+    {
+        return (a == b ? -1 : 0);
+    }
+    static inline int32_t cmpgt(int32_t a, int32_t b)
+    {
+        return (a > b ? -1 : 0);
+    }
+    static inline int32_t min(int32_t a, int32_t b)
+    {
+        return (fix16_min(a, b));
+    }
+    static inline int32_t max(int32_t a, int32_t b)
+    {
+        return (fix16_max(a, b));
+    }
+};
+
+/* Applies a lane kernel to each lane of a pack with kernels K. */
+template <int32_t (*f)(int32_t, int32_t), class K>
+inline typename K::native lanewise(typename K::native a,
+                                   typename K::native b)
+{
+    int32_t x[K::lanes];
+    int32_t y[K::lanes];
+    K::store(x, a);
+    K::store(y, b);
+    for (int i = 0; i < K::lanes; ++i)
+        x[i] = f(x[i], y[i]);
+    return (K::load(x));
+}
+
+/* Plain loops over N lanes. */
+template <int N> struct Scalar
+{
+    static const int lanes = N;
+
+    struct native
+    {
+        int32_t lane[N];
+    };
+
+    static inline native set1(int32_t x)
+    {
+        native r;
+        for (int i = 0; i < N; ++i)
+            r.lane[i] = x;
+        return (r);
+    }
+    static inline native load(const int32_t* p)
+    {
+        native r;
+        for (int i = 0; i < N; ++i)
+            r.lane[i] = p[i];
+        return (r);
+    }
+    static inline void store(int32_t* p, native x)
+    {
+        for (int i = 0; i < N; ++i)
+            p[i] = x.lane[i];
+    }
+    static inline int movemask(native m)
+    {
+        int bits = 0;
+        for (int i = 0; i < N; ++i)
+            bits |= (m.lane[i] < 0) << i;
+        return (bits);
+    }
+    static inline native select(native m, native a, native b)
+    {
+        native r;
+        for (int i = 0; i < N; ++i)
+            r.lane[i] = (m.lane[i] & a.lane[i]) | (~m.lane[i] & b.lane[i]);
+        return (r);
+    }
+    static inline native neg(native x)
+    {
+        for (int i = 0; i < N; ++i)
+            x.lane[i] = (int32_t)(0U - (uint32_t)x.lane[i]);
+        return (x);
+    }
+    static inline native abs(native x)
+    {
+        for (int i = 0; i < N; ++i)
+            x.lane[i] = fix16_abs(x.lane[i]);
+        return (x);
+    }
+
+    static inline native add(native a, native b)
+    {
+        return (lanewise<Lane::add, Scalar>(a, b));
+    }
+    static inline native sub(native a, native b)
+    {
+        return (lanewise<Lane::sub, Scalar>(a, b));
+    }
+    static inline native mul(native a, native b)
+    {
+        return (lanewise<Lane::mul, Scalar>(a, b));
+    }
+    static inline native sadd(native a, native b)
+    {
+        return (lanewise<Lane::sadd, Scalar>(a, b));
+    }
+    static inline native ssub(native a, native b)
+    {
+        return (lanewise<Lane::ssub, Scalar>(a, b));
+    }
+    static inline native smul(native a, native b)
+    {
+        return (lanewise<Lane::smul, Scalar>(a, b));
+    }
+    static inline native bit_and(native a, native b)
+    {
+        return (lanewise<Lane::bit_and, Scalar>(a, b));
+    }
+    static inline native bit_or(native a, native b)
+    {
+        return (lanewise<Lane::bit_or, Scalar>(a, b));
+    }
+    static inline native bit_xor(native a, native b)
+    {
+        return (lanewise<Lane::bit_xor, Scalar>(a, b));
+    }
+    static inline native cmpeq(native a, native b)
+    {
+        return (lanewise<Lane::cmpeq, Scalar>(a, b));
+    }
+    static inline native cmpgt(native a, native b)
+    {
+        return (lanewise<Lane::cmpgt, Scalar>(a, b));
+    }
+    static inline native min(native a, native b)
+    {
+        return (lanewise<Lane::min, Scalar>(a, b));
+    }
+    static inline native max(native a, native b)
+    {
+        return (lanewise<Lane::max, Scalar>(a, b));
+    }
+};
+
+/* The policy of the operators on top of raw kernels R, which return the
+ * wrapped result of add, sub and mul and set ovf in the lanes that
+ * overflow, like the fix16_array.c kernels.
+ */
+template <class R> struct Simd : R
+{
+    typedef typename R::native native;
+
+    /* Result of an operation that overflows in the lanes of ovf and whose
+     * exact result has the sign of s.
+     */
+    template <Overflow O>
+    static inline native finish(native r, native ovf, native s)
+    {
+        if (O == Overflow::Wrap)
+            return (r);
+        if (O == Overflow::Flag)
+            return (R::select(ovf, R::set1(fix16_overflow), r));
+        return (R::select(
+            ovf, R::bit_xor(R::set1(fix16_maximum), R::sign(s)), r));
+    }
+
+    static inline native add(native a, native b)
+    {
+        native ovf;
+        native r = R::add_wrap(a, b, ovf);
+        return (finish<default_overflow>(r, ovf, a));
+    }
+    static inline native sub(native a, native b)
+    {
+        native ovf;
+        native r = R::sub_wrap(a, b, ovf);
+        return (finish<default_overflow>(r, ovf, a));
+    }
+    static inline native mul(native a, native b)
+    {
+        native ovf;
+        native r = R::mul_wrap(a, b, ovf);
+        return (finish<default_overflow>(r, ovf, R::bit_xor(a, b)));
+    }
+
+#ifndef FIXMATH_NO_OVERFLOW
+    static inline native sadd(native a, native b)
+    {
+        native ovf;
+        native r = R::add_wrap(a, b, ovf);
+        return (finish<Overflow::Saturate>(r, ovf, a));
+    }
+    static inline native ssub(native a, native b)
+    {
+        native ovf;
+        native r = R::sub_wrap(a, b, ovf);
+        return (finish<Overflow::Saturate>(r, ovf, a));
+    }
+    static inline native smul(native a, native b)
+    {
+        native ovf;
+        native r = R::mul_wrap(a, b, ovf);
+        return (finish<Overflow::Saturate>(r, ovf, R::bit_xor(a, b)));
+    }
+#else
+    // The generic saturating kernels round differently from fix16_mul.
+    static inline native sadd(native a, native b)
+    {
+        return (lanewise<Lane::sadd, R>(a, b));
+    }
+    static inline native ssub(native a, native b)
+    {
+        return (lanewise<Lane::ssub, R>(a, b));
+    }
+    static inline native smul(native a, native b)
+    {
+        return (lanewise<Lane::smul, R>(a, b));
+    }
+#endif
+};
+
+#ifdef FIXMATH_PACK_SSE2
+/* SSE2 kernels, with the SSE4.1 instructions where the compiler targets
+ * them.
+ */
+struct Sse2
+{
+    static const int lanes = 4;
+
+    typedef __m128i native;
+
+    static inline native set1(int32_t x)
+    {
+        return (_mm_set1_epi32(x));
+    }
+    static inline native load(const int32_t* p)
+    {
+        return (_mm_loadu_si128((const __m128i*)p));
+    }
+    static inline void store(int32_t* p, native x)
+    {
+        _mm_storeu_si128((__m128i*)p, x);
+    }
+    static inline int movemask(native m)
+    {
+        return (_mm_movemask_ps(_mm_castsi128_ps(m)));
+    }
+    static inline native select(native m, native a, native b)
+    {
+#ifdef __SSE4_1__
+        return (_mm_blendv_epi8(b, a, m));
+#else
+        return (_mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)));
+#endif
+    }
+    static inline native sign(native x)
+    {
+        return (_mm_srai_epi32(x, 31));
+    }
+    static inline native neg(native x)
+    {
+        return (_mm_sub_epi32(_mm_setzero_si128(), x));
+    }
+    static inline native abs(native x)
+    {
+        // Like fix16_abs, fix16_minimum stays negative.
+        native s = sign(x);
+        return (_mm_sub_epi32(_mm_xor_si128(x, s), s));
+    }
+    static inline native bit_and(native a, native b)
+    {
+        return (_mm_and_si128(a, b));
+    }
+    static inline native bit_or(native a, native b)
+    {
+        return (_mm_or_si128(a, b));
+    }
+    static inline native bit_xor(native a, native b)
+    {
+        return (_mm_xor_si128(a, b));
+    }
+    static inline native cmpeq(native a, native b)
+    {
+        return (_mm_cmpeq_epi32(a, b));
+    }
+    static inline native cmpgt(native a, native b)
+    {
+        return (_mm_cmpgt_epi32(a, b));
+    }
+    static inline native min(native a, native b)
+    {
+#ifdef __SSE4_1__
+        return (_mm_min_epi32(a, b));
+#else
+        return (select(cmpgt(a, b), b, a));
+#endif
+    }
+    static inline native max(native a, native b)
+    {
+#ifdef __SSE4_1__
+        return (_mm_max_epi32(a, b));
+#else
+        return (select(cmpgt(a, b), a, b));
+#endif
+    }
+
+    /* The even 32 bit lanes of x and the odd ones of y. */
+    static inline native interleave(native x, native y)
+    {
+#ifdef __SSE4_1__
+        return (_mm_blend_epi16(x, y, 0xCC));
+#else
+        native odd = _mm_set_epi32(-1, 0, -1, 0);
+        return (_mm_or_si128(_mm_andnot_si128(odd, x), _mm_and_si128(odd, y)));
+#endif
+    }
+
+    static inline native add_wrap(native a, native b, native& ovf)
+    {
+        native sum = _mm_add_epi32(a, b);
+        ovf        = sign(
+            _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, sum)));
+        return (sum);
+    }
+    static inline native sub_wrap(native a, native b, native& ovf)
+    {
+        native diff = _mm_sub_epi32(a, b);
+        ovf         = sign(
+            _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, diff)));
+        return (diff);
+    }
+    static inline native mul_wrap(native a, native b, native& ovf)
+    {
+        // Full 64 bit products of the even and the odd lanes.
+#ifdef __SSE4_1__
+        native even = _mm_mul_epi32(a, b);
+        native odd =
+            _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+#else
+        // The signed products from the unsigned ones, minus b << 32 where
+        // a is negative and a << 32 where b is.
+        native fix  = _mm_add_epi32(_mm_and_si128(sign(a), b),
+                                    _mm_and_si128(sign(b), a));
+        native even =
+            _mm_sub_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(fix, 32));
+        native odd  = _mm_sub_epi64(
+            _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)),
+            _mm_and_si128(fix, _mm_set_epi32(-1, 0, -1, 0)));
+#endif
+
+        // The upper 17 bits should all be the same (the sign).
+        native upper = interleave(_mm_srli_epi64(even, 32), odd);
+        ovf = _mm_xor_si128(_mm_cmpeq_epi32(_mm_srai_epi32(upper, 15),
+                                            _mm_srai_epi32(upper, 31)),
+                            _mm_set1_epi32(-1));
+
+#ifndef FIXMATH_NO_ROUNDING
+        // Add 0.5 and subtract 1 from negative products, as fix16_mul does.
+        native half = _mm_set1_epi64x(0x8000);
+        even        = _mm_add_epi64(
+            _mm_add_epi64(even, half),
+            _mm_shuffle_epi32(sign(even), _MM_SHUFFLE(3, 3, 1, 1)));
+        odd = _mm_add_epi64(
+            _mm_add_epi64(odd, half),
+            _mm_shuffle_epi32(sign(odd), _MM_SHUFFLE(3, 3, 1, 1)));
+#endif
+
+        // The middle 32 bits of each product are the result.
+        return (interleave(_mm_srli_epi64(even, 16), _mm_slli_epi64(odd, 16)));
+    }
+};
+#endif
+
+#ifdef FIXMATH_PACK_AVX2
+struct Avx2
+{
+    static const int lanes = 8;
+
+    typedef __m256i native;
+
+    static inline native set1(int32_t x)
+    {
+        return (_mm256_set1_epi32(x));
+    }
+    static inline native load(const int32_t* p)
+    {
+        return (_mm256_loadu_si256((const __m256i*)p));
+    }
+    static inline void store(int32_t* p, native x)
+    {
+        _mm256_storeu_si256((__m256i*)p, x);
+    }
+    static inline int movemask(native m)
+    {
+        return (_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+    }
+    static inline native select(native m, native a, native b)
+    {
+        return (_mm256_blendv_epi8(b, a, m));
+    }
+    static inline native sign(native x)
+    {
+        return (_mm256_srai_epi32(x, 31));
+    }
+    static inline native neg(native x)
+    {
+        return (_mm256_sub_epi32(_mm256_setzero_si256(), x));
+    }
+    static inline native abs(native x)
+    {
+        return (_mm256_abs_epi32(x));
+    }
+    static inline native bit_and(native a, native b)
+    {
+        return (_mm256_and_si256(a, b));
+    }
+    static inline native bit_or(native a, native b)
+    {
+        return (_mm256_or_si256(a, b));
+    }
+    static inline native bit_xor(native a, native b)
+    {
+        return (_mm256_xor_si256(a, b));
+    }
+    static inline native cmpeq(native a, native b)
+    {
+        return (_mm256_cmpeq_epi32(a, b));
+    }
+    static inline native cmpgt(native a, native b)
+    {
+        return (_mm256_cmpgt_epi32(a, b));
+    }
+    static inline native min(native a, native b)
+    {
+        return (_mm256_min_epi32(a, b));
+    }
+    static inline native max(native a, native b)
+    {
+        return (_mm256_max_epi32(a, b));
+    }
+
+    static inline native add_wrap(native a, native b, native& ovf)
+    {
+        native sum = _mm256_add_epi32(a, b);
+        ovf        = sign(_mm256_andnot_si256(_mm256_xor_si256(a, b),
+                                              _mm256_xor_si256(a, sum)));
+        return (sum);
+    }
+    static inline native sub_wrap(native a, native b, native& ovf)
+    {
+        native diff = _mm256_sub_epi32(a, b);
+        ovf         = sign(_mm256_and_si256(_mm256_xor_si256(a, b),
+                                            _mm256_xor_si256(a, diff)));
+        return (diff);
+    }
+    static inline native mul_wrap(native a, native b, native& ovf)
+    {
+        native even = _mm256_mul_epi32(a, b);
+        native odd  = _mm256_mul_epi32(_mm256_srli_epi64(a, 32),
+                                       _mm256_srli_epi64(b, 32));
+
+        native upper =
+            _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+        ovf = _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_srai_epi32(upper, 15),
+                                                  _mm256_srai_epi32(upper, 31)),
+                               _mm256_set1_epi32(-1));
+
+#ifndef FIXMATH_NO_ROUNDING
+        native half = _mm256_set1_epi64x(0x8000);
+        even        = _mm256_add_epi64(
+            _mm256_add_epi64(even, half),
+            _mm256_shuffle_epi32(sign(even), _MM_SHUFFLE(3, 3, 1, 1)));
+        odd = _mm256_add_epi64(
+            _mm256_add_epi64(odd, half),
+            _mm256_shuffle_epi32(sign(odd), _MM_SHUFFLE(3, 3, 1, 1)));
+#endif
+
+        return (_mm256_blend_epi32(_mm256_srli_epi64(even, 16),
+                                   _mm256_slli_epi64(odd, 16), 0xAA));
+    }
+};
+#endif
+
+/* Two packs with kernels K side by side. */
+template <class K> struct Pair
+{
+    static const int lanes = 2 * K::lanes;
+
+    typedef typename K::native half;
+
+    struct native
+    {
+        half lo;
+        half hi;
+    };
+
+    template <half (*f)(half, half)>
+    static inline native both(native a, native b)
+    {
+        native r = {f(a.lo, b.lo), f(a.hi, b.hi)};
+        return (r);
+    }
+
+    static inline native set1(int32_t x)
+    {
+        native r = {K::set1(x), K::set1(x)};
+        return (r);
+    }
+    static inline native load(const int32_t* p)
+    {
+        native r = {K::load(p), K::load(p + K::lanes)};
+        return (r);
+    }
+    static inline void store(int32_t* p, native x)
+    {
+        K::store(p, x.lo);
+        K::store(p + K::lanes, x.hi);
+    }
+    static inline int movemask(native m)
+    {
+        return (K::movemask(m.lo) | (K::movemask(m.hi) << K::lanes));
+    }
+    static inline native select(native m, native a, native b)
+    {
+        native r = {K::select(m.lo, a.lo, b.lo), K::select(m.hi, a.hi, b.hi)};
+        return (r);
+    }
+    static inline native neg(native x)
+    {
+        native r = {K::neg(x.lo), K::neg(x.hi)};
+        return (r);
+    }
+    static inline native abs(native x)
+    {
+        native r = {K::abs(x.lo), K::abs(x.hi)};
+        return (r);
+    }
+
+    static inline native add(native a, native b)
+    {
+        return (both<K::add>(a, b));
+    }
+    static inline native sub(native a, native b)
+    {
+        return (both<K::sub>(a, b));
+    }
+    static inline native mul(native a, native b)
+    {
+        return (both<K::mul>(a, b));
+    }
+    static inline native sadd(native a, native b)
+    {
+        return (both<K::sadd>(a, b));
+    }
+    static inline native ssub(native a, native b)
+    {
+        return (both<K::ssub>(a, b));
+    }
+    static inline native smul(native a, native b)
+    {
+        return (both<K::smul>(a, b));
+    }
+    static inline native bit_and(native a, native b)
+    {
+        return (both<K::bit_and>(a, b));
+    }
+    static inline native bit_or(native a, native b)
+    {
+        return (both<K::bit_or>(a, b));
+    }
+    static inline native bit_xor(native a, native b)
+    {
+        return (both<K::bit_xor>(a, b));
+    }
+    static inline native cmpeq(native a, native b)
+    {
+        return (both<K::cmpeq>(a, b));
+    }
+    static inline native cmpgt(native a, native b)
+    {
+        return (both<K::cmpgt>(a, b));
+    }
+    static inline native min(native a, native b)
+    {
+        return (both<K::min>(a, b));
+    }
+    static inline native max(native a, native b)
+    {
+        return (both<K::max>(a, b));
+    }
+};
+
+/* The kernels of Fix16xN<N>. */
+template <int N> struct Kernels
+{
+    typedef Scalar<N> type;
+};
+#ifdef FIXMATH_PACK_SSE2
+template <> struct Kernels<4>
+{
+    typedef Simd<Sse2> type;
+};
+#endif
+template <> struct Kernels<8>
+{
+#ifdef FIXMATH_PACK_AVX2
+    typedef Simd<Avx2> type;
+#else
+    typedef Pair<Kernels<4>::type> type;
+#endif
+};
+
+} // namespace pack
+} // namespace detail
+
+/* N Q16.16 numbers, see above. */
+template <int N> class Fix16xN
+{
+    typedef typename detail::pack::Kernels<N>::type K;
+
+  public:
+    typedef typename K::native native_type;
+    typedef Fixed<16, 16>      scalar_type;
+
+    static const int size = N;
+
+    /* Result of a comparison, all bits set in the lanes where it holds. */
+    class Mask
+    {
+      public:
+        native_type value;
+
+        explicit Mask(const native_type inValue) : value(inValue)
+        {
+        }
+
+        /* Bit i is set if lane i is. */
+        int bits() const
+        {
+            return (K::movemask(value));
+        }
+        bool any() const
+        {
+            return (bits() != 0);
+        }
+        bool all() const
+        {
+            return (bits() == (1 << N) - 1);
+        }
+
+        const Mask operator&(const Mask& other) const
+        {
+            return Mask(K::bit_and(value, other.value));
+        }
+        const Mask operator|(const Mask& other) const
+        {
+            return Mask(K::bit_or(value, other.value));
+        }
+        const Mask operator^(const Mask& other) const
+        {
+            return Mask(K::bit_xor(value, other.value));
+        }
+        const Mask operator~() const
+        {
+            return Mask(K::bit_xor(value, K::set1(-1)));
+        }
+    };
+
+    native_type value;
+
+    Fix16xN() : value(K::set1(0))
+    {
+    }
+    /* Sets all lanes to x. */
+    Fix16xN(const scalar_type& x) : value(K::set1(x.value))
+    {
+    }
+    explicit Fix16xN(const native_type inValue) : value(inValue)
+    {
+    }
+
+    /* Reads N values from p, which needs no particular alignment. */
+    static const Fix16xN load(const fix16_t* p)
+    {
+        return Fix16xN(K::load(p));
+    }
+    void store(fix16_t* p) const
+    {
+        K::store(p, value);
+    }
+
+    const scalar_type operator[](int i) const
+    {
+        int32_t lanes[N];
+        K::store(lanes, value);
+        return scalar_type(lanes[i]);
+    }
+
+    Fix16xN& operator+=(const Fix16xN& rhs)
+    {
+        value = K::add(value, rhs.value);
+        return *this;
+    }
+    Fix16xN& operator-=(const Fix16xN& rhs)
+    {
+        value = K::sub(value, rhs.value);
+        return *this;
+    }
+    Fix16xN& operator*=(const Fix16xN& rhs)
+    {
+        value = K::mul(value, rhs.value);
+        return *this;
+    }
+    Fix16xN& operator/=(const Fix16xN& rhs)
+    {
+        value = detail::pack::lanewise<detail::pack::Lane::div, K>(value,
+                                                                   rhs.value);
+        return *this;
+    }
+
+    const Fix16xN operator+(const Fix16xN& other) const
+    {
+        return Fix16xN(K::add(value, other.value));
+    }
+    const Fix16xN operator-(const Fix16xN& other) const
+    {
+        return Fix16xN(K::sub(value, other.value));
+    }
+    const Fix16xN operator*(const Fix16xN& other) const
+    {
+        return Fix16xN(K::mul(value, other.value));
+    }
+    const Fix16xN operator/(const Fix16xN& other) const
+    {
+        Fix16xN ret = *this;
+        ret /= other;
+        return ret;
+    }
+    /* Wraps like Fix16, -fix16_minimum is fix16_minimum. */
+    const Fix16xN operator-() const
+    {
+        return Fix16xN(K::neg(value));
+    }
+
+    const Fix16xN sadd(const Fix16xN& other) const
+    {
+        return Fix16xN(K::sadd(value, other.value));
+    }
+    const Fix16xN ssub(const Fix16xN& other) const
+    {
+        return Fix16xN(K::ssub(value, other.value));
+    }
+    const Fix16xN smul(const Fix16xN& other) const
+    {
+        return Fix16xN(K::smul(value, other.value));
+    }
+    const Fix16xN sdiv(const Fix16xN& other) const
+    {
+        return Fix16xN(detail::pack::lanewise<detail::pack::Lane::sdiv, K>(
+            value, other.value));
+    }
+
+    const Mask operator==(const Fix16xN& other) const
+    {
+        return Mask(K::cmpeq(value, other.value));
+    }
+    const Mask operator!=(const Fix16xN& other) const
+    {
+        return ~(*this == other);
+    }
+    const Mask operator<(const Fix16xN& other) const
+    {
+        return Mask(K::cmpgt(other.value, value));
+    }
+    const Mask operator>(const Fix16xN& other) const
+    {
+        return Mask(K::cmpgt(value, other.value));
+    }
+    const Mask operator<=(const Fix16xN& other) const
+    {
+        return ~(*this > other);
+    }
+    const Mask operator>=(const Fix16xN& other) const
+    {
+        return ~(*this < other);
+    }
+};
+
+/* Lane-wise fix16_min, fix16_max, fix16_abs and fix16_clamp. */
+template <int N>
+inline const Fix16xN<N> min(const Fix16xN<N>& a, const Fix16xN<N>& b)
+{
+    typedef typename detail::pack::Kernels<N>::type K;
+    return Fix16xN<N>(K::min(a.value, b.value));
+}
+template <int N>
+inline const Fix16xN<N> max(const Fix16xN<N>& a, const Fix16xN<N>& b)
+{
+    typedef typename detail::pack::Kernels<N>::type K;
+    return Fix16xN<N>(K::max(a.value, b.value));
+}
+template <int N> inline const Fix16xN<N> abs(const Fix16xN<N>& x)
+{
+    typedef typename detail::pack::Kernels<N>::type K;
+    return Fix16xN<N>(K::abs(x.value));
+}
+template <int N>
+inline const Fix16xN<N> clamp(const Fix16xN<N>& x, const Fix16xN<N>& lo,
+                              const Fix16xN<N>& hi)
+{
+    return (min(max(x, lo), hi));
+}
+
+/* The lanes of a where m is set and those of b elsewhere. */
+template <int N>
+inline const Fix16xN<N> select(const typename Fix16xN<N>::Mask& m,
+                               const Fix16xN<N>& a, const Fix16xN<N>& b)
+{
+    typedef typename detail::pack::Kernels<N>::type K;
+    return Fix16xN<N>(K::select(m.value, a.value, b.value));
+}
+
+typedef Fix16xN<4> Fix16x4;
+typedef Fix16xN<8> Fix16x8;
+
+} // namespace fixmath
+
+typedef fixmath::Fixed<16, 16> Fix16;
+typedef fixmath::Fix16x4        Fix16x4;
+typedef fixmath::Fix16x8        Fix16x8;
+
 #endif
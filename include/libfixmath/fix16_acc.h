@@ -0,0 +1,111 @@
+#ifndef libfixmath_fix16_acc_h__
+#define libfixmath_fix16_acc_h__
+
+#include "fix16.h"
+#include "int64.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Wide accumulator for long reductions over fix16_t values.
+     *
+     * fix16_acc_t is a Q48.16 number: it keeps the 16 fraction bits of
+     * fix16_t and adds 32 integer bits, so 2^32 values of any magnitude can
+     * be summed without overflow. Under FIXMATH_NO_64BIT it is the
+     * _int64_t emulation from int64.h. Only fix16_acc_to_fix16 narrows the
+     * result back to fix16_t.
+     */
+
+    /** Q48.16 accumulator, see above.
+     */
+    typedef int64_t fix16_acc_t;
+
+    /** Returns an accumulator holding zero.
+     */
+    static inline fix16_acc_t fix16_acc_zero(void)
+    {
+        return (int64_from_int32(0));
+    }
+
+    /** Returns an accumulator holding the given fix16_t.
+     */
+    static inline fix16_acc_t fix16_acc_from_fix16(fix16_t x)
+    {
+        return (int64_from_int32(x));
+    }
+
+    /** Returns acc + x. This is exact.
+     */
+    static inline fix16_acc_t fix16_acc_add(fix16_acc_t acc, fix16_t x)
+    {
+        return (int64_add(acc, int64_from_int32(x)));
+    }
+
+    /** Returns acc - x. This is exact.
+     */
+    static inline fix16_acc_t fix16_acc_sub(fix16_acc_t acc, fix16_t x)
+    {
+        return (int64_sub(acc, int64_from_int32(x)));
+    }
+
+    /** Returns the sum of two accumulators, e.g. partial sums of one array.
+     */
+    static inline fix16_acc_t fix16_acc_merge(fix16_acc_t x, fix16_acc_t y)
+    {
+        return (int64_add(x, y));
+    }
+
+    /** Returns acc + a * b. The full product is rounded to 16 fraction bits
+     * like the 64-bit fix16_mul, but it is never saturated.
+     */
+    static inline fix16_acc_t fix16_acc_mac(fix16_acc_t acc, fix16_t a,
+                                            fix16_t b)
+    {
+        fix16_acc_t product = int64_mul_i32_i32(a, b);
+#ifndef FIXMATH_NO_ROUNDING
+        // Add 0.5, minus 1 for negative products so that -1/2 rounds away
+        // from zero.
+        product = int64_add(
+            product,
+            int64_from_int32(int64_cmp_lt(product, int64_from_int32(0))
+                                 ? 0x7FFF
+                                 : 0x8000));
+#endif
+        // Arithmetic shift of the Q32.32 product down to Q48.16.
+        int32_t  hi = int64_hi(product);
+        uint32_t lo = int64_lo(product);
+        return (int64_add(acc, int64_const(hi >> 16, ((uint32_t)hi << 16U) |
+                                                         (lo >> 16U))));
+    }
+
+    /** Returns the accumulated value as a fix16_t, saturated to
+     * fix16_maximum or fix16_minimum unless FIXMATH_NO_OVERFLOW is defined.
+     * Without saturation the lower 32 bits are returned.
+     */
+    static inline fix16_t fix16_acc_to_fix16(fix16_acc_t acc)
+    {
+#ifndef FIXMATH_NO_OVERFLOW
+        if (int64_cmp_gt(acc, int64_from_int32(fix16_maximum)))
+            return (fix16_maximum);
+        if (int64_cmp_lt(acc, int64_from_int32(fix16_minimum)))
+            return (fix16_minimum);
+#endif
+        return ((fix16_t)int64_lo(acc));
+    }
+
+    /** Returns the accumulated value as a double.
+     */
+    static inline double fix16_acc_to_dbl(fix16_acc_t acc)
+    {
+        return (((double)int64_hi(acc) * 4294967296.0 +
+                 (double)int64_lo(acc)) /
+                fix16_one);
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef libfixmath_fix16_angle_h__
+#define libfixmath_fix16_angle_h__
+
+#include "fix16.h"
+#include "int64.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Binary angles.
+     *
+     * fix16_angle_t is a fraction of a full turn in 2^-32 steps, about
+     * 1.5e-9 rad. Angles add and subtract with the wrap-around of uint32_t,
+     * so a phase accumulator is phase += step and never needs a range
+     * reduction, and the quadrant is in the top two bits. Only the
+     * conversions from and to radians or degrees multiply, by a constant.
+     */
+
+    /** Fraction of a turn, see above.
+     */
+    typedef uint32_t fix16_angle_t;
+
+    static const fix16_angle_t fix16_angle_quarter = 0x40000000U; /**< pi/2 */
+    static const fix16_angle_t fix16_angle_half    = 0x80000000U; /**< pi */
+
+    /** Returns the given angle in radians as a binary angle, taken modulo
+     * a turn.
+     */
+    static inline fix16_angle_t fix16_angle_from_rad(fix16_t inAngle)
+    {
+        /* inAngle * 2^16 / (2pi), split into 10430 and 0.37835... * 2^32,
+         * rounded.
+         */
+        int64_t frac = int64_add(int64_mul_i32_i32(inAngle, 1625002897),
+                                 int64_const(0, 0x80000000U));
+        return (((uint32_t)inAngle * 10430U) + (uint32_t)int64_hi(frac));
+    }
+
+    /** Returns the given angle in degrees as a binary angle, taken modulo
+     * a turn.
+     */
+    static inline fix16_angle_t fix16_angle_from_deg(fix16_t inAngle)
+    {
+        /* inAngle * 2^16 / 360, split into 182 and 0.04444... * 2^32,
+         * rounded, so that multiples of 90 degrees are exact.
+         */
+        int64_t frac = int64_add(int64_mul_i32_i32(inAngle, 190887435),
+                                 int64_const(0, 0x80000000U));
+        return (((uint32_t)inAngle * 182U) + (uint32_t)int64_hi(frac));
+    }
+
+    /** Returns the given binary angle in radians, in [-pi, pi].
+     */
+    static inline fix16_t fix16_angle_to_rad(fix16_angle_t inAngle)
+    {
+        /* inAngle * 2pi * 2^28 / 2^44, rounded. */
+        int32_t x = int64_hi(int64_mul_i32_i32((int32_t)inAngle, 1686629713));
+        return ((x + 0x800) >> 12);
+    }
+
+    /** Returns the given binary angle in degrees, in [-180, 180].
+     */
+    static inline fix16_t fix16_angle_to_deg(fix16_angle_t inAngle)
+    {
+        /* inAngle * 360 * 2^17 / 2^33, rounded. */
+        int32_t x = int64_hi(int64_mul_i32_i32((int32_t)inAngle, 47185920));
+        return ((x + 1) >> 1);
+    }
+
+    /** Returns the sine of the given binary angle, interpolated in a table
+     * of the quarter wave. The table has 2^FIXMATH_SIN_LUT_BITS steps, or
+     * 1024 if that is not defined, and the result is within 1 LSB.
+     */
+    extern fix16_t fix16_angle_sin(fix16_angle_t inAngle) FIXMATH_FUNC_ATTRS;
+
+    /** Returns the cosine of the given binary angle, see fix16_angle_sin().
+     */
+    extern fix16_t fix16_angle_cos(fix16_angle_t inAngle) FIXMATH_FUNC_ATTRS;
+
+    /** Returns the binary angle of the vector (inX, inY), the arctangent of
+     * inY/inX. Computed with CORDIC like fix16_cordic_atan2(), in 24
+     * iterations, and accurate to about 2^-25 of a turn.
+     */
+    extern fix16_angle_t fix16_angle_atan2(fix16_t inY,
+                                           fix16_t inX) FIXMATH_FUNC_ATTRS;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
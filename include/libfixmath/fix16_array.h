@@ -0,0 +1,233 @@
+#ifndef libfixmath_fix16_array_h__
+#define libfixmath_fix16_array_h__
+
+#include "fix16.h"
+#include "fix16_acc.h"
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#else
+#include <stddef.h>
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Element-wise operations over arrays of fix16_t.
+     *
+     * Every kernel gives bit-identical results to calling the matching scalar
+     * function once per element, including the fix16_overflow sentinel and
+     * the rounding selected by FIXMATH_NO_ROUNDING / FIXMATH_NO_OVERFLOW.
+     * On x86 the widest instruction set supported by the CPU (SSE4.1, AVX2
+     * or AVX-512) is selected when the library is loaded, otherwise a
+     * portable scalar loop is used.
+     *
+     * The destination may alias either source array.
+     */
+
+    /** Instruction set levels for the array kernels, in increasing order.
+     */
+    typedef enum
+    {
+        fix16_simd_scalar = 0,
+        fix16_simd_sse41,
+        fix16_simd_avx2,
+        fix16_simd_avx512,
+        fix16_simd_count,
+    } fix16_simd_e;
+
+    /** Returns the level the array kernels currently run at.
+     * The FIXMATH_SIMD environment variable ("scalar", "sse4.1", "avx2" or
+     * "avx512") lowers the level picked at load time, e.g. for benchmarking.
+     */
+    extern fix16_simd_e fix16_simd_level(void);
+
+    /** Returns the highest level supported by this CPU and build.
+     */
+    extern fix16_simd_e fix16_simd_supported(void);
+
+    /** Selects the level for the array kernels, clamped to
+     * fix16_simd_supported(), and returns the level now in use.
+     * Not thread-safe, call it before starting any worker threads.
+     */
+    extern fix16_simd_e fix16_simd_force(fix16_simd_e level);
+
+    /** Returns a printable name for the given level.
+     */
+    extern const char* fix16_simd_name(fix16_simd_e level);
+
+    /** dst[i] = fix16_add(a[i], b[i]) for i in [0, n).
+     */
+    extern void fix16_add_array(fix16_t* dst, const fix16_t* a,
+                                const fix16_t* b, size_t n);
+
+    /** dst[i] = fix16_sub(a[i], b[i]) for i in [0, n).
+     */
+    extern void fix16_sub_array(fix16_t* dst, const fix16_t* a,
+                                const fix16_t* b, size_t n);
+
+    /** dst[i] = fix16_mul(a[i], b[i]) for i in [0, n).
+     */
+    extern void fix16_mul_array(fix16_t* dst, const fix16_t* a,
+                                const fix16_t* b, size_t n);
+
+    /** dst[i] = fix16_div(a[i], b[i]) for i in [0, n).
+     */
+    extern void fix16_div_array(fix16_t* dst, const fix16_t* a,
+                                const fix16_t* b, size_t n);
+
+    /** dst[i] = fix16_add(a[i], b) for i in [0, n).
+     */
+    extern void fix16_add_array_scalar(fix16_t* dst, const fix16_t* a,
+                                       fix16_t b, size_t n);
+
+    /** dst[i] = fix16_sub(a[i], b) for i in [0, n).
+     */
+    extern void fix16_sub_array_scalar(fix16_t* dst, const fix16_t* a,
+                                       fix16_t b, size_t n);
+
+    /** dst[i] = fix16_mul(a[i], b) for i in [0, n).
+     */
+    extern void fix16_mul_array_scalar(fix16_t* dst, const fix16_t* a,
+                                       fix16_t b, size_t n);
+
+    /** dst[i] = fix16_div(a[i], b) for i in [0, n).
+     */
+    extern void fix16_div_array_scalar(fix16_t* dst, const fix16_t* a,
+                                       fix16_t b, size_t n);
+
+    /** dst[i] = fix16_div_by(a[i], d) for i in [0, n).
+     */
+    extern void fix16_div_by_array(fix16_t* dst, const fix16_t* a,
+                                   const fix16_divisor_t* d, size_t n);
+
+    /** fix16_sincos(angle[i], &s[i], &c[i]) for i in [0, n).
+     */
+    extern void fix16_sincos_array(fix16_t* s, fix16_t* c,
+                                   const fix16_t* angle, size_t n);
+
+    /** dst[i] = fix16_sqrt(src[i]) for i in [0, n).
+     */
+    extern void fix16_sqrt_array(fix16_t* dst, const fix16_t* src, size_t n);
+
+    /** dst[i] = fix16_rsqrt(src[i]) for i in [0, n).
+     */
+    extern void fix16_rsqrt_array(fix16_t* dst, const fix16_t* src, size_t n);
+
+    /** fix16_normalize2(&x[i], &y[i]) for i in [0, n).
+     */
+    extern void fix16_normalize2_array(fix16_t* x, fix16_t* y, size_t n);
+
+    /** fix16_normalize3(&x[i], &y[i], &z[i]) for i in [0, n).
+     */
+    extern void fix16_normalize3_array(fix16_t* x, fix16_t* y, fix16_t* z,
+                                       size_t n);
+
+    /** dst[i] = fix16_exp(src[i]) for i in [0, n).
+     */
+    extern void fix16_exp_array(fix16_t* dst, const fix16_t* src, size_t n);
+
+    /** dst[i] = fix16_log(src[i]) for i in [0, n).
+     */
+    extern void fix16_log_array(fix16_t* dst, const fix16_t* src, size_t n);
+
+    /** dst[i] = fix16_log2(src[i]) for i in [0, n).
+     */
+    extern void fix16_log2_array(fix16_t* dst, const fix16_t* src, size_t n);
+
+    /** dst[i] = fix16_log10(src[i]) for i in [0, n).
+     */
+    extern void fix16_log10_array(fix16_t* dst, const fix16_t* src, size_t n);
+
+    /** dst[i] = fix16_exp2(src[i]) for i in [0, n).
+     */
+    extern void fix16_exp2_array(fix16_t* dst, const fix16_t* src, size_t n);
+
+    /** dst[i] = fix16_pow(src[i], y) for i in [0, n), e.g. a gamma curve.
+     */
+    extern void fix16_pow_array(fix16_t* dst, const fix16_t* src, fix16_t y,
+                                size_t n);
+
+    /** fix16_cordic_sincos(angle[i], &s[i], &c[i], iterations) for i in
+     * [0, n).
+     */
+    extern void fix16_cordic_sincos_array(fix16_t* s, fix16_t* c,
+                                          const fix16_t* angle, size_t n,
+                                          unsigned iterations);
+
+    /** angle[i] = fix16_cordic_atan2(y[i], x[i], &hypot[i], iterations) for
+     * i in [0, n). hypot may be NULL.
+     */
+    extern void fix16_cordic_atan2_array(fix16_t* angle, fix16_t* hypot,
+                                         const fix16_t* y, const fix16_t* x,
+                                         size_t n, unsigned iterations);
+
+    /** Returns the sum of a[i] * b[i] for i in [0, n).
+     * The full 64-bit products are summed and the sum is rounded like
+     * fix16_mul and saturated once at the end (unless FIXMATH_NO_OVERFLOW is
+     * defined), so the result is exact up to that rounding and is the same at
+     * every SIMD level. The sum wraps if it exceeds 2^31 in magnitude.
+     */
+    extern fix16_t fix16_dot(const fix16_t* a, const fix16_t* b, size_t n);
+
+    /** Like fix16_dot, for a[i * stride_a] and b[i * stride_b], e.g. to take
+     * a column of a row-major matrix.
+     */
+    extern fix16_t fix16_dot_strided(const fix16_t* a, size_t stride_a,
+                                     const fix16_t* b, size_t stride_b,
+                                     size_t n);
+
+    /** Returns the exact sum of a[i] for i in [0, n).
+     */
+    extern fix16_acc_t fix16_sum_array(const fix16_t* a, size_t n);
+
+    /** Returns the sum of a[i] * a[i] for i in [0, n), each square rounded
+     * as by fix16_acc_mac.
+     */
+    extern fix16_acc_t fix16_sumsq_array(const fix16_t* a, size_t n);
+
+    /** Returns the smallest or largest of a[i] for i in [0, n), or
+     * fix16_maximum and fix16_minimum respectively if n is 0.
+     */
+    extern fix16_t fix16_min_array(const fix16_t* a, size_t n);
+    extern fix16_t fix16_max_array(const fix16_t* a, size_t n);
+
+    /** Returns the index of the first smallest or largest of a[i] for i in
+     * [0, n), or 0 if n is 0.
+     */
+    extern size_t fix16_argmin_array(const fix16_t* a, size_t n);
+    extern size_t fix16_argmax_array(const fix16_t* a, size_t n);
+
+#ifndef FIXMATH_NO_OVERFLOW
+    /** Saturating variants, see fix16_sadd, fix16_ssub, fix16_smul and
+     * fix16_sdiv.
+     */
+    extern void fix16_sadd_array(fix16_t* dst, const fix16_t* a,
+                                 const fix16_t* b, size_t n);
+    extern void fix16_ssub_array(fix16_t* dst, const fix16_t* a,
+                                 const fix16_t* b, size_t n);
+    extern void fix16_smul_array(fix16_t* dst, const fix16_t* a,
+                                 const fix16_t* b, size_t n);
+    extern void fix16_sdiv_array(fix16_t* dst, const fix16_t* a,
+                                 const fix16_t* b, size_t n);
+
+    extern void fix16_sadd_array_scalar(fix16_t* dst, const fix16_t* a,
+                                        fix16_t b, size_t n);
+    extern void fix16_ssub_array_scalar(fix16_t* dst, const fix16_t* a,
+                                        fix16_t b, size_t n);
+    extern void fix16_smul_array_scalar(fix16_t* dst, const fix16_t* a,
+                                        fix16_t b, size_t n);
+    extern void fix16_sdiv_array_scalar(fix16_t* dst, const fix16_t* a,
+                                        fix16_t b, size_t n);
+
+    extern void fix16_sdiv_by_array(fix16_t* dst, const fix16_t* a,
+                                    const fix16_divisor_t* d, size_t n);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,691 @@
+#ifndef libfixmath_fix16_inline_h__
+#define libfixmath_fix16_inline_h__
+
+/* Implementations of the core operations. With FIXMATH_INLINE, fix16.h
+ * includes this file and every translation unit gets them as static inline
+ * functions. Otherwise, and always in the library itself, fix16.c includes it
+ * to define the exported functions, so both builds have the same symbols.
+ */
+
+#include "fix16.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC INLINE FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Perform signed shift right operation on 32-bit integer. This has been
+ * separated to suppress cppcheck/MISRA warnings about shifting signed integers,
+ * which are unpredictable depending on implementation, but work predictably on
+ * ARM.
+ *
+ * @param value Value to shift
+ * @param shift Number of bits to shift
+ *
+ * @return int32_t Shifted value
+ */
+static inline int32_t fix16_signed_shift_right(int32_t value, int32_t shift)
+{
+    int32_t retval;
+
+    // NOTE: ARM processors will perform this shift predictably
+    // cppcheck-suppress-begin misra-c2012-10.1
+    if (shift < 0)
+    {
+        retval = (value << -shift);
+    }
+    else
+    {
+        retval = (value >> shift);
+    }
+    // cppcheck-suppress-end misra-c2012-10.1
+
+    return (retval);
+}
+
+/**
+ * @brief Perform signed shift left operation on 32-bit integer. This has been
+ * separated to suppress cppcheck/MISRA warnings about shifting signed integers,
+ * which are unpredictable depending on implementation, but work predictably on
+ * ARM.
+ *
+ * @param value Value to shift
+ * @param shift Number of bits to shift
+ *
+ * @return int32_t Shifted value
+ */
+static inline int32_t fix16_signed_shift_left(int32_t value, int32_t shift)
+{
+    int32_t retval;
+
+    // NOTE: ARM processors will perform this shift predictably
+    // cppcheck-suppress-begin misra-c2012-10.1
+    if (shift < 0)
+    {
+        retval = (value >> -shift);
+    }
+    else
+    {
+        retval = (value << shift);
+    }
+    // cppcheck-suppress-end misra-c2012-10.1
+
+    return (retval);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CORE OPERATIONS
+////////////////////////////////////////////////////////////////////////////////
+
+/* Returns value, or fix16_overflow if ovf is 1. The select compiles to a
+ * conditional move, or a blend in vectorized loops, and not to a branch. With
+ * FIXMATH_STICKY_OVERFLOW ovf is also ORed into the sticky flag.
+ */
+static inline fix16_t fix16_overflow_if(uint32_t value, uint32_t ovf)
+{
+#ifdef FIXMATH_STICKY_OVERFLOW
+    fix16_overflow_sticky |= (uint16_t)ovf;
+#endif
+    return (ovf ? fix16_overflow : (fix16_t)value);
+}
+
+/* Returns value, or if ovf is 1 fix16_maximum or fix16_minimum as selected by
+ * the sign bit of negative.
+ */
+static inline fix16_t fix16_saturate_select(uint32_t value, uint32_t ovf,
+                                            uint32_t negative)
+{
+    uint32_t limit = (uint32_t)fix16_maximum ^ (0U - (negative >> 31U));
+    return ((fix16_t)(ovf ? limit : value));
+}
+
+/* fix16_saturate_select() that also records ovf in the sticky flag. */
+static inline fix16_t fix16_saturate_if(uint32_t value, uint32_t ovf,
+                                        uint32_t negative)
+{
+#ifdef FIXMATH_STICKY_OVERFLOW
+    fix16_overflow_sticky |= (uint16_t)ovf;
+#endif
+    return (fix16_saturate_select(value, ovf, negative));
+}
+
+/* Subtraction and addition with overflow detection.
+ * The versions without overflow detection are always inlined in fix16.h.
+ */
+#ifndef FIXMATH_NO_OVERFLOW
+/* Returns the wrapped sum and sets *ovf to 1 if it overflowed. */
+static inline uint32_t fix16_add_checked(fix16_t a, fix16_t b, uint32_t* ovf)
+{
+    // Use unsigned integers because overflow with signed integers is
+    // an undefined operation (http://www.airs.com/blog/archives/120).
+    uint32_t _a  = (uint32_t)a;
+    uint32_t _b  = (uint32_t)b;
+    uint32_t sum = _a + _b;
+
+    // Overflow can only happen if sign of a == sign of b, and then
+    // it causes sign of sum != sign of a.
+    *ovf         = (~(_a ^ _b) & (_a ^ sum)) >> 31U;
+    return (sum);
+}
+
+/* Returns the wrapped difference and sets *ovf to 1 if it overflowed. */
+static inline uint32_t fix16_sub_checked(fix16_t a, fix16_t b, uint32_t* ovf)
+{
+    uint32_t _a   = (uint32_t)a;
+    uint32_t _b   = (uint32_t)b;
+    uint32_t diff = _a - _b;
+
+    // Overflow can only happen if sign of a != sign of b, and then
+    // it causes sign of diff != sign of a.
+    *ovf          = ((_a ^ _b) & (_a ^ diff)) >> 31U;
+    return (diff);
+}
+
+FIXMATH_INLINE_API fix16_t fix16_add(fix16_t a, fix16_t b)
+{
+    uint32_t ovf;
+    uint32_t sum = fix16_add_checked(a, b, &ovf);
+
+    return (fix16_overflow_if(sum, ovf));
+}
+
+FIXMATH_INLINE_API fix16_t fix16_sub(fix16_t a, fix16_t b)
+{
+    uint32_t ovf;
+    uint32_t diff = fix16_sub_checked(a, b, &ovf);
+
+    return (fix16_overflow_if(diff, ovf));
+}
+
+/* Saturating arithmetic. An overflowing sum or difference has the sign of a,
+ * so a selects the limit.
+ */
+FIXMATH_INLINE_API fix16_t fix16_sadd(fix16_t a, fix16_t b)
+{
+    uint32_t ovf;
+    uint32_t sum = fix16_add_checked(a, b, &ovf);
+
+    return (fix16_saturate_if(sum, ovf, (uint32_t)a));
+}
+
+FIXMATH_INLINE_API fix16_t fix16_ssub(fix16_t a, fix16_t b)
+{
+    uint32_t ovf;
+    uint32_t diff = fix16_sub_checked(a, b, &ovf);
+
+    return (fix16_saturate_if(diff, ovf, (uint32_t)a));
+}
+#endif
+
+/* 64-bit implementation for fix16_mul. Fastest version for e.g. ARM Cortex M3.
+ * Performs a 32*32 -> 64bit multiplication. The middle 32 bits are the result,
+ * bottom 16 bits are used for rounding, and upper 16 bits are used for overflow
+ * detection.
+ */
+
+#if !defined(FIXMATH_NO_64BIT) && !defined(FIXMATH_OPTIMIZE_8BIT)
+static inline uint32_t fix16_mul_checked(fix16_t inArg0, fix16_t inArg1,
+                                         uint32_t* ovf)
+{
+    int64_t  product = (int64_t)inArg0 * inArg1;
+
+    // The upper 17 bits should all be the same (the sign).
+    uint32_t upper   = (product >> 47U);
+    *ovf             = ((upper + 1U) > 1U);
+
+#ifdef FIXMATH_NO_ROUNDING
+    return ((uint32_t)(product >> 16U));
+#else
+    // This adjustment is required in order to round -1/2 correctly
+    product -= (product < 0);
+
+    uint32_t result = (uint32_t)(product >> 16U);
+    result += ((uint32_t)product & 0x8000U) >> 15U;
+
+    return (result);
+#endif
+}
+#endif
+
+/* 32-bit implementation of fix16_mul. Potentially fast on 16-bit processors,
+ * and this is a relatively good compromise for compilers that do not support
+ * uint64_t. Uses 16*16->32bit multiplications.
+ */
+#if defined(FIXMATH_NO_64BIT) && !defined(FIXMATH_OPTIMIZE_8BIT)
+static inline uint32_t fix16_mul_checked(fix16_t inArg0, fix16_t inArg1,
+                                         uint32_t* ovf)
+{
+    // Each argument is divided to 16-bit parts.
+    //					AB
+    //			*	 CD
+    // -----------
+    //					BD	16 * 16 -> 32 bit products
+    //				 CB
+    //				 AD
+    //				AC
+    //			 |----| 64 bit product
+    int32_t  A          = fix16_signed_shift_right(inArg0, 16);
+    int32_t  C          = fix16_signed_shift_right(inArg1, 16);
+    uint32_t B          = ((uint32_t)inArg0 & 0xFFFFU);
+    uint32_t D          = ((uint32_t)inArg1 & 0xFFFFU);
+
+    int32_t  AC         = A * C;
+    uint32_t BD         = B * D;
+
+    int32_t  AD         = A * (int32_t)D;
+    int32_t  CB         = C * (int32_t)B;
+    int32_t  AD_CB      = AD + CB;
+
+    int32_t  product_hi = AC + fix16_signed_shift_right(AD_CB, 16);
+
+    // Handle carry from lower 32 bits to upper part of result.
+    uint32_t ad_cb_temp = (uint32_t)AD_CB << 16U;
+    uint32_t product_lo = BD + ad_cb_temp;
+    if (product_lo < BD)
+    {
+        product_hi++;
+    }
+
+    // The upper 17 bits should all be the same (the sign).
+    *ovf = ((product_hi >> 31U) != (product_hi >> 15U));
+
+#ifdef FIXMATH_NO_ROUNDING
+
+    return (((uint32_t)product_hi << 16) | (product_lo >> 16U));
+
+#else
+
+    // Subtracting 0x8000 (= 0.5) and then using signed right shift
+    // achieves proper rounding to result-1, except in the corner
+    // case of negative numbers and lowest word = 0x8000.
+    // To handle that, we also have to subtract 1 for negative numbers.
+    uint32_t product_lo_tmp = product_lo;
+    product_lo -= 0x8000U;
+    product_lo -= (uint32_t)product_hi >> 31U;
+    if (product_lo > product_lo_tmp)
+    {
+        product_hi--;
+    }
+
+    // Discard the lowest 16 bits. Note that this is not exactly the same
+    // as dividing by 0x10000. For example if product = -1, result will
+    // also be -1 and not 0. This is compensated by adding +1 to the result
+    // and compensating this in turn in the rounding above.
+    uint32_t result = (uint32_t)fix16_signed_shift_left(product_hi, 16);
+    result |= product_lo >> 16U;
+
+    return (result + 1U);
+#endif
+}
+#endif
+
+/* The 64-bit and 32-bit versions share the overflow handling. */
+#ifndef FIXMATH_OPTIMIZE_8BIT
+FIXMATH_INLINE_API fix16_t fix16_mul(fix16_t inArg0, fix16_t inArg1)
+{
+    uint32_t ovf;
+    uint32_t result = fix16_mul_checked(inArg0, inArg1, &ovf);
+
+#ifndef FIXMATH_NO_OVERFLOW
+    return (fix16_overflow_if(result, ovf));
+#else
+    (void)ovf;
+    return ((fix16_t)result);
+#endif
+}
+#endif
+
+/* 8-bit implementation of fix16_mul. Fastest on e.g. Atmel AVR.
+ * Uses 8*8->16bit multiplications, and also skips any bytes that
+ * are zero.
+ */
+#if defined(FIXMATH_OPTIMIZE_8BIT)
+FIXMATH_INLINE_API fix16_t fix16_mul(fix16_t inArg0, fix16_t inArg1)
+{
+    uint32_t _a    = fix_abs(inArg0);
+    uint32_t _b    = fix_abs(inArg1);
+
+    // Explicit casts so that the header also compiles as C++.
+    uint8_t  va[4] = {(uint8_t)_a, (uint8_t)(_a >> 8U), (uint8_t)(_a >> 16U),
+                      (uint8_t)(_a >> 24U)};
+    uint8_t  vb[4] = {(uint8_t)_b, (uint8_t)(_b >> 8U), (uint8_t)(_b >> 16U),
+                      (uint8_t)(_b >> 24U)};
+
+    uint32_t low   = 0;
+    uint32_t mid   = 0;
+
+    // Result column i depends on va[0..i] and vb[i..0]
+
+#ifndef FIXMATH_NO_OVERFLOW
+    // i = 6
+    if ((va[3] && vb[3]) != 0U)
+    {
+        return (fix16_overflow_raise());
+    }
+#endif
+
+    // i = 5
+    if ((va[2] && vb[3]) != 0U)
+    {
+        mid += (uint16_t)va[2] * vb[3];
+    }
+    if ((va[3] && vb[2]) != 0U)
+    {
+        mid += (uint16_t)va[3] * vb[2];
+    }
+    mid <<= 8;
+
+    // i = 4
+    if ((va[1] && vb[3]) != 0U)
+    {
+        mid += (uint16_t)va[1] * vb[3];
+    }
+    if ((va[2] && vb[2]) != 0U)
+    {
+        mid += (uint16_t)va[2] * vb[2];
+    }
+    if ((va[3] && vb[1]) != 0U)
+    {
+        mid += (uint16_t)va[3] * vb[1];
+    }
+
+#ifndef FIXMATH_NO_OVERFLOW
+    if (mid & 0xFF000000U)
+    {
+        return (fix16_overflow_raise());
+    }
+#endif
+    mid <<= 8;
+
+    // i = 3
+    if ((va[0] && vb[3]) != 0U)
+    {
+        mid += (uint16_t)va[0] * vb[3];
+    }
+    if ((va[1] && vb[2]) != 0U)
+    {
+        mid += (uint16_t)va[1] * vb[2];
+    }
+    if ((va[2] && vb[1]) != 0U)
+    {
+        mid += (uint16_t)va[2] * vb[1];
+    }
+    if ((va[3] && vb[0]) != 0U)
+    {
+        mid += (uint16_t)va[3] * vb[0];
+    }
+
+#ifndef FIXMATH_NO_OVERFLOW
+    if (mid & 0xFF000000U)
+    {
+        return (fix16_overflow_raise());
+    }
+#endif
+    mid <<= 8;
+
+    // i = 2
+    if ((va[0] && vb[2]) != 0U)
+    {
+        mid += (uint16_t)va[0] * vb[2];
+    }
+    if ((va[1] && vb[1]) != 0U)
+    {
+        mid += (uint16_t)va[1] * vb[1];
+    }
+    if ((va[2] && vb[0]) != 0U)
+    {
+        mid += (uint16_t)va[2] * vb[0];
+    }
+
+    // i = 1
+    if ((va[0] && vb[1]) != 0U)
+    {
+        low += (uint16_t)va[0] * vb[1];
+    }
+    if ((va[1] && vb[0]) != 0U)
+    {
+        low += (uint16_t)va[1] * vb[0];
+    }
+    low <<= 8;
+
+    // i = 0
+    if ((va[0] && vb[0]) != 0U)
+    {
+        low += (uint16_t)va[0] * vb[0];
+    }
+#ifndef FIXMATH_NO_ROUNDING
+    low += 0x8000;
+#endif
+    mid += (low >> 16U);
+
+#ifndef FIXMATH_NO_OVERFLOW
+    if (mid & 0x80000000U)
+    {
+        return (fix16_overflow_raise());
+    }
+#endif
+
+    fix16_t result = mid;
+
+    /* Figure out the sign of result */
+    if ((inArg0 >= 0) != (inArg1 >= 0))
+    {
+        result = -result;
+    }
+
+    return (result);
+}
+#endif
+
+#ifndef FIXMATH_NO_OVERFLOW
+/* Saturating fix16_mul, the sign of the exact product selects the limit. */
+FIXMATH_INLINE_API fix16_t fix16_smul(fix16_t inArg0, fix16_t inArg1)
+{
+#ifndef FIXMATH_OPTIMIZE_8BIT
+    uint32_t ovf;
+    uint32_t result = fix16_mul_checked(inArg0, inArg1, &ovf);
+
+    return (fix16_saturate_if(result, ovf, (uint32_t)(inArg0 ^ inArg1)));
+#else
+    // The 8-bit fix16_mul returns early on overflow, and also for a product
+    // of -2^31, which saturates to the same value.
+    fix16_t result = fix16_mul(inArg0, inArg1);
+
+    return (fix16_saturate_select((uint32_t)result, result == fix16_overflow,
+                                  (uint32_t)(inArg0 ^ inArg1)));
+#endif
+}
+#endif
+
+/* 32-bit implementation of fix16_div. Fastest version for e.g. ARM Cortex M3.
+ * Performs 32-bit divisions repeatedly to reduce the remainder. For this to
+ * be efficient, the processor has to have 32-bit hardware division.
+ */
+#if !defined(FIXMATH_NO_HARD_DIVISION) && !defined(FIXMATH_FAST_DIV)
+// Count leading zeros, using processor-specific instruction if available.
+static inline uint8_t fix16_clz(uint32_t x)
+{
+#ifdef __GNUC__
+    return ((uint8_t)(__builtin_clzl(x) - (8 * sizeof(long) - 32)));
+#else
+    uint8_t result = 0;
+    if (x == 0U)
+    {
+        return (32U);
+    }
+
+    while (!(x & 0xF0000000U))
+    {
+        result += 4U;
+        x <<= 4U;
+    }
+
+    while (!(x & 0x80000000U))
+    {
+        result += 1U;
+        x <<= 1U;
+    }
+
+    return (result);
+#endif
+}
+
+FIXMATH_INLINE_API fix16_t fix16_div(fix16_t a, fix16_t b)
+{
+    // This uses a hardware 32/32 bit division multiple times, until we have
+    // computed all the bits in (a<<17)/b. Usually this takes 1-3 iterations.
+
+    if (b == 0)
+    {
+        return (fix16_overflow_raise());
+    }
+
+    uint32_t remainder = fix_abs(a);
+    uint32_t divider   = fix_abs(b);
+    uint64_t quotient  = 0;
+    int      bit_pos   = 17;
+
+    // Kick-start the division a bit.
+    // This improves speed in the worst-case scenarios where N and D are large
+    // It gets a lower estimate for the result by N/(D >> 17U + 1).
+    if (divider & 0xFFF00000U)
+    {
+        uint32_t shifted_div = ((divider >> 17U) + 1);
+        quotient             = remainder / shifted_div;
+        uint64_t tmp         = ((uint64_t)quotient * (uint64_t)divider) >> 17U;
+        remainder -= (uint32_t)(tmp);
+    }
+
+    // If the divider is divisible by 2^n, take advantage of it.
+    while (!(divider & 0xF) && bit_pos >= 4)
+    {
+        divider >>= 4;
+        bit_pos -= 4;
+    }
+
+    while (remainder && bit_pos >= 0)
+    {
+        // Shift remainder as much as we can without overflowing
+        int shift = fix16_clz(remainder);
+        if (shift > bit_pos)
+        {
+            shift = bit_pos;
+        }
+        remainder <<= shift;
+        bit_pos -= shift;
+
+        uint32_t div = remainder / divider;
+        remainder    = remainder % divider;
+        quotient += (uint64_t)div << bit_pos;
+
+#ifndef FIXMATH_NO_OVERFLOW
+        if (div & ~(0xFFFFFFFFU >> bit_pos))
+        {
+            return (fix16_overflow_raise());
+        }
+#endif
+
+        remainder <<= 1;
+        bit_pos--;
+    }
+
+    // The kick-start subtracts a truncated product, which can leave the
+    // quotient 1 above (a<<17)/b. Check it against the exact product.
+    if ((fix_abs(b) & 0xFFF00000U) &&
+        ((quotient * fix_abs(b)) > ((uint64_t)fix_abs(a) << 17U)))
+    {
+        quotient--;
+    }
+
+#ifndef FIXMATH_NO_ROUNDING
+    // Quotient is always positive so rounding is easy
+    quotient++;
+#endif
+
+    fix16_t result = quotient >> 1U;
+
+    // Figure out the sign of the result
+    if ((a ^ b) & 0x80000000U)
+    {
+#ifndef FIXMATH_NO_OVERFLOW
+        if (result == fix16_minimum)
+        {
+            return (fix16_overflow_raise());
+        }
+#endif
+
+        result = -result;
+    }
+
+    return (result);
+}
+#endif /* !defined(FIXMATH_NO_HARD_DIVISION) && !defined(FIXMATH_FAST_DIV) */
+
+/* Alternative 32-bit implementation of fix16_div. Fastest on e.g. Atmel AVR.
+ * This does the division manually, and is therefore good for processors that
+ * do not have hardware division.
+ */
+#if defined(FIXMATH_NO_HARD_DIVISION) && !defined(FIXMATH_FAST_DIV)
+FIXMATH_INLINE_API fix16_t fix16_div(fix16_t a, fix16_t b)
+{
+    // This uses the basic binary restoring division algorithm.
+    // It appears to be faster to do the whole division manually than
+    // trying to compose a 64-bit divide out of 32-bit divisions on
+    // platforms without hardware divide.
+
+    fix16_t retval;
+    if (b != 0)
+    {
+        uint32_t remainder = fix_abs(a);
+        uint32_t divider   = fix_abs(b);
+
+        uint32_t quotient  = 0U;
+        uint32_t bit       = 0x10000U;
+
+        /* The algorithm requires D >= R */
+        while (divider < remainder)
+        {
+            divider <<= 1;
+            bit <<= 1;
+        }
+
+#ifndef FIXMATH_NO_OVERFLOW
+        if (!bit)
+        {
+            return (fix16_overflow_raise());
+        }
+#endif
+
+        if ((divider & 0x80000000U) != 0U)
+        {
+            // Perform one step manually to avoid overflows later.
+            // We know that divider's bottom bit is 0 here.
+            if (remainder >= divider)
+            {
+                quotient |= bit;
+                remainder -= divider;
+            }
+            divider >>= 1;
+            bit >>= 1;
+        }
+
+        /* Main division loop */
+        while (bit && remainder)
+        {
+            if (remainder >= divider)
+            {
+                quotient |= bit;
+                remainder -= divider;
+            }
+
+            remainder <<= 1;
+            bit >>= 1;
+        }
+
+#ifndef FIXMATH_NO_ROUNDING
+        if (remainder >= divider)
+        {
+            quotient++;
+        }
+#endif
+
+        fix16_t result = (fix16_t)quotient;
+
+        /* Figure out the sign of result */
+        if (((a ^ b) & (fix16_t)0x80000000U) != 0)
+        {
+#ifndef FIXMATH_NO_OVERFLOW
+            if (result == fix16_minimum)
+            {
+                return (fix16_overflow_raise());
+            }
+#endif
+
+            result = -result;
+        }
+
+        retval = result;
+    }
+    else
+    {
+        retval = fix16_overflow_raise();
+    }
+
+    return (retval);
+}
+#endif /* defined(FIXMATH_NO_HARD_DIVISION) && !defined(FIXMATH_FAST_DIV) */
+
+#ifndef FIXMATH_NO_OVERFLOW
+/* Wrapper around fix16_div to add saturating arithmetic. */
+FIXMATH_INLINE_API fix16_t fix16_sdiv(fix16_t inArg0, fix16_t inArg1)
+{
+    // fix16_div has already recorded the overflow. A quotient of exactly
+    // fix16_minimum saturates to itself.
+    fix16_t result = fix16_div(inArg0, inArg1);
+
+    return (fix16_saturate_select((uint32_t)result, result == fix16_overflow,
+                                  (uint32_t)(inArg0 ^ inArg1)));
+}
+#endif
+
+#endif
@@ -0,0 +1,408 @@
+#ifndef fix16_trig_sin_lut_small_h__
+#define fix16_trig_sin_lut_small_h__
+
+/* Generated by utils/fixsingen, see FIXMATH_SIN_LUT_BITS. */
+
+#if FIXMATH_SIN_LUT_BITS == 8
+static const fix16_t _fix16_sin_lut_small[258] = {
+        0,   402,   804,  1206,  1608,  2010,  2412,  2814,  3216,  3617,
+     4019,  4420,  4821,  5222,  5623,  6023,  6424,  6824,  7224,  7623,
+     8022,  8421,  8820,  9218,  9616, 10014, 10411, 10808, 11204, 11600,
+    11996, 12391, 12785, 13180, 13573, 13966, 14359, 14751, 15143, 15534,
+    15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639, 19024, 19409,
+    19792, 20175, 20557, 20939, 21320, 21699, 22078, 22457, 22834, 23210,
+    23586, 23961, 24335, 24708, 25080, 25451, 25821, 26190, 26558, 26925,
+    27291, 27656, 28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538,
+    30893, 31248, 31600, 31952, 32303, 32652, 33000, 33347, 33692, 34037,
+    34380, 34721, 35062, 35401, 35738, 36075, 36410, 36744, 37076, 37407,
+    37736, 38064, 38391, 38716, 39040, 39362, 39683, 40002, 40320, 40636,
+    40951, 41264, 41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+    44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056, 46341, 46624,
+    46906, 47186, 47464, 47741, 48015, 48288, 48559, 48828, 49095, 49361,
+    49624, 49886, 50146, 50404, 50660, 50914, 51166, 51417, 51665, 51911,
+    52156, 52398, 52639, 52878, 53114, 53349, 53581, 53812, 54040, 54267,
+    54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004, 56212, 56418,
+    56621, 56823, 57022, 57219, 57414, 57607, 57798, 57986, 58172, 58356,
+    58538, 58718, 58896, 59071, 59244, 59415, 59583, 59750, 59914, 60075,
+    60235, 60392, 60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568,
+    61705, 61839, 61971, 62101, 62228, 62353, 62476, 62596, 62714, 62830,
+    62943, 63054, 63162, 63268, 63372, 63473, 63572, 63668, 63763, 63854,
+    63944, 64031, 64115, 64197, 64277, 64354, 64429, 64501, 64571, 64639,
+    64704, 64766, 64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+    65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436, 65457, 65476,
+    65492, 65505, 65516, 65525, 65531, 65535, 65536, 65536,
+};
+#elif FIXMATH_SIN_LUT_BITS == 9
+static const fix16_t _fix16_sin_lut_small[514] = {
+        0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,
+     2010,  2211,  2412,  2613,  2814,  3015,  3216,  3417,  3617,  3818,
+     4019,  4219,  4420,  4621,  4821,  5022,  5222,  5422,  5623,  5823,
+     6023,  6224,  6424,  6624,  6824,  7024,  7224,  7423,  7623,  7823,
+     8022,  8222,  8421,  8621,  8820,  9019,  9218,  9417,  9616,  9815,
+    10014, 10212, 10411, 10609, 10808, 11006, 11204, 11402, 11600, 11798,
+    11996, 12193, 12391, 12588, 12785, 12983, 13180, 13376, 13573, 13770,
+    13966, 14163, 14359, 14555, 14751, 14947, 15143, 15338, 15534, 15729,
+    15924, 16119, 16314, 16508, 16703, 16897, 17091, 17285, 17479, 17673,
+    17867, 18060, 18253, 18446, 18639, 18832, 19024, 19216, 19409, 19600,
+    19792, 19984, 20175, 20366, 20557, 20748, 20939, 21129, 21320, 21510,
+    21699, 21889, 22078, 22268, 22457, 22645, 22834, 23022, 23210, 23398,
+    23586, 23774, 23961, 24148, 24335, 24521, 24708, 24894, 25080, 25265,
+    25451, 25636, 25821, 26005, 26190, 26374, 26558, 26742, 26925, 27108,
+    27291, 27474, 27656, 27838, 28020, 28202, 28383, 28564, 28745, 28926,
+    29106, 29286, 29466, 29645, 29824, 30003, 30182, 30360, 30538, 30716,
+    30893, 31071, 31248, 31424, 31600, 31776, 31952, 32127, 32303, 32477,
+    32652, 32826, 33000, 33173, 33347, 33520, 33692, 33865, 34037, 34208,
+    34380, 34551, 34721, 34892, 35062, 35231, 35401, 35570, 35738, 35907,
+    36075, 36243, 36410, 36577, 36744, 36910, 37076, 37241, 37407, 37572,
+    37736, 37900, 38064, 38228, 38391, 38554, 38716, 38878, 39040, 39201,
+    39362, 39523, 39683, 39843, 40002, 40161, 40320, 40478, 40636, 40794,
+    40951, 41108, 41264, 41420, 41576, 41731, 41886, 42040, 42194, 42348,
+    42501, 42654, 42806, 42958, 43110, 43261, 43412, 43562, 43713, 43862,
+    44011, 44160, 44308, 44456, 44604, 44751, 44898, 45044, 45190, 45335,
+    45480, 45625, 45769, 45912, 46056, 46199, 46341, 46483, 46624, 46765,
+    46906, 47046, 47186, 47325, 47464, 47603, 47741, 47878, 48015, 48152,
+    48288, 48424, 48559, 48694, 48828, 48962, 49095, 49228, 49361, 49493,
+    49624, 49756, 49886, 50016, 50146, 50275, 50404, 50532, 50660, 50787,
+    50914, 51041, 51166, 51292, 51417, 51541, 51665, 51789, 51911, 52034,
+    52156, 52277, 52398, 52519, 52639, 52759, 52878, 52996, 53114, 53232,
+    53349, 53465, 53581, 53697, 53812, 53926, 54040, 54154, 54267, 54379,
+    54491, 54603, 54714, 54824, 54934, 55043, 55152, 55260, 55368, 55476,
+    55582, 55689, 55794, 55900, 56004, 56108, 56212, 56315, 56418, 56520,
+    56621, 56722, 56823, 56923, 57022, 57121, 57219, 57317, 57414, 57511,
+    57607, 57703, 57798, 57892, 57986, 58079, 58172, 58265, 58356, 58448,
+    58538, 58628, 58718, 58807, 58896, 58983, 59071, 59158, 59244, 59330,
+    59415, 59499, 59583, 59667, 59750, 59832, 59914, 59995, 60075, 60156,
+    60235, 60314, 60392, 60470, 60547, 60624, 60700, 60776, 60851, 60925,
+    60999, 61072, 61145, 61217, 61288, 61359, 61429, 61499, 61568, 61637,
+    61705, 61772, 61839, 61906, 61971, 62036, 62101, 62165, 62228, 62291,
+    62353, 62415, 62476, 62536, 62596, 62655, 62714, 62772, 62830, 62886,
+    62943, 62998, 63054, 63108, 63162, 63215, 63268, 63320, 63372, 63423,
+    63473, 63523, 63572, 63621, 63668, 63716, 63763, 63809, 63854, 63899,
+    63944, 63987, 64031, 64073, 64115, 64156, 64197, 64237, 64277, 64316,
+    64354, 64392, 64429, 64465, 64501, 64536, 64571, 64605, 64639, 64672,
+    64704, 64735, 64766, 64797, 64827, 64856, 64884, 64912, 64940, 64967,
+    64993, 65018, 65043, 65067, 65091, 65114, 65137, 65159, 65180, 65200,
+    65220, 65240, 65259, 65277, 65294, 65311, 65328, 65343, 65358, 65373,
+    65387, 65400, 65413, 65425, 65436, 65447, 65457, 65467, 65476, 65484,
+    65492, 65499, 65505, 65511, 65516, 65521, 65525, 65528, 65531, 65533,
+    65535, 65536, 65536, 65536,
+};
+#elif FIXMATH_SIN_LUT_BITS == 10
+static const fix16_t _fix16_sin_lut_small[1026] = {
+        0,   101,   201,   302,   402,   503,   603,   704,   804,   905,
+     1005,  1106,  1206,  1307,  1407,  1508,  1608,  1709,  1809,  1910,
+     2010,  2111,  2211,  2312,  2412,  2513,  2613,  2714,  2814,  2914,
+     3015,  3115,  3216,  3316,  3417,  3517,  3617,  3718,  3818,  3918,
+     4019,  4119,  4219,  4320,  4420,  4520,  4621,  4721,  4821,  4921,
+     5022,  5122,  5222,  5322,  5422,  5523,  5623,  5723,  5823,  5923,
+     6023,  6123,  6224,  6324,  6424,  6524,  6624,  6724,  6824,  6924,
+     7024,  7124,  7224,  7323,  7423,  7523,  7623,  7723,  7823,  7923,
+     8022,  8122,  8222,  8322,  8421,  8521,  8621,  8720,  8820,  8919,
+     9019,  9119,  9218,  9318,  9417,  9517,  9616,  9716,  9815,  9914,
+    10014, 10113, 10212, 10312, 10411, 10510, 10609, 10709, 10808, 10907,
+    11006, 11105, 11204, 11303, 11402, 11501, 11600, 11699, 11798, 11897,
+    11996, 12095, 12193, 12292, 12391, 12490, 12588, 12687, 12785, 12884,
+    12983, 13081, 13180, 13278, 13376, 13475, 13573, 13672, 13770, 13868,
+    13966, 14065, 14163, 14261, 14359, 14457, 14555, 14653, 14751, 14849,
+    14947, 15045, 15143, 15240, 15338, 15436, 15534, 15631, 15729, 15826,
+    15924, 16021, 16119, 16216, 16314, 16411, 16508, 16606, 16703, 16800,
+    16897, 16994, 17091, 17188, 17285, 17382, 17479, 17576, 17673, 17770,
+    17867, 17963, 18060, 18156, 18253, 18350, 18446, 18543, 18639, 18735,
+    18832, 18928, 19024, 19120, 19216, 19313, 19409, 19505, 19600, 19696,
+    19792, 19888, 19984, 20080, 20175, 20271, 20366, 20462, 20557, 20653,
+    20748, 20844, 20939, 21034, 21129, 21224, 21320, 21415, 21510, 21604,
+    21699, 21794, 21889, 21984, 22078, 22173, 22268, 22362, 22457, 22551,
+    22645, 22740, 22834, 22928, 23022, 23116, 23210, 23304, 23398, 23492,
+    23586, 23680, 23774, 23867, 23961, 24054, 24148, 24241, 24335, 24428,
+    24521, 24614, 24708, 24801, 24894, 24987, 25080, 25172, 25265, 25358,
+    25451, 25543, 25636, 25728, 25821, 25913, 26005, 26098, 26190, 26282,
+    26374, 26466, 26558, 26650, 26742, 26833, 26925, 27017, 27108, 27200,
+    27291, 27382, 27474, 27565, 27656, 27747, 27838, 27929, 28020, 28111,
+    28202, 28293, 28383, 28474, 28564, 28655, 28745, 28835, 28926, 29016,
+    29106, 29196, 29286, 29376, 29466, 29555, 29645, 29735, 29824, 29914,
+    30003, 30093, 30182, 30271, 30360, 30449, 30538, 30627, 30716, 30805,
+    30893, 30982, 31071, 31159, 31248, 31336, 31424, 31512, 31600, 31688,
+    31776, 31864, 31952, 32040, 32127, 32215, 32303, 32390, 32477, 32565,
+    32652, 32739, 32826, 32913, 33000, 33087, 33173, 33260, 33347, 33433,
+    33520, 33606, 33692, 33778, 33865, 33951, 34037, 34122, 34208, 34294,
+    34380, 34465, 34551, 34636, 34721, 34806, 34892, 34977, 35062, 35146,
+    35231, 35316, 35401, 35485, 35570, 35654, 35738, 35823, 35907, 35991,
+    36075, 36159, 36243, 36326, 36410, 36493, 36577, 36660, 36744, 36827,
+    36910, 36993, 37076, 37159, 37241, 37324, 37407, 37489, 37572, 37654,
+    37736, 37818, 37900, 37982, 38064, 38146, 38228, 38309, 38391, 38472,
+    38554, 38635, 38716, 38797, 38878, 38959, 39040, 39120, 39201, 39282,
+    39362, 39442, 39523, 39603, 39683, 39763, 39843, 39922, 40002, 40082,
+    40161, 40241, 40320, 40399, 40478, 40557, 40636, 40715, 40794, 40872,
+    40951, 41029, 41108, 41186, 41264, 41342, 41420, 41498, 41576, 41653,
+    41731, 41808, 41886, 41963, 42040, 42117, 42194, 42271, 42348, 42424,
+    42501, 42578, 42654, 42730, 42806, 42882, 42958, 43034, 43110, 43186,
+    43261, 43337, 43412, 43487, 43562, 43638, 43713, 43787, 43862, 43937,
+    44011, 44086, 44160, 44234, 44308, 44382, 44456, 44530, 44604, 44677,
+    44751, 44824, 44898, 44971, 45044, 45117, 45190, 45262, 45335, 45408,
+    45480, 45552, 45625, 45697, 45769, 45841, 45912, 45984, 46056, 46127,
+    46199, 46270, 46341, 46412, 46483, 46554, 46624, 46695, 46765, 46836,
+    46906, 46976, 47046, 47116, 47186, 47256, 47325, 47395, 47464, 47534,
+    47603, 47672, 47741, 47809, 47878, 47947, 48015, 48084, 48152, 48220,
+    48288, 48356, 48424, 48491, 48559, 48626, 48694, 48761, 48828, 48895,
+    48962, 49029, 49095, 49162, 49228, 49295, 49361, 49427, 49493, 49559,
+    49624, 49690, 49756, 49821, 49886, 49951, 50016, 50081, 50146, 50211,
+    50275, 50340, 50404, 50468, 50532, 50596, 50660, 50724, 50787, 50851,
+    50914, 50977, 51041, 51104, 51166, 51229, 51292, 51354, 51417, 51479,
+    51541, 51603, 51665, 51727, 51789, 51850, 51911, 51973, 52034, 52095,
+    52156, 52217, 52277, 52338, 52398, 52459, 52519, 52579, 52639, 52699,
+    52759, 52818, 52878, 52937, 52996, 53055, 53114, 53173, 53232, 53290,
+    53349, 53407, 53465, 53523, 53581, 53639, 53697, 53754, 53812, 53869,
+    53926, 53983, 54040, 54097, 54154, 54210, 54267, 54323, 54379, 54435,
+    54491, 54547, 54603, 54658, 54714, 54769, 54824, 54879, 54934, 54989,
+    55043, 55098, 55152, 55206, 55260, 55314, 55368, 55422, 55476, 55529,
+    55582, 55636, 55689, 55742, 55794, 55847, 55900, 55952, 56004, 56056,
+    56108, 56160, 56212, 56264, 56315, 56367, 56418, 56469, 56520, 56571,
+    56621, 56672, 56722, 56773, 56823, 56873, 56923, 56972, 57022, 57072,
+    57121, 57170, 57219, 57268, 57317, 57366, 57414, 57463, 57511, 57559,
+    57607, 57655, 57703, 57750, 57798, 57845, 57892, 57939, 57986, 58033,
+    58079, 58126, 58172, 58219, 58265, 58311, 58356, 58402, 58448, 58493,
+    58538, 58583, 58628, 58673, 58718, 58763, 58807, 58851, 58896, 58940,
+    58983, 59027, 59071, 59114, 59158, 59201, 59244, 59287, 59330, 59372,
+    59415, 59457, 59499, 59541, 59583, 59625, 59667, 59708, 59750, 59791,
+    59832, 59873, 59914, 59954, 59995, 60035, 60075, 60116, 60156, 60195,
+    60235, 60275, 60314, 60353, 60392, 60431, 60470, 60509, 60547, 60586,
+    60624, 60662, 60700, 60738, 60776, 60813, 60851, 60888, 60925, 60962,
+    60999, 61035, 61072, 61108, 61145, 61181, 61217, 61253, 61288, 61324,
+    61359, 61394, 61429, 61464, 61499, 61534, 61568, 61603, 61637, 61671,
+    61705, 61739, 61772, 61806, 61839, 61873, 61906, 61939, 61971, 62004,
+    62036, 62069, 62101, 62133, 62165, 62197, 62228, 62260, 62291, 62322,
+    62353, 62384, 62415, 62445, 62476, 62506, 62536, 62566, 62596, 62626,
+    62655, 62685, 62714, 62743, 62772, 62801, 62830, 62858, 62886, 62915,
+    62943, 62971, 62998, 63026, 63054, 63081, 63108, 63135, 63162, 63189,
+    63215, 63242, 63268, 63294, 63320, 63346, 63372, 63397, 63423, 63448,
+    63473, 63498, 63523, 63547, 63572, 63596, 63621, 63645, 63668, 63692,
+    63716, 63739, 63763, 63786, 63809, 63832, 63854, 63877, 63899, 63922,
+    63944, 63966, 63987, 64009, 64031, 64052, 64073, 64094, 64115, 64136,
+    64156, 64177, 64197, 64217, 64237, 64257, 64277, 64296, 64316, 64335,
+    64354, 64373, 64392, 64410, 64429, 64447, 64465, 64483, 64501, 64519,
+    64536, 64554, 64571, 64588, 64605, 64622, 64639, 64655, 64672, 64688,
+    64704, 64720, 64735, 64751, 64766, 64782, 64797, 64812, 64827, 64841,
+    64856, 64870, 64884, 64899, 64912, 64926, 64940, 64953, 64967, 64980,
+    64993, 65006, 65018, 65031, 65043, 65055, 65067, 65079, 65091, 65103,
+    65114, 65126, 65137, 65148, 65159, 65169, 65180, 65190, 65200, 65210,
+    65220, 65230, 65240, 65249, 65259, 65268, 65277, 65286, 65294, 65303,
+    65311, 65320, 65328, 65336, 65343, 65351, 65358, 65366, 65373, 65380,
+    65387, 65393, 65400, 65406, 65413, 65419, 65425, 65430, 65436, 65442,
+    65447, 65452, 65457, 65462, 65467, 65471, 65476, 65480, 65484, 65488,
+    65492, 65495, 65499, 65502, 65505, 65508, 65511, 65514, 65516, 65519,
+    65521, 65523, 65525, 65527, 65528, 65530, 65531, 65532, 65533, 65534,
+    65535, 65535, 65536, 65536, 65536, 65536,
+};
+#elif FIXMATH_SIN_LUT_BITS == 11
+static const fix16_t _fix16_sin_lut_small[2050] = {
+        0,    50,   101,   151,   201,   251,   302,   352,   402,   452,
+      503,   553,   603,   653,   704,   754,   804,   854,   905,   955,
+     1005,  1056,  1106,  1156,  1206,  1257,  1307,  1357,  1407,  1458,
+     1508,  1558,  1608,  1659,  1709,  1759,  1809,  1860,  1910,  1960,
+     2010,  2061,  2111,  2161,  2211,  2261,  2312,  2362,  2412,  2462,
+     2513,  2563,  2613,  2663,  2714,  2764,  2814,  2864,  2914,  2965,
+     3015,  3065,  3115,  3165,  3216,  3266,  3316,  3366,  3417,  3467,
+     3517,  3567,  3617,  3667,  3718,  3768,  3818,  3868,  3918,  3969,
+     4019,  4069,  4119,  4169,  4219,  4270,  4320,  4370,  4420,  4470,
+     4520,  4570,  4621,  4671,  4721,  4771,  4821,  4871,  4921,  4972,
+     5022,  5072,  5122,  5172,  5222,  5272,  5322,  5372,  5422,  5473,
+     5523,  5573,  5623,  5673,  5723,  5773,  5823,  5873,  5923,  5973,
+     6023,  6073,  6123,  6173,  6224,  6274,  6324,  6374,  6424,  6474,
+     6524,  6574,  6624,  6674,  6724,  6774,  6824,  6874,  6924,  6974,
+     7024,  7074,  7124,  7174,  7224,  7273,  7323,  7373,  7423,  7473,
+     7523,  7573,  7623,  7673,  7723,  7773,  7823,  7873,  7923,  7972,
+     8022,  8072,  8122,  8172,  8222,  8272,  8322,  8371,  8421,  8471,
+     8521,  8571,  8621,  8670,  8720,  8770,  8820,  8870,  8919,  8969,
+     9019,  9069,  9119,  9168,  9218,  9268,  9318,  9367,  9417,  9467,
+     9517,  9566,  9616,  9666,  9716,  9765,  9815,  9865,  9914,  9964,
+    10014, 10063, 10113, 10163, 10212, 10262, 10312, 10361, 10411, 10461,
+    10510, 10560, 10609, 10659, 10709, 10758, 10808, 10857, 10907, 10956,
+    11006, 11056, 11105, 11155, 11204, 11254, 11303, 11353, 11402, 11452,
+    11501, 11551, 11600, 11650, 11699, 11749, 11798, 11847, 11897, 11946,
+    11996, 12045, 12095, 12144, 12193, 12243, 12292, 12341, 12391, 12440,
+    12490, 12539, 12588, 12638, 12687, 12736, 12785, 12835, 12884, 12933,
+    12983, 13032, 13081, 13130, 13180, 13229, 13278, 13327, 13376, 13426,
+    13475, 13524, 13573, 13622, 13672, 13721, 13770, 13819, 13868, 13917,
+    13966, 14016, 14065, 14114, 14163, 14212, 14261, 14310, 14359, 14408,
+    14457, 14506, 14555, 14604, 14653, 14702, 14751, 14800, 14849, 14898,
+    14947, 14996, 15045, 15094, 15143, 15192, 15240, 15289, 15338, 15387,
+    15436, 15485, 15534, 15582, 15631, 15680, 15729, 15778, 15826, 15875,
+    15924, 15973, 16021, 16070, 16119, 16168, 16216, 16265, 16314, 16362,
+    16411, 16460, 16508, 16557, 16606, 16654, 16703, 16751, 16800, 16849,
+    16897, 16946, 16994, 17043, 17091, 17140, 17188, 17237, 17285, 17334,
+    17382, 17431, 17479, 17528, 17576, 17625, 17673, 17721, 17770, 17818,
+    17867, 17915, 17963, 18012, 18060, 18108, 18156, 18205, 18253, 18301,
+    18350, 18398, 18446, 18494, 18543, 18591, 18639, 18687, 18735, 18783,
+    18832, 18880, 18928, 18976, 19024, 19072, 19120, 19168, 19216, 19264,
+    19313, 19361, 19409, 19457, 19505, 19553, 19600, 19648, 19696, 19744,
+    19792, 19840, 19888, 19936, 19984, 20032, 20080, 20127, 20175, 20223,
+    20271, 20319, 20366, 20414, 20462, 20510, 20557, 20605, 20653, 20701,
+    20748, 20796, 20844, 20891, 20939, 20987, 21034, 21082, 21129, 21177,
+    21224, 21272, 21320, 21367, 21415, 21462, 21510, 21557, 21604, 21652,
+    21699, 21747, 21794, 21842, 21889, 21936, 21984, 22031, 22078, 22126,
+    22173, 22220, 22268, 22315, 22362, 22409, 22457, 22504, 22551, 22598,
+    22645, 22693, 22740, 22787, 22834, 22881, 22928, 22975, 23022, 23069,
+    23116, 23163, 23210, 23257, 23304, 23351, 23398, 23445, 23492, 23539,
+    23586, 23633, 23680, 23727, 23774, 23820, 23867, 23914, 23961, 24008,
+    24054, 24101, 24148, 24195, 24241, 24288, 24335, 24381, 24428, 24475,
+    24521, 24568, 24614, 24661, 24708, 24754, 24801, 24847, 24894, 24940,
+    24987, 25033, 25080, 25126, 25172, 25219, 25265, 25312, 25358, 25404,
+    25451, 25497, 25543, 25589, 25636, 25682, 25728, 25774, 25821, 25867,
+    25913, 25959, 26005, 26051, 26098, 26144, 26190, 26236, 26282, 26328,
+    26374, 26420, 26466, 26512, 26558, 26604, 26650, 26696, 26742, 26787,
+    26833, 26879, 26925, 26971, 27017, 27062, 27108, 27154, 27200, 27245,
+    27291, 27337, 27382, 27428, 27474, 27519, 27565, 27611, 27656, 27702,
+    27747, 27793, 27838, 27884, 27929, 27975, 28020, 28066, 28111, 28156,
+    28202, 28247, 28293, 28338, 28383, 28429, 28474, 28519, 28564, 28610,
+    28655, 28700, 28745, 28790, 28835, 28881, 28926, 28971, 29016, 29061,
+    29106, 29151, 29196, 29241, 29286, 29331, 29376, 29421, 29466, 29511,
+    29555, 29600, 29645, 29690, 29735, 29780, 29824, 29869, 29914, 29959,
+    30003, 30048, 30093, 30137, 30182, 30226, 30271, 30316, 30360, 30405,
+    30449, 30494, 30538, 30583, 30627, 30672, 30716, 30760, 30805, 30849,
+    30893, 30938, 30982, 31026, 31071, 31115, 31159, 31203, 31248, 31292,
+    31336, 31380, 31424, 31468, 31512, 31556, 31600, 31644, 31688, 31732,
+    31776, 31820, 31864, 31908, 31952, 31996, 32040, 32084, 32127, 32171,
+    32215, 32259, 32303, 32346, 32390, 32434, 32477, 32521, 32565, 32608,
+    32652, 32695, 32739, 32783, 32826, 32870, 32913, 32956, 33000, 33043,
+    33087, 33130, 33173, 33217, 33260, 33303, 33347, 33390, 33433, 33476,
+    33520, 33563, 33606, 33649, 33692, 33735, 33778, 33821, 33865, 33908,
+    33951, 33994, 34037, 34079, 34122, 34165, 34208, 34251, 34294, 34337,
+    34380, 34422, 34465, 34508, 34551, 34593, 34636, 34679, 34721, 34764,
+    34806, 34849, 34892, 34934, 34977, 35019, 35062, 35104, 35146, 35189,
+    35231, 35274, 35316, 35358, 35401, 35443, 35485, 35527, 35570, 35612,
+    35654, 35696, 35738, 35781, 35823, 35865, 35907, 35949, 35991, 36033,
+    36075, 36117, 36159, 36201, 36243, 36284, 36326, 36368, 36410, 36452,
+    36493, 36535, 36577, 36619, 36660, 36702, 36744, 36785, 36827, 36868,
+    36910, 36951, 36993, 37034, 37076, 37117, 37159, 37200, 37241, 37283,
+    37324, 37365, 37407, 37448, 37489, 37530, 37572, 37613, 37654, 37695,
+    37736, 37777, 37818, 37859, 37900, 37941, 37982, 38023, 38064, 38105,
+    38146, 38187, 38228, 38269, 38309, 38350, 38391, 38432, 38472, 38513,
+    38554, 38594, 38635, 38675, 38716, 38757, 38797, 38838, 38878, 38919,
+    38959, 38999, 39040, 39080, 39120, 39161, 39201, 39241, 39282, 39322,
+    39362, 39402, 39442, 39482, 39523, 39563, 39603, 39643, 39683, 39723,
+    39763, 39803, 39843, 39882, 39922, 39962, 40002, 40042, 40082, 40121,
+    40161, 40201, 40241, 40280, 40320, 40359, 40399, 40439, 40478, 40518,
+    40557, 40597, 40636, 40675, 40715, 40754, 40794, 40833, 40872, 40912,
+    40951, 40990, 41029, 41068, 41108, 41147, 41186, 41225, 41264, 41303,
+    41342, 41381, 41420, 41459, 41498, 41537, 41576, 41614, 41653, 41692,
+    41731, 41770, 41808, 41847, 41886, 41924, 41963, 42002, 42040, 42079,
+    42117, 42156, 42194, 42233, 42271, 42309, 42348, 42386, 42424, 42463,
+    42501, 42539, 42578, 42616, 42654, 42692, 42730, 42768, 42806, 42844,
+    42882, 42920, 42958, 42996, 43034, 43072, 43110, 43148, 43186, 43223,
+    43261, 43299, 43337, 43374, 43412, 43450, 43487, 43525, 43562, 43600,
+    43638, 43675, 43713, 43750, 43787, 43825, 43862, 43899, 43937, 43974,
+    44011, 44049, 44086, 44123, 44160, 44197, 44234, 44271, 44308, 44345,
+    44382, 44419, 44456, 44493, 44530, 44567, 44604, 44641, 44677, 44714,
+    44751, 44788, 44824, 44861, 44898, 44934, 44971, 45007, 45044, 45080,
+    45117, 45153, 45190, 45226, 45262, 45299, 45335, 45371, 45408, 45444,
+    45480, 45516, 45552, 45589, 45625, 45661, 45697, 45733, 45769, 45805,
+    45841, 45877, 45912, 45948, 45984, 46020, 46056, 46091, 46127, 46163,
+    46199, 46234, 46270, 46305, 46341, 46376, 46412, 46447, 46483, 46518,
+    46554, 46589, 46624, 46660, 46695, 46730, 46765, 46801, 46836, 46871,
+    46906, 46941, 46976, 47011, 47046, 47081, 47116, 47151, 47186, 47221,
+    47256, 47291, 47325, 47360, 47395, 47430, 47464, 47499, 47534, 47568,
+    47603, 47637, 47672, 47706, 47741, 47775, 47809, 47844, 47878, 47912,
+    47947, 47981, 48015, 48049, 48084, 48118, 48152, 48186, 48220, 48254,
+    48288, 48322, 48356, 48390, 48424, 48458, 48491, 48525, 48559, 48593,
+    48626, 48660, 48694, 48727, 48761, 48795, 48828, 48862, 48895, 48929,
+    48962, 48995, 49029, 49062, 49095, 49129, 49162, 49195, 49228, 49262,
+    49295, 49328, 49361, 49394, 49427, 49460, 49493, 49526, 49559, 49592,
+    49624, 49657, 49690, 49723, 49756, 49788, 49821, 49854, 49886, 49919,
+    49951, 49984, 50016, 50049, 50081, 50114, 50146, 50178, 50211, 50243,
+    50275, 50307, 50340, 50372, 50404, 50436, 50468, 50500, 50532, 50564,
+    50596, 50628, 50660, 50692, 50724, 50756, 50787, 50819, 50851, 50882,
+    50914, 50946, 50977, 51009, 51041, 51072, 51104, 51135, 51166, 51198,
+    51229, 51260, 51292, 51323, 51354, 51386, 51417, 51448, 51479, 51510,
+    51541, 51572, 51603, 51634, 51665, 51696, 51727, 51758, 51789, 51819,
+    51850, 51881, 51911, 51942, 51973, 52003, 52034, 52065, 52095, 52126,
+    52156, 52186, 52217, 52247, 52277, 52308, 52338, 52368, 52398, 52429,
+    52459, 52489, 52519, 52549, 52579, 52609, 52639, 52669, 52699, 52729,
+    52759, 52788, 52818, 52848, 52878, 52907, 52937, 52967, 52996, 53026,
+    53055, 53085, 53114, 53144, 53173, 53202, 53232, 53261, 53290, 53319,
+    53349, 53378, 53407, 53436, 53465, 53494, 53523, 53552, 53581, 53610,
+    53639, 53668, 53697, 53726, 53754, 53783, 53812, 53840, 53869, 53898,
+    53926, 53955, 53983, 54012, 54040, 54069, 54097, 54125, 54154, 54182,
+    54210, 54239, 54267, 54295, 54323, 54351, 54379, 54407, 54435, 54463,
+    54491, 54519, 54547, 54575, 54603, 54630, 54658, 54686, 54714, 54741,
+    54769, 54796, 54824, 54852, 54879, 54906, 54934, 54961, 54989, 55016,
+    55043, 55071, 55098, 55125, 55152, 55179, 55206, 55233, 55260, 55288,
+    55314, 55341, 55368, 55395, 55422, 55449, 55476, 55502, 55529, 55556,
+    55582, 55609, 55636, 55662, 55689, 55715, 55742, 55768, 55794, 55821,
+    55847, 55873, 55900, 55926, 55952, 55978, 56004, 56030, 56056, 56082,
+    56108, 56134, 56160, 56186, 56212, 56238, 56264, 56289, 56315, 56341,
+    56367, 56392, 56418, 56443, 56469, 56494, 56520, 56545, 56571, 56596,
+    56621, 56647, 56672, 56697, 56722, 56747, 56773, 56798, 56823, 56848,
+    56873, 56898, 56923, 56948, 56972, 56997, 57022, 57047, 57072, 57096,
+    57121, 57145, 57170, 57195, 57219, 57244, 57268, 57293, 57317, 57341,
+    57366, 57390, 57414, 57438, 57463, 57487, 57511, 57535, 57559, 57583,
+    57607, 57631, 57655, 57679, 57703, 57726, 57750, 57774, 57798, 57821,
+    57845, 57869, 57892, 57916, 57939, 57963, 57986, 58009, 58033, 58056,
+    58079, 58103, 58126, 58149, 58172, 58195, 58219, 58242, 58265, 58288,
+    58311, 58334, 58356, 58379, 58402, 58425, 58448, 58470, 58493, 58516,
+    58538, 58561, 58583, 58606, 58628, 58651, 58673, 58696, 58718, 58740,
+    58763, 58785, 58807, 58829, 58851, 58873, 58896, 58918, 58940, 58962,
+    58983, 59005, 59027, 59049, 59071, 59093, 59114, 59136, 59158, 59179,
+    59201, 59222, 59244, 59265, 59287, 59308, 59330, 59351, 59372, 59393,
+    59415, 59436, 59457, 59478, 59499, 59520, 59541, 59562, 59583, 59604,
+    59625, 59646, 59667, 59687, 59708, 59729, 59750, 59770, 59791, 59811,
+    59832, 59852, 59873, 59893, 59914, 59934, 59954, 59975, 59995, 60015,
+    60035, 60055, 60075, 60096, 60116, 60136, 60156, 60175, 60195, 60215,
+    60235, 60255, 60275, 60294, 60314, 60334, 60353, 60373, 60392, 60412,
+    60431, 60451, 60470, 60490, 60509, 60528, 60547, 60567, 60586, 60605,
+    60624, 60643, 60662, 60681, 60700, 60719, 60738, 60757, 60776, 60794,
+    60813, 60832, 60851, 60869, 60888, 60906, 60925, 60943, 60962, 60980,
+    60999, 61017, 61035, 61054, 61072, 61090, 61108, 61127, 61145, 61163,
+    61181, 61199, 61217, 61235, 61253, 61270, 61288, 61306, 61324, 61341,
+    61359, 61377, 61394, 61412, 61429, 61447, 61464, 61482, 61499, 61517,
+    61534, 61551, 61568, 61586, 61603, 61620, 61637, 61654, 61671, 61688,
+    61705, 61722, 61739, 61756, 61772, 61789, 61806, 61823, 61839, 61856,
+    61873, 61889, 61906, 61922, 61939, 61955, 61971, 61988, 62004, 62020,
+    62036, 62053, 62069, 62085, 62101, 62117, 62133, 62149, 62165, 62181,
+    62197, 62212, 62228, 62244, 62260, 62275, 62291, 62307, 62322, 62338,
+    62353, 62369, 62384, 62400, 62415, 62430, 62445, 62461, 62476, 62491,
+    62506, 62521, 62536, 62551, 62566, 62581, 62596, 62611, 62626, 62641,
+    62655, 62670, 62685, 62699, 62714, 62729, 62743, 62758, 62772, 62787,
+    62801, 62815, 62830, 62844, 62858, 62872, 62886, 62901, 62915, 62929,
+    62943, 62957, 62971, 62985, 62998, 63012, 63026, 63040, 63054, 63067,
+    63081, 63095, 63108, 63122, 63135, 63149, 63162, 63175, 63189, 63202,
+    63215, 63229, 63242, 63255, 63268, 63281, 63294, 63307, 63320, 63333,
+    63346, 63359, 63372, 63385, 63397, 63410, 63423, 63435, 63448, 63461,
+    63473, 63486, 63498, 63510, 63523, 63535, 63547, 63560, 63572, 63584,
+    63596, 63608, 63621, 63633, 63645, 63657, 63668, 63680, 63692, 63704,
+    63716, 63728, 63739, 63751, 63763, 63774, 63786, 63797, 63809, 63820,
+    63832, 63843, 63854, 63866, 63877, 63888, 63899, 63910, 63922, 63933,
+    63944, 63955, 63966, 63976, 63987, 63998, 64009, 64020, 64031, 64041,
+    64052, 64062, 64073, 64084, 64094, 64105, 64115, 64125, 64136, 64146,
+    64156, 64167, 64177, 64187, 64197, 64207, 64217, 64227, 64237, 64247,
+    64257, 64267, 64277, 64287, 64296, 64306, 64316, 64325, 64335, 64344,
+    64354, 64363, 64373, 64382, 64392, 64401, 64410, 64420, 64429, 64438,
+    64447, 64456, 64465, 64474, 64483, 64492, 64501, 64510, 64519, 64528,
+    64536, 64545, 64554, 64563, 64571, 64580, 64588, 64597, 64605, 64614,
+    64622, 64630, 64639, 64647, 64655, 64663, 64672, 64680, 64688, 64696,
+    64704, 64712, 64720, 64728, 64735, 64743, 64751, 64759, 64766, 64774,
+    64782, 64789, 64797, 64804, 64812, 64819, 64827, 64834, 64841, 64849,
+    64856, 64863, 64870, 64877, 64884, 64892, 64899, 64905, 64912, 64919,
+    64926, 64933, 64940, 64947, 64953, 64960, 64967, 64973, 64980, 64986,
+    64993, 64999, 65006, 65012, 65018, 65025, 65031, 65037, 65043, 65049,
+    65055, 65061, 65067, 65073, 65079, 65085, 65091, 65097, 65103, 65109,
+    65114, 65120, 65126, 65131, 65137, 65142, 65148, 65153, 65159, 65164,
+    65169, 65175, 65180, 65185, 65190, 65195, 65200, 65205, 65210, 65215,
+    65220, 65225, 65230, 65235, 65240, 65245, 65249, 65254, 65259, 65263,
+    65268, 65272, 65277, 65281, 65286, 65290, 65294, 65299, 65303, 65307,
+    65311, 65315, 65320, 65324, 65328, 65332, 65336, 65339, 65343, 65347,
+    65351, 65355, 65358, 65362, 65366, 65369, 65373, 65376, 65380, 65383,
+    65387, 65390, 65393, 65397, 65400, 65403, 65406, 65410, 65413, 65416,
+    65419, 65422, 65425, 65428, 65430, 65433, 65436, 65439, 65442, 65444,
+    65447, 65449, 65452, 65455, 65457, 65460, 65462, 65464, 65467, 65469,
+    65471, 65473, 65476, 65478, 65480, 65482, 65484, 65486, 65488, 65490,
+    65492, 65493, 65495, 65497, 65499, 65500, 65502, 65504, 65505, 65507,
+    65508, 65510, 65511, 65512, 65514, 65515, 65516, 65517, 65519, 65520,
+    65521, 65522, 65523, 65524, 65525, 65526, 65527, 65527, 65528, 65529,
+    65530, 65530, 65531, 65532, 65532, 65533, 65533, 65534, 65534, 65534,
+    65535, 65535, 65535, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+};
+#else
+#error "No table for FIXMATH_SIN_LUT_BITS, run utils/fixsingen with it"
+#endif
+
+#endif
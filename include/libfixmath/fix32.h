@@ -0,0 +1,190 @@
+#ifndef libfixmath_fix32_h__
+#define libfixmath_fix32_h__
+
+#include "fix16.h"
+#include "int64.h"
+
+#ifdef __KERNEL__
+#include <linux/types.h>
+#else
+#include <stddef.h>
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Q32.32 fixed point numbers for paths that need more range or precision
+     * than fix16_t, from -2^31 to 2^31 - 2^-32 in steps of 2^-32.
+     *
+     * fix32_t is the int64_t of int64.h, so it is the _int64_t emulation
+     * under FIXMATH_NO_64BIT, and the int64_* functions compare and convert
+     * it. Multiplication, division and the square root need 128 bit
+     * intermediates, which use unsigned __int128 where the compiler has it
+     * and 32-bit limbs otherwise. Both give the same results.
+     *
+     * Overflow and rounding follow FIXMATH_NO_OVERFLOW, FIXMATH_NO_ROUNDING
+     * and FIXMATH_STICKY_OVERFLOW as for fix16_t. Results are rounded on the
+     * magnitude, so halves round away from zero, and FIXMATH_NO_ROUNDING
+     * truncates them toward zero.
+     */
+
+    /** Q32.32 number, see above.
+     */
+    typedef int64_t fix32_t;
+
+/* Constant initializer for a fix32_t from its integer and fraction words. */
+#ifndef FIXMATH_NO_64BIT
+#define FIX32_C(hi, lo)                                                        \
+    ((int64_t)(((uint64_t)(uint32_t)(hi) << 32U) | (uint32_t)(lo)))
+#else
+#define FIX32_C(hi, lo) {(int32_t)(hi), (uint32_t)(lo)}
+#endif
+
+    static const fix32_t fix32_maximum =
+        FIX32_C(0x7FFFFFFF, 0xFFFFFFFFU); /**< the maximum value of fix32_t */
+    static const fix32_t fix32_minimum =
+        FIX32_C(0x80000000U, 0U); /**< the minimum value of fix32_t */
+    static const fix32_t fix32_overflow =
+        FIX32_C(0x80000000U, 0U); /**< the value used to indicate overflows
+                                     when FIXMATH_NO_OVERFLOW is not
+                                     specified */
+
+    static const fix32_t fix32_pi =
+        FIX32_C(3, 0x243F6A89U); /**< fix32_t value of pi */
+    static const fix32_t fix32_e =
+        FIX32_C(2, 0xB7E15163U); /**< fix32_t value of e */
+    static const fix32_t fix32_one = FIX32_C(1, 0U); /**< fix32_t value of 1 */
+    static const fix32_t fix32_eps = FIX32_C(0, 1U); /**< fix32_t epsilon */
+
+    /* Conversion functions. These are inlined to allow the compiler to
+     * optimize away constant numbers.
+     */
+    static inline fix32_t fix32_from_int(int32_t a)
+    {
+        return (int64_const(a, 0U));
+    }
+
+    /** Returns a rounded to the nearest integer, or rounded down with
+     * FIXMATH_NO_ROUNDING. The result must fit in an int32_t.
+     */
+    static inline int32_t fix32_to_int(fix32_t a)
+    {
+#ifndef FIXMATH_NO_ROUNDING
+        a = int64_add(a, int64_const(0, int64_hi(a) < 0 ? 0x7FFFFFFFU
+                                                         : 0x80000000U));
+#endif
+        return (int64_hi(a));
+    }
+
+    /** Exact conversion from fix16_t.
+     */
+    static inline fix32_t fix32_from_fix16(fix16_t a)
+    {
+        return (int64_const(a >> 16, (uint32_t)a << 16U));
+    }
+
+    /** Rounds to 16 fraction bits and saturates to the fix16_t range unless
+     * FIXMATH_NO_OVERFLOW is defined.
+     */
+    static inline fix16_t fix32_to_fix16(fix32_t a)
+    {
+#ifndef FIXMATH_NO_OVERFLOW
+        if (int64_hi(a) > 0x7FFF)
+            return (fix16_maximum);
+        if (int64_hi(a) < -0x8000)
+            return (fix16_minimum);
+#endif
+#ifndef FIXMATH_NO_ROUNDING
+        a = int64_add(a, int64_const(0, int64_hi(a) < 0 ? 0x7FFFU : 0x8000U));
+#ifndef FIXMATH_NO_OVERFLOW
+        if (int64_hi(a) > 0x7FFF)
+            return (fix16_maximum);
+#endif
+#endif
+        return ((fix16_t)(((uint32_t)int64_hi(a) << 16U) |
+                          (int64_lo(a) >> 16U)));
+    }
+
+    static inline double fix32_to_dbl(fix32_t a)
+    {
+        return ((double)int64_hi(a) + (double)int64_lo(a) / 4294967296.0);
+    }
+
+    /** Rounds to nearest. a must be in the fix32_t range.
+     */
+    static inline fix32_t fix32_from_dbl(double a)
+    {
+        int32_t hi = (int32_t)a;
+        if ((double)hi > a)
+            hi--;
+
+        double lo = (a - (double)hi) * 4294967296.0 + 0.5;
+        if (lo >= 4294967296.0)
+        {
+            hi++;
+            lo -= 4294967296.0;
+        }
+        return (int64_const(hi, (uint32_t)lo));
+    }
+
+    /** Addition and subtraction, returning fix32_overflow on overflow unless
+     * FIXMATH_NO_OVERFLOW is defined.
+     */
+    extern fix32_t fix32_add(fix32_t a, fix32_t b);
+    extern fix32_t fix32_sub(fix32_t a, fix32_t b);
+
+    /** Multiplies two fix32_t with a 128 bit intermediate product.
+     */
+    extern fix32_t fix32_mul(fix32_t a, fix32_t b);
+
+    /** Divides a by b. Division by zero returns fix32_minimum.
+     */
+    extern fix32_t fix32_div(fix32_t a, fix32_t b);
+
+    /** Returns the square root, correctly rounded. Like fix16_sqrt, the
+     * square root of a negative number is the negated root of its magnitude.
+     */
+    extern fix32_t fix32_sqrt(fix32_t x);
+
+    /** Sine and cosine in radians. The error is below 2^-28 for |x| up to
+     * 2^10, and grows with |x| through the reduction by 2 pi.
+     */
+    extern fix32_t fix32_sin(fix32_t x);
+    extern fix32_t fix32_cos(fix32_t x);
+
+    /** Returns e^x, saturating to fix32_maximum from x = ln(2^31). The error
+     * is below 2^-29, relative to the result where that exceeds 1.
+     */
+    extern fix32_t fix32_exp(fix32_t x);
+
+    /** Returns the natural logarithm, or fix32_minimum for x <= 0. The error
+     * is below 2^-29.
+     */
+    extern fix32_t fix32_log(fix32_t x);
+
+    /** Batch versions: dst[i] = op(a[i], b[i]) for i in [0, n). The
+     * destination may alias either source array.
+     */
+    extern void fix32_add_array(fix32_t* dst, const fix32_t* a,
+                                const fix32_t* b, size_t n);
+    extern void fix32_sub_array(fix32_t* dst, const fix32_t* a,
+                                const fix32_t* b, size_t n);
+    extern void fix32_mul_array(fix32_t* dst, const fix32_t* a,
+                                const fix32_t* b, size_t n);
+    extern void fix32_div_array(fix32_t* dst, const fix32_t* a,
+                                const fix32_t* b, size_t n);
+
+    /** dst[i] = fix32_from_fix16(a[i]) and fix32_to_fix16(a[i]).
+     */
+    extern void fix32_from_fix16_array(fix32_t* dst, const fix16_t* a,
+                                       size_t n);
+    extern void fix32_to_fix16_array(fix16_t* dst, const fix32_t* a,
+                                     size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
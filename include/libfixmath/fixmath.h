@@ -1,24 +1,23 @@
 #ifndef libfixmath_fixmath_h__
 #define libfixmath_fixmath_h__
 
-#ifdef __cplusplus
-extern "C"
-{
-#endif
+/**
+        \file fixmath.h
+        \brief Functions to perform fast accurate fixed-point math
+   operations.
+*/
 
-    /**
-            \file fixmath.h
-            \brief Functions to perform fast accurate fixed-point math
-       operations.
-    */
+/* No extern "C" around the includes, each header has its own and fix16.h
+ * includes the C++ classes of fix16.hpp.
+ */
 
 #include "fix16.h"
+#include "fix16_acc.h"
+#include "fix16_angle.h"
+#include "fix16_array.h"
+#include "fix32.h"
 #include "fract32.h"
 #include "int64.h"
 #include "uint32.h"
 
-#ifdef __cplusplus
-}
-#endif
-
 #endif
@@ -167,6 +167,8 @@ static inline _int64_t int64_sub(_int64_t x, _int64_t y)
 static inline _int64_t int64_shift(_int64_t x, int8_t y)
 {
     _int64_t ret = {0, 0};
+    if (y == 0)
+        return (x);
     if (y >= 64 || y <= -64)
         return ((_int64_t){0, 0});
     if (y >= 32)
@@ -201,13 +203,17 @@ static inline _int64_t int64_mul_i32_i32(int32_t x, int32_t y)
     uint16_t lo[2]    = {(uint16_t)(x & 0xFFFF), (uint16_t)(y & 0xFFFF)};
 
     int32_t  r_hi     = hi[0] * hi[1];
-    int32_t  r_md     = (hi[0] * lo[1]) + (hi[1] * lo[0]);
-    uint32_t r_lo     = lo[0] * lo[1];
+    uint32_t r_lo     = (uint32_t)lo[0] * lo[1];
+
+    // Each cross product fits in 32 bits, but their sum may not.
+    int32_t  r_md[2]  = {hi[0] * (int32_t)lo[1], hi[1] * (int32_t)lo[0]};
 
     _int64_t r_hilo64 = (_int64_t){r_hi, r_lo};
-    _int64_t r_md64   = int64_shift(int64_from_int32(r_md), 16);
+    _int64_t r_md64[2] = {
+        int64_const(r_md[0] >> 16, (uint32_t)r_md[0] << 16U),
+        int64_const(r_md[1] >> 16, (uint32_t)r_md[1] << 16U)};
 
-    return (int64_add(r_hilo64, r_md64));
+    return (int64_add(int64_add(r_hilo64, r_md64[0]), r_md64[1]));
 }
 
 static inline _int64_t int64_mul_i64_i32(_int64_t x, int32_t y)
@@ -217,8 +223,8 @@ static inline _int64_t int64_mul_i64_i32(_int64_t x, int32_t y)
         x = int64_neg(x);
     uint32_t ypos  = (uint32_t)((y < 0) ? (-y) : (y));
 
-    uint32_t _x[4] = {(x.lo & 0xFFFF), (x.lo >> 16), (x.hi & 0xFFFF),
-                      (uint32_t)(x.hi >> 16)};
+    uint32_t _x[4] = {(x.lo & 0xFFFF), (x.lo >> 16),
+                      (uint32_t)(x.hi & 0xFFFF), (uint32_t)(x.hi >> 16)};
     uint32_t _y[2] = {(ypos & 0xFFFF), (ypos >> 16)};
 
     uint32_t r[4];
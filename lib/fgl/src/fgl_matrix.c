@@ -59,13 +59,10 @@ void fgl_matrix_multiply(fix16_t* outMatrix, fix16_t* inMatrix0, fix16_t* inMatr
 		fgl_matrix_copy(outMatrix, tempMatrix);
 		return;
 	}
-	uint8_t i, j, k;
+	uint8_t i, j;
 	for(j = 0; j < 4; j++) {
-		for(i = 0; i < 4; i++) {
-			outMatrix[(j << 2) + i] = 0;
-			for(k = 0; k < 4; k++)
-				outMatrix[(j << 2) + i] += fix16_mul(inMatrix0[(k << 2) + i], inMatrix1[(j << 2) + k]);
-		}
+		for(i = 0; i < 4; i++)
+			outMatrix[(j << 2) + i] = fix16_dot_strided(&inMatrix0[i], 4, &inMatrix1[j << 2], 1, 4);
 	}
 }
 
@@ -26,29 +26,18 @@ void fgl_draw_sphere(uint32_t inDetail) {
 	fix16_t tempSin[inDetail + 1];
 	fix16_t tempCos[inDetail + 1];
 	fix16_t tempFloat = (fix16_pi << 1) / inDetail;
-	for(i = 0; i < inDetail; i++) {
-		tempSin[i] = fix16_sin(i * tempFloat);
-		tempCos[i] = fix16_cos(i * tempFloat);
-	}
+	for(i = 0; i < inDetail; i++)
+		fix16_sincos(i * tempFloat, &tempSin[i], &tempCos[i]);
 	tempSin[inDetail] = tempSin[0];
 	tempCos[inDetail] = tempCos[0];
 
 	fix16_t tempLatitudes[inDetail];
-	for(i = 0; i < inDetail; i++) {
-		tempFloat = fix16_div(fix16_from_int(i), fix16_from_int(inDetail));
-		tempFloat = tempFloat - (fix16_one >> 1);
-		tempFloat = fix16_mul(tempFloat, -fix16_pi);
-		tempFloat = fix16_sin(tempFloat);
-		tempLatitudes[i] = tempFloat;
-	}
-
 	fix16_t tempScales[inDetail];
 	for(i = 0; i < inDetail; i++) {
 		tempFloat = fix16_div(fix16_from_int(i), fix16_from_int(inDetail));
 		tempFloat = tempFloat - (fix16_one >> 1);
 		tempFloat = fix16_mul(tempFloat, -fix16_pi);
-		tempFloat = fix16_cos(tempFloat);
-		tempScales[i] = tempFloat;
+		fix16_sincos(tempFloat, &tempLatitudes[i], &tempScales[i]);
 	}
 
 	fix16_t tempU[2];
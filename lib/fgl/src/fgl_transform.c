@@ -7,29 +7,20 @@
 
 fgl_vertex_t fgl_transform_vertex(fgl_vertex_t inVertex, fix16_t* inMatrix) {
 	fgl_vertex_t tempOut = inVertex;
+	fix16_t tempIn[4] = { inVertex.x, inVertex.y, inVertex.z, fix16_one };
 
-	tempOut.x  = fix16_mul(inVertex.x, inMatrix[0]);
-	tempOut.x += fix16_mul(inVertex.y, inMatrix[1]);
-	tempOut.x += fix16_mul(inVertex.z, inMatrix[2]);
-	tempOut.x += inMatrix[3];
-
-	tempOut.y  = fix16_mul(inVertex.x, inMatrix[4]);
-	tempOut.y += fix16_mul(inVertex.y, inMatrix[5]);
-	tempOut.y += fix16_mul(inVertex.z, inMatrix[6]);
-	tempOut.y += inMatrix[7];
-
-	tempOut.z  = fix16_mul(inVertex.x, inMatrix[8]);
-	tempOut.z += fix16_mul(inVertex.y, inMatrix[9]);
-	tempOut.z += fix16_mul(inVertex.z, inMatrix[10]);
-	tempOut.z += inMatrix[11];
+	tempOut.x = fix16_dot(tempIn, &inMatrix[0], 4);
+	tempOut.y = fix16_dot(tempIn, &inMatrix[4], 4);
+	tempOut.z = fix16_dot(tempIn, &inMatrix[8], 4);
 
 	// Perspective division.
-	fix16_t tempW;
-	tempW  = fix16_mul(inVertex.x, inMatrix[12]);
-	tempW += fix16_mul(inVertex.y, inMatrix[13]);
-	tempW += fix16_mul(inVertex.z, inMatrix[14]);
-	tempW += inMatrix[15];
+	fix16_t tempW = fix16_dot(tempIn, &inMatrix[12], 4);
+	// fix16_srecip only beats the division without a hardware divider.
+#ifdef FIXMATH_NO_HARD_DIVISION
+	tempW = fix16_srecip(tempW); // TODO - Check for divide by zero.
+#else
 	tempW = fix16_sdiv(fix16_one, tempW); // TODO - Check for divide by zero.
+#endif
 	tempOut.x = fix16_mul(tempOut.x, tempW);
 	tempOut.y = fix16_mul(tempOut.y, tempW);
 	tempOut.z = fix16_mul(tempOut.z, tempW);
@@ -61,8 +52,8 @@ void fgl_scale(fix16_t inX, fix16_t inY, fix16_t inZ) {
 
 
 void fgl_rotate_x(fix16_t inAngle) {
-	fix16_t tempSin = fix16_sin(inAngle);
-	fix16_t tempCos = fix16_cos(inAngle);
+	fix16_t tempSin, tempCos;
+	fix16_sincos(inAngle, &tempSin, &tempCos);
 	fix16_t tempMatrix[16] = {
 		fix16_one, 0, 0, 0,
 		0, tempCos, -tempSin, 0,
@@ -73,8 +64,8 @@ void fgl_rotate_x(fix16_t inAngle) {
 }
 
 void fgl_rotate_y(fix16_t inAngle) {
-	fix16_t tempSin = fix16_sin(inAngle);
-	fix16_t tempCos = fix16_cos(inAngle);
+	fix16_t tempSin, tempCos;
+	fix16_sincos(inAngle, &tempSin, &tempCos);
 	fix16_t tempMatrix[16] = {
 		tempCos, 0, -tempSin, 0,
 		0, fix16_one, 0, 0,
@@ -85,8 +76,8 @@ void fgl_rotate_y(fix16_t inAngle) {
 }
 
 void fgl_rotate_z(fix16_t inAngle) {
-	fix16_t tempSin = fix16_sin(inAngle);
-	fix16_t tempCos = fix16_cos(inAngle);
+	fix16_t tempSin, tempCos;
+	fix16_sincos(inAngle, &tempSin, &tempCos);
 	fix16_t tempMatrix[16] = {
 		tempCos, -tempSin, 0, 0,
 		tempSin, tempCos, 0, 0,
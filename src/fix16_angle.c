@@ -0,0 +1,36 @@
+#include "fix16_angle.h"
+
+/* The binary angle functions read the table of FIXMATH_SIN_LUT_BITS also
+ * without it, at a resolution of 2^10 steps per quarter turn.
+ */
+#ifndef FIXMATH_SIN_LUT_BITS
+#define FIXMATH_SIN_LUT_BITS 10
+#endif
+#if (FIXMATH_SIN_LUT_BITS < 2) || (FIXMATH_SIN_LUT_BITS > 14)
+#error "FIXMATH_SIN_LUT_BITS must be in [2, 14]"
+#endif
+#include "fix16_trig_sin_lut_small.h"
+
+fix16_t fix16_angle_sin(fix16_angle_t inAngle)
+{
+    /* The quarter wave mirrored for the second and fourth quadrant, and
+     * negated for the second half turn.
+     */
+    uint32_t quarter = inAngle & 0x3FFFFFFFU;
+    if (inAngle & 0x40000000U)
+        quarter = 0x40000000U - quarter;
+
+    uint32_t index = quarter >> (30 - FIXMATH_SIN_LUT_BITS);
+    int32_t  frac  = (int32_t)((quarter >> (14 - FIXMATH_SIN_LUT_BITS)) &
+                              0xFFFFU);
+    fix16_t  a     = _fix16_sin_lut_small[index];
+    fix16_t  b     = _fix16_sin_lut_small[index + 1];
+    fix16_t  out   = a + (((b - a) * frac + 0x8000) >> 16);
+
+    return ((inAngle & 0x80000000U) ? -out : out);
+}
+
+fix16_t fix16_angle_cos(fix16_angle_t inAngle)
+{
+    return (fix16_angle_sin(inAngle + fix16_angle_quarter));
+}
@@ -0,0 +1,727 @@
+#include "fix16_simd.h"
+
+/* The vector kernels reproduce the 32*32->64 bit fix16_mul. The 8-bit
+ * variant rounds on the magnitude instead, so it always uses the scalar loop.
+ * So does FIXMATH_STICKY_OVERFLOW, where the scalar operations set the flag.
+ */
+#if defined(FIXMATH_SIMD_X86) && !defined(FIXMATH_OPTIMIZE_8BIT) &&            \
+    !defined(FIXMATH_STICKY_OVERFLOW)
+#define FIXMATH_ARRAY_SIMD
+#endif
+
+typedef enum
+{
+    fix16_array_op_add = 0,
+    fix16_array_op_sub,
+    fix16_array_op_mul,
+    fix16_array_op_div,
+#ifndef FIXMATH_NO_OVERFLOW
+    fix16_array_op_sadd,
+    fix16_array_op_ssub,
+    fix16_array_op_smul,
+    fix16_array_op_sdiv,
+#endif
+} fix16_array_op_e;
+
+static FIXMATH_ALWAYS_INLINE fix16_t fix16_array_op(fix16_array_op_e op,
+                                                    fix16_t a, fix16_t b)
+{
+    switch (op)
+    {
+    case fix16_array_op_add:
+        return (fix16_add(a, b));
+    case fix16_array_op_sub:
+        return (fix16_sub(a, b));
+    case fix16_array_op_mul:
+        return (fix16_mul(a, b));
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_sadd:
+        return (fix16_sadd(a, b));
+    case fix16_array_op_ssub:
+        return (fix16_ssub(a, b));
+    case fix16_array_op_smul:
+        return (fix16_smul(a, b));
+    case fix16_array_op_sdiv:
+        return (fix16_sdiv(a, b));
+#endif
+    case fix16_array_op_div:
+    default:
+        return (fix16_div(a, b));
+    }
+}
+
+/* Division has no exact lane-wise form, the vector entry points route it to
+ * this scalar loop as well.
+ */
+static FIXMATH_ALWAYS_INLINE void fix16_array_loop(fix16_array_op_e op,
+                                                   fix16_t*         dst,
+                                                   const fix16_t*   a,
+                                                   const fix16_t*   b,
+                                                   fix16_t k, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_array_op(op, a[i], (b != NULL) ? b[i] : k);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// SSE4.1 KERNELS (4 LANES)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef FIXMATH_ARRAY_SIMD
+/* The kernels return the wrapped result and set *ovf to all ones in the lanes
+ * that overflow, so that the plain and the saturating operations can share
+ * them.
+ */
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_SSE41 __m128i
+fix16_add_sse41(__m128i a, __m128i b, __m128i* ovf)
+{
+    __m128i sum = _mm_add_epi32(a, b);
+    // Same test as fix16_add: the operands agree in sign, the sum does not.
+    *ovf = _mm_srai_epi32(
+        _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, sum)), 31);
+    return (sum);
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_SSE41 __m128i
+fix16_sub_sse41(__m128i a, __m128i b, __m128i* ovf)
+{
+    __m128i diff = _mm_sub_epi32(a, b);
+    // Same test as fix16_sub: the operands differ in sign, and so do a and
+    // the difference.
+    *ovf         = _mm_srai_epi32(
+        _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, diff)), 31);
+    return (diff);
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_SSE41 __m128i
+fix16_mul_sse41(__m128i a, __m128i b, __m128i* ovf)
+{
+    // Full 64 bit products of the even and the odd lanes.
+    __m128i even = _mm_mul_epi32(a, b);
+    __m128i odd =
+        _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+    // The upper 17 bits should all be the same (the sign).
+    __m128i upper = _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xCC);
+    *ovf          = _mm_xor_si128(_mm_cmpeq_epi32(_mm_srai_epi32(upper, 15),
+                                                  _mm_srai_epi32(upper, 31)),
+                                  _mm_set1_epi32(-1));
+
+#ifndef FIXMATH_NO_ROUNDING
+    // Add 0.5 and, as fix16_mul does, subtract 1 from negative products so
+    // that -1/2 rounds away from zero.
+    __m128i half = _mm_set1_epi64x(0x8000);
+    even         = _mm_add_epi64(
+        _mm_add_epi64(even, half),
+        _mm_shuffle_epi32(_mm_srai_epi32(even, 31), _MM_SHUFFLE(3, 3, 1, 1)));
+    odd = _mm_add_epi64(
+        _mm_add_epi64(odd, half),
+        _mm_shuffle_epi32(_mm_srai_epi32(odd, 31), _MM_SHUFFLE(3, 3, 1, 1)));
+#endif
+
+    // The middle 32 bits of each product are the result.
+    return (_mm_blend_epi16(_mm_srli_epi64(even, 16),
+                            _mm_slli_epi64(odd, 16), 0xCC));
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_SSE41 __m128i
+fix16_array_op_sse41(fix16_array_op_e op, __m128i a, __m128i b)
+{
+    __m128i ovf;
+    __m128i result;
+
+    switch (op)
+    {
+    case fix16_array_op_add:
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_sadd:
+#endif
+        result = fix16_add_sse41(a, b, &ovf);
+        break;
+    case fix16_array_op_sub:
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_ssub:
+#endif
+        result = fix16_sub_sse41(a, b, &ovf);
+        break;
+    case fix16_array_op_mul:
+    default:
+        result = fix16_mul_sse41(a, b, &ovf);
+        break;
+    }
+
+#ifndef FIXMATH_NO_OVERFLOW
+    // The saturating operations pick the limit by the sign of the exact
+    // result, as the scalar ones do.
+    __m128i negative = (op == fix16_array_op_smul) ? _mm_xor_si128(a, b) : a;
+    __m128i limit    = _mm_xor_si128(_mm_set1_epi32(fix16_maximum),
+                                     _mm_srai_epi32(negative, 31));
+    switch (op)
+    {
+    case fix16_array_op_sadd:
+    case fix16_array_op_ssub:
+    case fix16_array_op_smul:
+        return (_mm_blendv_epi8(result, limit, ovf));
+    default:
+        return (_mm_blendv_epi8(result, _mm_set1_epi32(fix16_overflow), ovf));
+    }
+#else
+    (void)ovf;
+    return (result);
+#endif
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_SSE41 void
+fix16_array_loop_sse41(fix16_array_op_e op, fix16_t* dst, const fix16_t* a,
+                       const fix16_t* b, fix16_t k, size_t n)
+{
+    size_t  i  = 0;
+    __m128i vk = _mm_set1_epi32(k);
+
+    for (; (i + 4U) <= n; i += 4U)
+    {
+        __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i vb =
+            (b != NULL) ? _mm_loadu_si128((const __m128i*)(b + i)) : vk;
+        _mm_storeu_si128((__m128i*)(dst + i),
+                         fix16_array_op_sse41(op, va, vb));
+    }
+
+    fix16_array_loop(op, dst + i, a + i, (b != NULL) ? (b + i) : NULL, k,
+                     n - i);
+}
+#endif /* FIXMATH_ARRAY_SIMD */
+
+////////////////////////////////////////////////////////////////////////////////
+// AVX2 KERNELS (8 LANES)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef FIXMATH_ARRAY_SIMD
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX2 __m256i
+fix16_add_avx2(__m256i a, __m256i b, __m256i* ovf)
+{
+    __m256i sum = _mm256_add_epi32(a, b);
+    *ovf        = _mm256_srai_epi32(
+        _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, sum)),
+        31);
+    return (sum);
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX2 __m256i
+fix16_sub_avx2(__m256i a, __m256i b, __m256i* ovf)
+{
+    __m256i diff = _mm256_sub_epi32(a, b);
+    *ovf         = _mm256_srai_epi32(
+        _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, diff)),
+        31);
+    return (diff);
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX2 __m256i
+fix16_mul_avx2(__m256i a, __m256i b, __m256i* ovf)
+{
+    __m256i even = _mm256_mul_epi32(a, b);
+    __m256i odd =
+        _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+
+    __m256i upper = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+    *ovf = _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_srai_epi32(upper, 15),
+                                               _mm256_srai_epi32(upper, 31)),
+                            _mm256_set1_epi32(-1));
+
+#ifndef FIXMATH_NO_ROUNDING
+    __m256i half = _mm256_set1_epi64x(0x8000);
+    even         = _mm256_add_epi64(
+        _mm256_add_epi64(even, half),
+        _mm256_shuffle_epi32(_mm256_srai_epi32(even, 31),
+                             _MM_SHUFFLE(3, 3, 1, 1)));
+    odd = _mm256_add_epi64(_mm256_add_epi64(odd, half),
+                           _mm256_shuffle_epi32(_mm256_srai_epi32(odd, 31),
+                                                _MM_SHUFFLE(3, 3, 1, 1)));
+#endif
+
+    return (_mm256_blend_epi32(_mm256_srli_epi64(even, 16),
+                               _mm256_slli_epi64(odd, 16), 0xAA));
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX2 __m256i
+fix16_array_op_avx2(fix16_array_op_e op, __m256i a, __m256i b)
+{
+    __m256i ovf;
+    __m256i result;
+
+    switch (op)
+    {
+    case fix16_array_op_add:
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_sadd:
+#endif
+        result = fix16_add_avx2(a, b, &ovf);
+        break;
+    case fix16_array_op_sub:
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_ssub:
+#endif
+        result = fix16_sub_avx2(a, b, &ovf);
+        break;
+    case fix16_array_op_mul:
+    default:
+        result = fix16_mul_avx2(a, b, &ovf);
+        break;
+    }
+
+#ifndef FIXMATH_NO_OVERFLOW
+    __m256i negative =
+        (op == fix16_array_op_smul) ? _mm256_xor_si256(a, b) : a;
+    __m256i limit = _mm256_xor_si256(_mm256_set1_epi32(fix16_maximum),
+                                     _mm256_srai_epi32(negative, 31));
+    switch (op)
+    {
+    case fix16_array_op_sadd:
+    case fix16_array_op_ssub:
+    case fix16_array_op_smul:
+        return (_mm256_blendv_epi8(result, limit, ovf));
+    default:
+        return (_mm256_blendv_epi8(result, _mm256_set1_epi32(fix16_overflow),
+                                   ovf));
+    }
+#else
+    (void)ovf;
+    return (result);
+#endif
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX2 void
+fix16_array_loop_avx2(fix16_array_op_e op, fix16_t* dst, const fix16_t* a,
+                      const fix16_t* b, fix16_t k, size_t n)
+{
+    size_t  i  = 0;
+    __m256i vk = _mm256_set1_epi32(k);
+
+    for (; (i + 8U) <= n; i += 8U)
+    {
+        __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i vb =
+            (b != NULL) ? _mm256_loadu_si256((const __m256i*)(b + i)) : vk;
+        _mm256_storeu_si256((__m256i*)(dst + i),
+                            fix16_array_op_avx2(op, va, vb));
+    }
+
+    fix16_array_loop(op, dst + i, a + i, (b != NULL) ? (b + i) : NULL, k,
+                     n - i);
+}
+#endif /* FIXMATH_ARRAY_SIMD */
+
+
+////////////////////////////////////////////////////////////////////////////////
+// AVX-512 KERNELS (16 LANES)
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef FIXMATH_ARRAY_SIMD
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX512 __m512i
+fix16_add_avx512(__m512i a, __m512i b, __mmask16* ovf)
+{
+    __m512i sum = _mm512_add_epi32(a, b);
+    *ovf        = _mm512_cmplt_epi32_mask(
+        _mm512_andnot_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, sum)),
+        _mm512_setzero_si512());
+    return (sum);
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX512 __m512i
+fix16_sub_avx512(__m512i a, __m512i b, __mmask16* ovf)
+{
+    __m512i diff = _mm512_sub_epi32(a, b);
+    *ovf         = _mm512_cmplt_epi32_mask(
+        _mm512_and_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, diff)),
+        _mm512_setzero_si512());
+    return (diff);
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX512 __m512i
+fix16_mul_avx512(__m512i a, __m512i b, __mmask16* ovf)
+{
+    __m512i even = _mm512_mul_epi32(a, b);
+    __m512i odd =
+        _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+
+    __m512i upper =
+        _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd);
+    *ovf = _mm512_cmpneq_epi32_mask(_mm512_srai_epi32(upper, 15),
+                                    _mm512_srai_epi32(upper, 31));
+
+#ifndef FIXMATH_NO_ROUNDING
+    // AVX-512 has a 64 bit arithmetic shift for the sign of the product.
+    __m512i half = _mm512_set1_epi64(0x8000);
+    even         = _mm512_add_epi64(_mm512_add_epi64(even, half),
+                                    _mm512_srai_epi64(even, 63));
+    odd          = _mm512_add_epi64(_mm512_add_epi64(odd, half),
+                                    _mm512_srai_epi64(odd, 63));
+#endif
+
+    return (_mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 16),
+                                    _mm512_slli_epi64(odd, 16)));
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX512 __m512i
+fix16_array_op_avx512(fix16_array_op_e op, __m512i a, __m512i b)
+{
+    __mmask16 ovf;
+    __m512i   result;
+
+    switch (op)
+    {
+    case fix16_array_op_add:
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_sadd:
+#endif
+        result = fix16_add_avx512(a, b, &ovf);
+        break;
+    case fix16_array_op_sub:
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_ssub:
+#endif
+        result = fix16_sub_avx512(a, b, &ovf);
+        break;
+    case fix16_array_op_mul:
+    default:
+        result = fix16_mul_avx512(a, b, &ovf);
+        break;
+    }
+
+#ifndef FIXMATH_NO_OVERFLOW
+    __m512i negative =
+        (op == fix16_array_op_smul) ? _mm512_xor_si512(a, b) : a;
+    __m512i limit = _mm512_xor_si512(_mm512_set1_epi32(fix16_maximum),
+                                     _mm512_srai_epi32(negative, 31));
+    switch (op)
+    {
+    case fix16_array_op_sadd:
+    case fix16_array_op_ssub:
+    case fix16_array_op_smul:
+        return (_mm512_mask_mov_epi32(result, ovf, limit));
+    default:
+        return (_mm512_mask_mov_epi32(result, ovf,
+                                      _mm512_set1_epi32(fix16_overflow)));
+    }
+#else
+    (void)ovf;
+    return (result);
+#endif
+}
+
+/* The tail is handled with masked loads and stores instead of a scalar loop.
+ */
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX512 void
+fix16_array_loop_avx512(fix16_array_op_e op, fix16_t* dst, const fix16_t* a,
+                        const fix16_t* b, fix16_t k, size_t n)
+{
+    size_t  i  = 0;
+    __m512i vk = _mm512_set1_epi32(k);
+
+    for (; (i + 16U) <= n; i += 16U)
+    {
+        __m512i va = _mm512_loadu_si512(a + i);
+        __m512i vb = (b != NULL) ? _mm512_loadu_si512(b + i) : vk;
+        _mm512_storeu_si512(dst + i, fix16_array_op_avx512(op, va, vb));
+    }
+
+    if (i < n)
+    {
+        __mmask16 m  = (__mmask16)((1U << (n - i)) - 1U);
+        __m512i   va = _mm512_maskz_loadu_epi32(m, a + i);
+        __m512i   vb = (b != NULL) ? _mm512_maskz_loadu_epi32(m, b + i) : vk;
+        _mm512_mask_storeu_epi32(dst + i, m,
+                                 fix16_array_op_avx512(op, va, vb));
+    }
+}
+#endif /* FIXMATH_ARRAY_SIMD */
+
+////////////////////////////////////////////////////////////////////////////////
+// DISPATCH
+////////////////////////////////////////////////////////////////////////////////
+
+typedef void (*fix16_array_fn_t)(fix16_array_op_e op, fix16_t* dst,
+                                 const fix16_t* a, const fix16_t* b,
+                                 fix16_t k, size_t n);
+
+/* Each entry point specializes the loop for every operation, so the switch
+ * runs once per call and not once per element.
+ */
+static void fix16_array_scalar(fix16_array_op_e op, fix16_t* dst,
+                               const fix16_t* a, const fix16_t* b, fix16_t k,
+                               size_t n)
+{
+    switch (op)
+    {
+    case fix16_array_op_add:
+        fix16_array_loop(fix16_array_op_add, dst, a, b, k, n);
+        break;
+    case fix16_array_op_sub:
+        fix16_array_loop(fix16_array_op_sub, dst, a, b, k, n);
+        break;
+    case fix16_array_op_mul:
+        fix16_array_loop(fix16_array_op_mul, dst, a, b, k, n);
+        break;
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_sadd:
+        fix16_array_loop(fix16_array_op_sadd, dst, a, b, k, n);
+        break;
+    case fix16_array_op_ssub:
+        fix16_array_loop(fix16_array_op_ssub, dst, a, b, k, n);
+        break;
+    case fix16_array_op_smul:
+        fix16_array_loop(fix16_array_op_smul, dst, a, b, k, n);
+        break;
+#endif
+    default:
+        fix16_array_loop(op, dst, a, b, k, n);
+        break;
+    }
+}
+
+#ifdef FIXMATH_ARRAY_SIMD
+FIXMATH_TARGET_SSE41 static void fix16_array_sse41(fix16_array_op_e op,
+                                                   fix16_t*         dst,
+                                                   const fix16_t*   a,
+                                                   const fix16_t*   b,
+                                                   fix16_t k, size_t n)
+{
+    switch (op)
+    {
+    case fix16_array_op_add:
+        fix16_array_loop_sse41(fix16_array_op_add, dst, a, b, k, n);
+        break;
+    case fix16_array_op_sub:
+        fix16_array_loop_sse41(fix16_array_op_sub, dst, a, b, k, n);
+        break;
+    case fix16_array_op_mul:
+        fix16_array_loop_sse41(fix16_array_op_mul, dst, a, b, k, n);
+        break;
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_sadd:
+        fix16_array_loop_sse41(fix16_array_op_sadd, dst, a, b, k, n);
+        break;
+    case fix16_array_op_ssub:
+        fix16_array_loop_sse41(fix16_array_op_ssub, dst, a, b, k, n);
+        break;
+    case fix16_array_op_smul:
+        fix16_array_loop_sse41(fix16_array_op_smul, dst, a, b, k, n);
+        break;
+#endif
+    default:
+        fix16_array_loop(op, dst, a, b, k, n);
+        break;
+    }
+}
+
+FIXMATH_TARGET_AVX2 static void fix16_array_avx2(fix16_array_op_e op,
+                                                 fix16_t*         dst,
+                                                 const fix16_t*   a,
+                                                 const fix16_t*   b,
+                                                 fix16_t k, size_t n)
+{
+    switch (op)
+    {
+    case fix16_array_op_add:
+        fix16_array_loop_avx2(fix16_array_op_add, dst, a, b, k, n);
+        break;
+    case fix16_array_op_sub:
+        fix16_array_loop_avx2(fix16_array_op_sub, dst, a, b, k, n);
+        break;
+    case fix16_array_op_mul:
+        fix16_array_loop_avx2(fix16_array_op_mul, dst, a, b, k, n);
+        break;
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_sadd:
+        fix16_array_loop_avx2(fix16_array_op_sadd, dst, a, b, k, n);
+        break;
+    case fix16_array_op_ssub:
+        fix16_array_loop_avx2(fix16_array_op_ssub, dst, a, b, k, n);
+        break;
+    case fix16_array_op_smul:
+        fix16_array_loop_avx2(fix16_array_op_smul, dst, a, b, k, n);
+        break;
+#endif
+    default:
+        fix16_array_loop(op, dst, a, b, k, n);
+        break;
+    }
+}
+
+FIXMATH_TARGET_AVX512 static void fix16_array_avx512(fix16_array_op_e op,
+                                                     fix16_t*         dst,
+                                                     const fix16_t*   a,
+                                                     const fix16_t*   b,
+                                                     fix16_t k, size_t n)
+{
+    switch (op)
+    {
+    case fix16_array_op_add:
+        fix16_array_loop_avx512(fix16_array_op_add, dst, a, b, k, n);
+        break;
+    case fix16_array_op_sub:
+        fix16_array_loop_avx512(fix16_array_op_sub, dst, a, b, k, n);
+        break;
+    case fix16_array_op_mul:
+        fix16_array_loop_avx512(fix16_array_op_mul, dst, a, b, k, n);
+        break;
+#ifndef FIXMATH_NO_OVERFLOW
+    case fix16_array_op_sadd:
+        fix16_array_loop_avx512(fix16_array_op_sadd, dst, a, b, k, n);
+        break;
+    case fix16_array_op_ssub:
+        fix16_array_loop_avx512(fix16_array_op_ssub, dst, a, b, k, n);
+        break;
+    case fix16_array_op_smul:
+        fix16_array_loop_avx512(fix16_array_op_smul, dst, a, b, k, n);
+        break;
+#endif
+    default:
+        fix16_array_loop(op, dst, a, b, k, n);
+        break;
+    }
+}
+#endif /* FIXMATH_ARRAY_SIMD */
+
+/* Indexed by fix16_simd_e, which is resolved once when the library loads. */
+static const fix16_array_fn_t fix16_array_kernels[fix16_simd_count] = {
+#ifdef FIXMATH_ARRAY_SIMD
+    fix16_array_scalar,
+    fix16_array_sse41,
+    fix16_array_avx2,
+    fix16_array_avx512,
+#else
+    fix16_array_scalar,
+    fix16_array_scalar,
+    fix16_array_scalar,
+    fix16_array_scalar,
+#endif
+};
+
+/* Applies op to every element. When b is NULL the scalar k is used as the
+ * second operand instead.
+ */
+static inline void fix16_array_apply(fix16_array_op_e op, fix16_t* dst,
+                                     const fix16_t* a, const fix16_t* b,
+                                     fix16_t k, size_t n)
+{
+    fix16_array_kernels[fix16_simd_level()](op, dst, a, b, k, n);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+void fix16_add_array(fix16_t* dst, const fix16_t* a, const fix16_t* b,
+                     size_t n)
+{
+    fix16_array_apply(fix16_array_op_add, dst, a, b, 0, n);
+}
+
+void fix16_sub_array(fix16_t* dst, const fix16_t* a, const fix16_t* b,
+                     size_t n)
+{
+    fix16_array_apply(fix16_array_op_sub, dst, a, b, 0, n);
+}
+
+void fix16_mul_array(fix16_t* dst, const fix16_t* a, const fix16_t* b,
+                     size_t n)
+{
+    fix16_array_apply(fix16_array_op_mul, dst, a, b, 0, n);
+}
+
+void fix16_div_array(fix16_t* dst, const fix16_t* a, const fix16_t* b,
+                     size_t n)
+{
+    fix16_array_apply(fix16_array_op_div, dst, a, b, 0, n);
+}
+
+void fix16_add_array_scalar(fix16_t* dst, const fix16_t* a, fix16_t b,
+                            size_t n)
+{
+    fix16_array_apply(fix16_array_op_add, dst, a, NULL, b, n);
+}
+
+void fix16_sub_array_scalar(fix16_t* dst, const fix16_t* a, fix16_t b,
+                            size_t n)
+{
+    fix16_array_apply(fix16_array_op_sub, dst, a, NULL, b, n);
+}
+
+void fix16_mul_array_scalar(fix16_t* dst, const fix16_t* a, fix16_t b,
+                            size_t n)
+{
+    fix16_array_apply(fix16_array_op_mul, dst, a, NULL, b, n);
+}
+
+void fix16_div_array_scalar(fix16_t* dst, const fix16_t* a, fix16_t b,
+                            size_t n)
+{
+#if !defined(FIXMATH_NO_OVERFLOW) && !defined(FIXMATH_FAST_DIV)
+    // The divisor is loop-invariant, so precompute its reciprocal once. This
+    // is only bit-exact with fix16_div when overflows are detected.
+    fix16_divisor_t d = fix16_divisor_create(b);
+    fix16_div_by_array(dst, a, &d, n);
+#else
+    fix16_array_apply(fix16_array_op_div, dst, a, NULL, b, n);
+#endif
+}
+
+#ifndef FIXMATH_NO_OVERFLOW
+void fix16_sadd_array(fix16_t* dst, const fix16_t* a, const fix16_t* b,
+                      size_t n)
+{
+    fix16_array_apply(fix16_array_op_sadd, dst, a, b, 0, n);
+}
+
+void fix16_ssub_array(fix16_t* dst, const fix16_t* a, const fix16_t* b,
+                      size_t n)
+{
+    fix16_array_apply(fix16_array_op_ssub, dst, a, b, 0, n);
+}
+
+void fix16_smul_array(fix16_t* dst, const fix16_t* a, const fix16_t* b,
+                      size_t n)
+{
+    fix16_array_apply(fix16_array_op_smul, dst, a, b, 0, n);
+}
+
+void fix16_sdiv_array(fix16_t* dst, const fix16_t* a, const fix16_t* b,
+                      size_t n)
+{
+    fix16_array_apply(fix16_array_op_sdiv, dst, a, b, 0, n);
+}
+
+void fix16_sadd_array_scalar(fix16_t* dst, const fix16_t* a, fix16_t b,
+                             size_t n)
+{
+    fix16_array_apply(fix16_array_op_sadd, dst, a, NULL, b, n);
+}
+
+void fix16_ssub_array_scalar(fix16_t* dst, const fix16_t* a, fix16_t b,
+                             size_t n)
+{
+    fix16_array_apply(fix16_array_op_ssub, dst, a, NULL, b, n);
+}
+
+void fix16_smul_array_scalar(fix16_t* dst, const fix16_t* a, fix16_t b,
+                             size_t n)
+{
+    fix16_array_apply(fix16_array_op_smul, dst, a, NULL, b, n);
+}
+
+void fix16_sdiv_array_scalar(fix16_t* dst, const fix16_t* a, fix16_t b,
+                             size_t n)
+{
+#ifndef FIXMATH_FAST_DIV
+    fix16_divisor_t d = fix16_divisor_create(b);
+    fix16_sdiv_by_array(dst, a, &d, n);
+#else
+    fix16_array_apply(fix16_array_op_sdiv, dst, a, NULL, b, n);
+#endif
+}
+#endif
+
+/*** end of file ***/
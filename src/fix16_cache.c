@@ -0,0 +1,21 @@
+#include "fix16_cache.h"
+
+#ifdef FIXMATH_CACHE_STATS
+FIXMATH_CACHE_LOCAL fix16_cache_stats_t fix16_cache_counters[fix16_cache_count];
+
+fix16_cache_stats_t fix16_cache_stats(fix16_cache_e cache)
+{
+    return (fix16_cache_counters[cache]);
+}
+
+void fix16_cache_stats_clear(void)
+{
+    unsigned i;
+    for (i = 0; i < fix16_cache_count; i++)
+    {
+        fix16_cache_counters[i].hits      = 0;
+        fix16_cache_counters[i].misses    = 0;
+        fix16_cache_counters[i].evictions = 0;
+    }
+}
+#endif
@@ -0,0 +1,70 @@
+#ifndef libfixmath_fix16_cache_h__
+#define libfixmath_fix16_cache_h__
+
+/* Internal helpers for the memo caches of fix16_sin, fix16_atan2 and
+ * fix16_exp. With FIXMATH_THREAD_CACHE each thread has its own caches, where
+ * the compiler has no thread-local variables there are none.
+ *
+ * Each cache has 2^FIXMATH_CACHE_BITS entries. An input goes to the slot
+ * given by the low bits of its FIXMATH_*_CACHE_HASH, which can be replaced
+ * on the command line, e.g. -D'FIXMATH_SIN_CACHE_HASH(x)=((x) >> 8)'.
+ */
+
+#include "fix16.h"
+
+#ifdef FIXMATH_THREAD_CACHE
+#ifdef FIXMATH_NO_THREAD_LOCAL
+#ifndef FIXMATH_NO_CACHE
+#define FIXMATH_NO_CACHE
+#endif
+#endif
+#define FIXMATH_CACHE_LOCAL FIXMATH_THREAD_LOCAL
+#else
+#define FIXMATH_CACHE_LOCAL
+#endif
+#define FIXMATH_CACHE_STORAGE static FIXMATH_CACHE_LOCAL
+
+#ifndef FIXMATH_CACHE_BITS
+#define FIXMATH_CACHE_BITS 12
+#endif
+#define FIXMATH_CACHE_SIZE (1U << FIXMATH_CACHE_BITS)
+#define FIXMATH_CACHE_MASK (FIXMATH_CACHE_SIZE - 1U)
+
+#ifndef FIXMATH_SIN_CACHE_HASH
+#define FIXMATH_SIN_CACHE_HASH(x) ((uint32_t)(x) >> 5)
+#endif
+#ifndef FIXMATH_ATAN_CACHE_HASH
+#define FIXMATH_ATAN_CACHE_HASH(y, x)                                          \
+    (((uint32_t)(x) ^ (uint32_t)(y)) ^ (((uint32_t)(x) ^ (uint32_t)(y)) >> 20))
+#endif
+#ifndef FIXMATH_EXP_CACHE_HASH
+#define FIXMATH_EXP_CACHE_HASH(x) ((uint32_t)(x) ^ ((uint32_t)(x) >> 4))
+#endif
+
+#ifdef FIXMATH_CACHE_STATS
+/* One bit per slot, set once the slot holds an entry. */
+#define FIXMATH_CACHE_USED_WORDS ((FIXMATH_CACHE_SIZE + 31U) / 32U)
+
+extern FIXMATH_CACHE_LOCAL fix16_cache_stats_t
+    fix16_cache_counters[fix16_cache_count];
+
+static inline void fix16_cache_hit(fix16_cache_e cache)
+{
+    fix16_cache_counters[cache].hits++;
+}
+
+/* Counts a miss whose result is stored in the given slot, and an eviction if
+ * the slot held another entry.
+ */
+static inline void fix16_cache_miss(fix16_cache_e cache, uint32_t* used,
+                                    uint32_t slot)
+{
+    uint32_t bit = 1U << (slot & 31U);
+    fix16_cache_counters[cache].misses++;
+    if (used[slot >> 5] & bit)
+        fix16_cache_counters[cache].evictions++;
+    used[slot >> 5] |= bit;
+}
+#endif
+
+#endif
@@ -0,0 +1,266 @@
+#include "fix16.h"
+#include "fix16_angle.h"
+#include "fix16_array.h"
+#include "int64.h"
+#include "uint32_inline.h"
+
+/* CORDIC, after Volder, "The CORDIC Trigonometric Computing Technique", IRE
+ * Trans. Electronic Computers, 1959.
+ *
+ * Each iteration rotates the vector (x, y) by +-atan(2^-i), which needs only
+ * the shifts x >> i and y >> i, and adds or subtracts the angle from a table.
+ * Rotation mode drives the residual angle to zero and ends with the cosine
+ * and sine, vectoring mode drives y to zero and ends with the angle and the
+ * length of the vector. The rotations scale the vector by the gain
+ * 1/fix16_cordic_gain[n], which rotation mode takes out of the start vector.
+ *
+ * Angles and coordinates are kept with 29 fractional bits, 13 more than
+ * fix16_t, so that the rounding of the shifts stays below the result LSB.
+ */
+
+#define FIX16_CORDIC_STEPS   24 /* fix16_cordic_iterations */
+#define FIX16_CORDIC_FRAC    29
+
+/* The angle is reduced with 28 fractional bits, one less than the
+ * iterations, so that 2pi fits in 31 bits.
+ */
+#define FIX16_CORDIC_2PI_Q28 1686629713                  /* 2pi * 2^28 */
+#define FIX16_CORDIC_PI_Q28  (FIX16_CORDIC_2PI_Q28 >> 1) /* pi * 2^28 */
+#define FIX16_CORDIC_PI2_Q28 (FIX16_CORDIC_2PI_Q28 >> 2) /* pi/2 * 2^28 */
+
+/* atan(2^-i) * 2^29. */
+static const int32_t fix16_cordic_atan[FIX16_CORDIC_STEPS] = {
+    421657428, 248918915, 131521918, 66762579, 33510843, 16771758,
+    8387925,   4194219,   2097141,   1048575,  524288,   262144,
+    131072,    65536,     32768,     16384,    8192,     4096,
+    2048,      1024,      512,       256,      128,      64,
+};
+
+/* atan(2^-i) / (2pi) * 2^32, for binary angles. */
+static const int32_t fix16_cordic_atan_turn[FIX16_CORDIC_STEPS] = {
+    536870912, 316933406, 167458907, 85004756, 42667331, 21354465,
+    10679838,  5340245,   2670163,   1335087,  667544,   333772,
+    166886,    83443,     41722,     20861,    10430,    5215,
+    2608,      1304,      652,       326,      163,      81,
+};
+
+/* 2^31 divided by the gain of n iterations, the product of
+ * sqrt(1 + 2^-2i) for i in [0, n).
+ */
+static const int32_t fix16_cordic_gain[FIX16_CORDIC_STEPS + 1] = {
+    2147483647, 1518500250, 1358187913, 1317635818, 1307460871,
+    1304914694, 1304277995, 1304118810, 1304079014, 1304069065,
+    1304066577, 1304065955, 1304065800, 1304065761, 1304065751,
+    1304065749, 1304065748, 1304065748, 1304065748, 1304065748,
+    1304065748, 1304065748, 1304065748, 1304065748, 1304065748,
+};
+
+/* Rounds a value with 29 fractional bits to fix16_t. */
+static inline fix16_t fix16_cordic_round(int32_t x)
+{
+    return ((x + (1 << (FIX16_CORDIC_FRAC - 17))) >> (FIX16_CORDIC_FRAC - 16));
+}
+
+void fix16_cordic_sincos(fix16_t inAngle, fix16_t* outSin, fix16_t* outCos,
+                         unsigned iterations)
+{
+    if (iterations > FIX16_CORDIC_STEPS)
+        iterations = FIX16_CORDIC_STEPS;
+
+    /* |inAngle| * 2^12 modulo 2pi * 2^28, by shifting in its last bit and
+     * the 12 zero bits one at a time. The top 31 bits are below the modulus
+     * already.
+     */
+    uint32_t angle = (inAngle < 0) ? -(uint32_t)inAngle : (uint32_t)inAngle;
+    uint32_t r     = angle >> 1;
+    for (int i = 0; i < 13; ++i)
+    {
+        r = (r << 1) | ((i == 0) ? (angle & 1U) : 0U);
+        if (r >= (uint32_t)FIX16_CORDIC_2PI_Q28)
+            r -= (uint32_t)FIX16_CORDIC_2PI_Q28;
+    }
+
+    /* To [-pi, pi] and then [-pi/2, pi/2], where the angles pi away have
+     * the opposite sine and cosine, and to 29 fractional bits.
+     */
+    int32_t z = (int32_t)r;
+    if (z > FIX16_CORDIC_PI_Q28)
+        z -= FIX16_CORDIC_2PI_Q28;
+    if (inAngle < 0)
+        z = -z;
+
+    int negate = 0;
+    if (z > FIX16_CORDIC_PI2_Q28)
+    {
+        z -= FIX16_CORDIC_PI_Q28;
+        negate = 1;
+    }
+    else if (z < -FIX16_CORDIC_PI2_Q28)
+    {
+        z += FIX16_CORDIC_PI_Q28;
+        negate = 1;
+    }
+    z = (int32_t)((uint32_t)z << 1);
+
+    /* The direction is the sign mask d of z, (v ^ d) - d negates v where z
+     * is negative without a branch.
+     */
+    int32_t x = fix16_cordic_gain[iterations] >> (31 - FIX16_CORDIC_FRAC);
+    int32_t y = 0;
+    for (unsigned i = 0; i < iterations; ++i)
+    {
+        int32_t d  = z >> 31;
+        int32_t dx = y >> i;
+        int32_t dy = x >> i;
+        x -= (dx ^ d) - d;
+        y += (dy ^ d) - d;
+        z -= (fix16_cordic_atan[i] ^ d) - d;
+    }
+
+    *outSin = fix16_cordic_round(negate ? -y : y);
+    *outCos = fix16_cordic_round(negate ? -x : x);
+}
+
+/* Scales (inX, inY) to (x, y) so that the larger coordinate is in
+ * [2^28, 2^29), which leaves room for the gain of the rotations, the 1.65
+ * of the gain times sqrt(2), and stores the left shift. Returns 0 for the
+ * zero vector, which has no angle.
+ */
+static inline int fix16_cordic_scale(fix16_t inY, fix16_t inX, int32_t* x,
+                                     int32_t* y, int* shift)
+{
+    uint32_t ax = (inX < 0) ? -(uint32_t)inX : (uint32_t)inX;
+    uint32_t ay = (inY < 0) ? -(uint32_t)inY : (uint32_t)inY;
+    uint32_t m  = (ax > ay) ? ax : ay;
+    if (m == 0U)
+        return (0);
+
+    *shift = uint32_clz(m) - (32 - FIX16_CORDIC_FRAC);
+    if (*shift >= 0)
+    {
+        *x = (int32_t)((uint32_t)inX << *shift);
+        *y = (int32_t)((uint32_t)inY << *shift);
+    }
+    else
+    {
+        *x = inX >> -*shift;
+        *y = inY >> -*shift;
+    }
+    return (1);
+}
+
+/* Vectoring mode, which converges for x >= 0: rotates (x, y) onto the x
+ * axis and returns the sum of the rotations from the given arctangent
+ * table.
+ */
+static inline int32_t fix16_cordic_vector(int32_t* x, int32_t* y,
+                                          const int32_t* atan,
+                                          unsigned iterations)
+{
+    int32_t z = 0;
+    for (unsigned i = 0; i < iterations; ++i)
+    {
+        int32_t d  = *y >> 31;
+        int32_t dx = *y >> i;
+        int32_t dy = *x >> i;
+        *x += (dx ^ d) - d;
+        *y -= (dy ^ d) - d;
+        z += (atan[i] ^ d) - d;
+    }
+    return (z);
+}
+
+fix16_t fix16_cordic_atan2(fix16_t inY, fix16_t inX, fix16_t* outHypot,
+                           unsigned iterations)
+{
+    if (iterations > FIX16_CORDIC_STEPS)
+        iterations = FIX16_CORDIC_STEPS;
+
+    int32_t x;
+    int32_t y;
+    int     shift;
+    if (!fix16_cordic_scale(inY, inX, &x, &y, &shift))
+    {
+        if (outHypot)
+            *outHypot = 0;
+        return (0);
+    }
+
+    /* The left half-plane is rotated by pi first. */
+    fix16_t offset = 0;
+    if (x < 0)
+    {
+        offset = (y >= 0) ? fix16_pi : -fix16_pi;
+        x      = -x;
+        y      = -y;
+    }
+
+    int32_t z = fix16_cordic_vector(&x, &y, fix16_cordic_atan, iterations);
+
+    if (outHypot)
+    {
+        /* The gain correction is the only multiplication, x / 2 with the
+         * gain removed, and then the scaling is undone.
+         */
+        int32_t h = int64_hi(
+            int64_mul_i32_i32(x, fix16_cordic_gain[iterations]));
+        if (shift >= 2)
+            h = (h + (1 << (shift - 2))) >> (shift - 1);
+        else if (h > (fix16_maximum >> (1 - shift)))
+            h = fix16_maximum;
+        else
+            h <<= (1 - shift);
+        *outHypot = h;
+    }
+
+    return (offset + fix16_cordic_round(z));
+}
+
+fix16_angle_t fix16_angle_atan2(fix16_t inY, fix16_t inX)
+{
+    int32_t x;
+    int32_t y;
+    int     shift;
+    if (!fix16_cordic_scale(inY, inX, &x, &y, &shift))
+        return (0);
+
+    /* The rotations do not end exactly on the axes, which have exact
+     * binary angles. Half a turn is also minus half a turn.
+     */
+    if (y == 0)
+        return ((x < 0) ? fix16_angle_half : 0U);
+    if (x == 0)
+        return ((y < 0) ? -fix16_angle_quarter : fix16_angle_quarter);
+
+    fix16_angle_t offset = 0;
+    if (x < 0)
+    {
+        offset = fix16_angle_half;
+        x      = -x;
+        y      = -y;
+    }
+
+    return (offset + (uint32_t)fix16_cordic_vector(&x, &y,
+                                                   fix16_cordic_atan_turn,
+                                                   FIX16_CORDIC_STEPS));
+}
+
+void fix16_cordic_sincos_array(fix16_t* s, fix16_t* c, const fix16_t* angle,
+                               size_t n, unsigned iterations)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        fix16_cordic_sincos(angle[i], &s[i], &c[i], iterations);
+}
+
+void fix16_cordic_atan2_array(fix16_t* angle, fix16_t* hypot,
+                              const fix16_t* y, const fix16_t* x, size_t n,
+                              unsigned iterations)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        angle[i] = fix16_cordic_atan2(y[i], x[i], hypot ? &hypot[i] : NULL,
+                                      iterations);
+    }
+}
@@ -0,0 +1,347 @@
+#include "fix16.h"
+#include "fix16_array.h"
+#include "uint32_inline.h"
+
+/* Division by an invariant divisor, after Möller and Granlund, "Improved
+ * division by invariant integers", IEEE Trans. Computers, 2011.
+ *
+ * The dividend a << 16 is a 64 bit number and the divisor is normalized so
+ * that its top bit is set. With the precomputed reciprocal v the 64/32 bit
+ * division reduces to one 32*32->64 bit product, one 32 bit product and at
+ * most two corrections. The remainder is exact, so the rounding of fix16_div
+ * can be reproduced bit for bit.
+ */
+
+/* Seed for fix16_recip_norm(): floor(2^63 / m) >> 16 at the midpoint m of
+ * each of the 128 intervals selected by the 7 bits below the leading one.
+ */
+static const uint16_t fix16_recip_seed[128] = {
+    0xFF00, 0xFD08, 0xFB18, 0xF92F, 0xF74E, 0xF574, 0xF3A0, 0xF1D4,
+    0xF00F, 0xEE50, 0xEC97, 0xEAE5, 0xE939, 0xE793, 0xE5F3, 0xE459,
+    0xE2C4, 0xE135, 0xDFAC, 0xDE27, 0xDCA8, 0xDB2F, 0xD9BA, 0xD84A,
+    0xD6DF, 0xD578, 0xD417, 0xD2BA, 0xD161, 0xD00D, 0xCEBC, 0xCD71,
+    0xCC29, 0xCAE5, 0xC9A6, 0xC86A, 0xC732, 0xC5FE, 0xC4CE, 0xC3A1,
+    0xC278, 0xC152, 0xC030, 0xBF11, 0xBDF5, 0xBCDD, 0xBBC8, 0xBAB6,
+    0xB9A7, 0xB89B, 0xB793, 0xB68D, 0xB58A, 0xB48A, 0xB38C, 0xB292,
+    0xB19A, 0xB0A5, 0xAFB3, 0xAEC3, 0xADD5, 0xACEB, 0xAC02, 0xAB1C,
+    0xAA39, 0xA957, 0xA879, 0xA79C, 0xA6C2, 0xA5E9, 0xA513, 0xA440,
+    0xA36E, 0xA29E, 0xA1D1, 0xA105, 0xA03C, 0x9F74, 0x9EAE, 0x9DEB,
+    0x9D29, 0x9C69, 0x9BAA, 0x9AEE, 0x9A33, 0x997A, 0x98C3, 0x980E,
+    0x975A, 0x96A8, 0x95F7, 0x9548, 0x949B, 0x93EF, 0x9345, 0x929C,
+    0x91F5, 0x9150, 0x90AB, 0x9009, 0x8F67, 0x8EC7, 0x8E29, 0x8D8B,
+    0x8CF0, 0x8C55, 0x8BBC, 0x8B24, 0x8A8D, 0x89F8, 0x8964, 0x88D1,
+    0x883F, 0x87AF, 0x8720, 0x8692, 0x8605, 0x8579, 0x84EE, 0x8465,
+    0x83DC, 0x8355, 0x82CF, 0x824A, 0x81C6, 0x8143, 0x80C1, 0x8040,
+};
+
+/* Approximates 2^63 / d for a normalized d (bit 31 set). Two Newton-Raphson
+ * steps r' = r + r * (2^63 - d * r) / 2^63 refine the 8 bit seed; the result
+ * is within [-1, +2] of floor(2^63 / d), clamped to 0xFFFFFFFF.
+ */
+static inline uint32_t fix16_recip_norm(uint32_t d)
+{
+    uint32_t r = (uint32_t)fix16_recip_seed[(d >> 24U) & 0x7FU] << 16U;
+    uint8_t  i;
+
+    for (i = 0U; i < 2U; i++)
+    {
+        uint32_t lo;
+        uint32_t hi = uint32_mul(d, r, &lo);
+
+        // (d * r - 2^63) >> 31, which is small after the seed. The step
+        // r * error >> 32 is applied with the opposite sign, without a
+        // branch on the sign of the error.
+        uint32_t error = ((hi - 0x80000000U) << 1U) | (lo >> 31U);
+        uint32_t sign  = 0U - (error >> 31U);
+        uint32_t step  = uint32_mul(r, (error ^ sign) - sign, &lo);
+        r -= (step ^ sign) - sign;
+    }
+
+    return (r);
+}
+
+/* Returns floor((2^64 - 1) / d) - 2^32 for a normalized d. The estimate from
+ * fix16_recip_norm() is lowered until it is below the exact value and then
+ * stepped up using the exact remainder.
+ */
+static uint32_t fix16_divisor_invert(uint32_t d)
+{
+    uint32_t r       = fix16_recip_norm(d);
+    uint32_t inverse = (r >= 0x80000003U) ? ((r - 3U) << 1U) : 0U;
+
+    // remainder = 2^64 - 1 - (2^32 + inverse) * d
+    uint32_t rem_lo;
+    uint32_t rem_hi = ~(uint32_mul(inverse, d, &rem_lo) + d);
+    rem_lo          = ~rem_lo;
+
+    while ((rem_hi != 0U) || (rem_lo >= d))
+    {
+        rem_hi -= (rem_lo < d) ? 1U : 0U;
+        rem_lo -= d;
+        inverse++;
+    }
+
+    return (inverse);
+}
+
+fix16_divisor_t fix16_divisor_create(fix16_t inDivisor)
+{
+    fix16_divisor_t d = {0U, 0U, 0U, 0U, 0U};
+    uint32_t        divider = fix_abs(inDivisor);
+
+    d.negative = (inDivisor < 0) ? (uint8_t)1U : (uint8_t)0U;
+    if (divider == 0U)
+    {
+        return (d);
+    }
+
+    // |a| << 16 >= |b| << 31 is the first dividend whose quotient does not
+    // fit in a fix16_t.
+    d.limit = (divider < 0x20000U) ? (divider << 15U) : 0xFFFFFFFFU;
+
+    d.shift   = uint32_clz(divider);
+    d.divider = divider << d.shift;
+    d.inverse = fix16_divisor_invert(d.divider);
+    return (d);
+}
+
+fix16_t fix16_div_by(fix16_t inArg0, const fix16_divisor_t* inDivisor)
+{
+    uint32_t divider = inDivisor->divider;
+    uint32_t num     = fix_abs(inArg0);
+
+    if (divider == 0U)
+    {
+        return (fix16_overflow_raise());
+    }
+
+    if (num >= inDivisor->limit)
+    {
+        return (fix16_overflow_raise());
+    }
+
+    // Dividend num << 16, normalized by the divisor's shift. The limit
+    // check guarantees u1 < divider.
+    uint8_t  shift = inDivisor->shift;
+    uint32_t u1    = (num >> 16U);
+    uint32_t u0    = (num << 16U);
+    if (shift != 0U)
+    {
+        u1 = (u1 << shift) | (u0 >> (32U - shift));
+        u0 <<= shift;
+    }
+
+    uint32_t q0;
+    uint32_t q1 = uint32_mul(inDivisor->inverse, u1, &q0);
+    q0 += u0;
+    q1 += u1 + 1U + ((q0 < u0) ? 1U : 0U);
+
+    uint32_t remainder = u0 - (q1 * divider);
+    if (remainder > q0)
+    {
+        q1--;
+        remainder += divider;
+    }
+    if (remainder >= divider)
+    {
+        q1++;
+        remainder -= divider;
+    }
+
+#ifndef FIXMATH_NO_ROUNDING
+    // Round half up on the magnitude, as fix16_div does.
+    if (remainder >= (divider - remainder))
+    {
+        q1++;
+    }
+#endif
+
+    // A magnitude of 2^31 yields fix16_overflow for either sign.
+#ifdef FIXMATH_STICKY_OVERFLOW
+    fix16_overflow_sticky |= (uint16_t)(q1 >> 31U);
+#endif
+    if ((((uint32_t)inArg0 >> 31U) ^ inDivisor->negative) != 0U)
+    {
+        q1 = 0U - q1;
+    }
+
+    return ((fix16_t)q1);
+}
+
+#ifndef FIXMATH_NO_OVERFLOW
+/* Mirrors the fix16_sdiv wrapper. */
+fix16_t fix16_sdiv_by(fix16_t inArg0, const fix16_divisor_t* inDivisor)
+{
+    fix16_t result = fix16_div_by(inArg0, inDivisor);
+
+    if (result == fix16_overflow)
+    {
+        if ((inArg0 >= 0) == (inDivisor->negative == 0U))
+        {
+            result = fix16_maximum;
+        }
+        else
+        {
+            result = fix16_minimum;
+        }
+    }
+
+    return (result);
+}
+#endif
+
+fix16_t fix16_recip(fix16_t inArg)
+{
+    uint32_t divider = fix_abs(inArg);
+
+    if (divider == 0U)
+    {
+        return (fix16_overflow_raise());
+    }
+
+    // 2^32 / 2 is the first magnitude that does not fit.
+    if (divider <= 2U)
+    {
+        return (fix16_overflow_raise());
+    }
+
+    // 2^32 / divider from 2^63 / (divider << shift), low by at most 2.
+    uint8_t  shift    = uint32_clz(divider);
+    uint32_t quotient = fix16_recip_norm(divider << shift) >> (31U - shift);
+
+    // Make quotient * divider <= 2^32, then fix up using the remainder.
+    uint32_t lo;
+    uint32_t hi = uint32_mul(quotient, divider, &lo);
+    while ((hi > 1U) || ((hi == 1U) && (lo != 0U)))
+    {
+        quotient--;
+        hi = uint32_mul(quotient, divider, &lo);
+    }
+
+    uint32_t remainder = 0U - lo;
+    while (remainder >= divider)
+    {
+        quotient++;
+        remainder -= divider;
+    }
+
+#ifndef FIXMATH_NO_ROUNDING
+    if (remainder >= (divider - remainder))
+    {
+        quotient++;
+    }
+#endif
+
+#ifndef FIXMATH_NO_OVERFLOW
+    if (quotient & 0x80000000U)
+    {
+        return (fix16_overflow_raise());
+    }
+#endif
+
+    return ((fix16_t)((inArg < 0) ? (0U - quotient) : quotient));
+}
+
+#ifndef FIXMATH_NO_OVERFLOW
+/* Mirrors the fix16_sdiv wrapper. */
+fix16_t fix16_srecip(fix16_t inArg)
+{
+    fix16_t result = fix16_recip(inArg);
+
+    if (result == fix16_overflow)
+    {
+        result = (inArg >= 0) ? fix16_maximum : fix16_minimum;
+    }
+
+    return (result);
+}
+#endif
+
+#ifdef FIXMATH_FAST_DIV
+/* fix16_div as a multiplication by a 32-bit reciprocal of the divisor.
+ * Unlike fix16_div_by() the quotient is not corrected, see fix16.h for the
+ * resulting error.
+ */
+fix16_t fix16_div(fix16_t a, fix16_t b)
+{
+    uint32_t divider = fix_abs(b);
+
+    if (divider == 0U)
+    {
+        return (fix16_overflow_raise());
+    }
+
+    // |a| / |b| in Q16.16 is (|a| * 2^63 / d) >> (47 - shift) with the
+    // normalized d = |b| << shift. Adding 2 to the estimate of 2^63 / d
+    // makes it an upper bound, so exact quotients and ties are kept. Near
+    // d = 2^31 that bound is 2^32, which is applied as a shift.
+    uint8_t  shift   = uint32_clz(divider);
+    uint32_t inverse = fix16_recip_norm(divider << shift);
+
+    uint32_t lo      = 0U;
+    uint32_t hi      = fix_abs(a);
+    if (inverse < 0xFFFFFFFDU)
+    {
+        hi = uint32_mul(hi, inverse + 2U, &lo);
+    }
+    uint8_t  bits    = 47U - shift;
+
+#ifndef FIXMATH_NO_ROUNDING
+    if (bits <= 32U)
+    {
+        uint32_t half = 1U << (bits - 1U);
+        lo += half;
+        hi += (lo < half) ? 1U : 0U;
+    }
+    else
+    {
+        hi += 1U << (bits - 33U);
+    }
+#endif
+
+    uint32_t quotient;
+    if (bits < 32U)
+    {
+#ifndef FIXMATH_NO_OVERFLOW
+        if ((hi >> bits) != 0U)
+        {
+            return (fix16_overflow_raise());
+        }
+#endif
+        quotient = (hi << (32U - bits)) | (lo >> bits);
+    }
+    else
+    {
+        quotient = hi >> (bits - 32U);
+    }
+
+#ifndef FIXMATH_NO_OVERFLOW
+    if (quotient & 0x80000000U)
+    {
+        return (fix16_overflow_raise());
+    }
+#endif
+
+    return ((fix16_t)(((a ^ b) < 0) ? (0U - quotient) : quotient));
+}
+#endif
+
+void fix16_div_by_array(fix16_t* dst, const fix16_t* a,
+                        const fix16_divisor_t* d, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_div_by(a[i], d);
+}
+
+#ifndef FIXMATH_NO_OVERFLOW
+void fix16_sdiv_by_array(fix16_t* dst, const fix16_t* a,
+                         const fix16_divisor_t* d, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_sdiv_by(a[i], d);
+}
+#endif
+
+/*** end of file ***/
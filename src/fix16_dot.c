@@ -0,0 +1,176 @@
+#include "fix16_simd.h"
+#include "int64.h"
+
+/* Fused multiply-add and dot products. The full 64 bit products are summed
+ * modulo 2^64 and the sum is rounded and saturated once, so the result does
+ * not depend on the order of the terms and the SIMD kernels match the scalar
+ * loop.
+ */
+
+/* Rounds a sum of Q32.32 products to Q16.16 the way fix16_mul rounds a single
+ * product, and saturates it unless FIXMATH_NO_OVERFLOW is defined.
+ */
+static inline fix16_t fix16_dot_round(int64_t sum)
+{
+#ifndef FIXMATH_NO_ROUNDING
+    // Add 0.5, minus 1 for negative sums so that -1/2 rounds away from zero.
+    sum = fix16_simd_add64(
+        sum, int64_from_int32(int64_cmp_lt(sum, int64_from_int32(0)) ? 0x7FFF
+                                                                     : 0x8000));
+#endif
+
+#ifndef FIXMATH_NO_OVERFLOW
+    if (int64_cmp_gt(sum, int64_const(0x7FFF, 0xFFFFFFFFU)))
+    {
+        return (fix16_maximum);
+    }
+    if (int64_cmp_lt(sum, int64_const(-0x8000, 0U)))
+    {
+        return (fix16_minimum);
+    }
+#endif
+
+    // Bits 16 to 47 of the sum.
+    return ((fix16_t)(((uint32_t)int64_hi(sum) << 16U) |
+                      (int64_lo(sum) >> 16U)));
+}
+
+fix16_t fix16_fma(fix16_t a, fix16_t b, fix16_t c)
+{
+    int64_t sum = int64_add(int64_mul_i32_i32(a, b),
+                            int64_const(c >> 16, (uint32_t)c << 16U));
+    return (fix16_dot_round(sum));
+}
+
+static inline int64_t fix16_dot_loop(const fix16_t* a, size_t stride_a,
+                                     const fix16_t* b, size_t stride_b,
+                                     size_t n, int64_t sum)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        sum = fix16_simd_add64(
+            sum, int64_mul_i32_i32(a[i * stride_a], b[i * stride_b]));
+    return (sum);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// SIMD KERNELS
+////////////////////////////////////////////////////////////////////////////////
+
+/* The lanes accumulate modulo 2^64 with the signed 32*32->64 bit multiply of
+ * the even lanes, the odd lanes are shifted down into the even ones first.
+ */
+#ifdef FIXMATH_SIMD_X86
+FIXMATH_TARGET_SSE41 static int64_t fix16_dot_sse41(const fix16_t* a,
+                                                    const fix16_t* b, size_t n)
+{
+    size_t  i     = 0;
+    __m128i lanes = _mm_setzero_si128();
+
+    for (; (i + 4U) <= n; i += 4U)
+    {
+        __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i odd =
+            _mm_mul_epi32(_mm_srli_epi64(va, 32), _mm_srli_epi64(vb, 32));
+        lanes = _mm_add_epi64(lanes, _mm_mul_epi32(va, vb));
+        lanes = _mm_add_epi64(lanes, odd);
+    }
+
+    int64_t sum = fix16_simd_fold64_sse41(lanes, int64_from_int32(0));
+    return (fix16_dot_loop(a + i, 1U, b + i, 1U, n - i, sum));
+}
+
+FIXMATH_TARGET_AVX2 static int64_t fix16_dot_avx2(const fix16_t* a,
+                                                  const fix16_t* b, size_t n)
+{
+    size_t  i     = 0;
+    __m256i lanes = _mm256_setzero_si256();
+
+    for (; (i + 8U) <= n; i += 8U)
+    {
+        __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(va, 32),
+                                       _mm256_srli_epi64(vb, 32));
+        lanes       = _mm256_add_epi64(lanes, _mm256_mul_epi32(va, vb));
+        lanes       = _mm256_add_epi64(lanes, odd);
+    }
+
+    int64_t sum = fix16_simd_fold64_avx2(lanes, int64_from_int32(0));
+    return (fix16_dot_loop(a + i, 1U, b + i, 1U, n - i, sum));
+}
+
+FIXMATH_TARGET_AVX512 static int64_t fix16_dot_avx512(const fix16_t* a,
+                                                      const fix16_t* b,
+                                                      size_t         n)
+{
+    size_t  i     = 0;
+    __m512i lanes = _mm512_setzero_si512();
+
+    for (; (i + 16U) <= n; i += 16U)
+    {
+        __m512i va = _mm512_loadu_si512(a + i);
+        __m512i vb = _mm512_loadu_si512(b + i);
+        __m512i odd = _mm512_mul_epi32(_mm512_srli_epi64(va, 32),
+                                       _mm512_srli_epi64(vb, 32));
+        lanes       = _mm512_add_epi64(lanes, _mm512_mul_epi32(va, vb));
+        lanes       = _mm512_add_epi64(lanes, odd);
+    }
+
+    // Masked loads read zeros past the end, which add nothing to the sum.
+    if (i < n)
+    {
+        __mmask16 m   = (__mmask16)((1U << (n - i)) - 1U);
+        __m512i   va  = _mm512_maskz_loadu_epi32(m, a + i);
+        __m512i   vb  = _mm512_maskz_loadu_epi32(m, b + i);
+        __m512i   odd = _mm512_mul_epi32(_mm512_srli_epi64(va, 32),
+                                         _mm512_srli_epi64(vb, 32));
+        lanes         = _mm512_add_epi64(lanes, _mm512_mul_epi32(va, vb));
+        lanes         = _mm512_add_epi64(lanes, odd);
+    }
+
+    return (fix16_simd_fold64_avx512(lanes, int64_from_int32(0)));
+}
+#endif /* FIXMATH_SIMD_X86 */
+
+////////////////////////////////////////////////////////////////////////////////
+// DISPATCH
+////////////////////////////////////////////////////////////////////////////////
+
+typedef int64_t (*fix16_dot_fn_t)(const fix16_t* a, const fix16_t* b,
+                                  size_t n);
+
+static int64_t fix16_dot_scalar(const fix16_t* a, const fix16_t* b, size_t n)
+{
+    return (fix16_dot_loop(a, 1U, b, 1U, n, int64_from_int32(0)));
+}
+
+/* Indexed by fix16_simd_e. */
+static const fix16_dot_fn_t fix16_dot_kernels[fix16_simd_count] = {
+#ifdef FIXMATH_SIMD_X86
+    fix16_dot_scalar,
+    fix16_dot_sse41,
+    fix16_dot_avx2,
+    fix16_dot_avx512,
+#else
+    fix16_dot_scalar,
+    fix16_dot_scalar,
+    fix16_dot_scalar,
+    fix16_dot_scalar,
+#endif
+};
+
+fix16_t fix16_dot(const fix16_t* a, const fix16_t* b, size_t n)
+{
+    return (fix16_dot_round(fix16_dot_kernels[fix16_simd_level()](a, b, n)));
+}
+
+fix16_t fix16_dot_strided(const fix16_t* a, size_t stride_a, const fix16_t* b,
+                          size_t stride_b, size_t n)
+{
+    return (fix16_dot_round(
+        fix16_dot_loop(a, stride_a, b, stride_b, n, int64_from_int32(0))));
+}
+
+/*** end of file ***/
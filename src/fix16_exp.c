@@ -1,4 +1,7 @@
-#include "fix16.h"
+#include "fix16_array.h"
+#include "fix16_cache.h"
+#include "int64.h"
+#include "uint32_inline.h"
 #ifdef __KERNEL__
 #include <linux/types.h>
 #define uint_fast8_t uint8_t
@@ -7,9 +10,67 @@
 #endif
 
 #ifndef FIXMATH_NO_CACHE
-static fix16_t _fix16_exp_cache_index[4096] = {0};
-static fix16_t _fix16_exp_cache_value[4096] = {0};
+FIXMATH_CACHE_STORAGE fix16_t _fix16_exp_cache_index[FIXMATH_CACHE_SIZE] = {0};
+FIXMATH_CACHE_STORAGE fix16_t _fix16_exp_cache_value[FIXMATH_CACHE_SIZE] = {0};
+#ifdef FIXMATH_CACHE_STATS
+FIXMATH_CACHE_STORAGE uint32_t _fix16_exp_cache_used[FIXMATH_CACHE_USED_WORDS];
 #endif
+#endif
+
+/* 2^(k/32) * 2^31 for k in [0, 32). */
+static const uint32_t fix16_exp2_table[32] = {
+    2147483648U, 2194507417U, 2242560872U, 2291666561U, 2341847524U,
+    2393127307U, 2445529972U, 2499080105U, 2553802834U, 2609723834U,
+    2666869345U, 2725266179U, 2784941738U, 2845924021U, 2908241642U,
+    2971923842U, 3037000500U, 3103502151U, 3171459999U, 3240905930U,
+    3311872529U, 3384393094U, 3458501653U, 3534232978U, 3611622603U,
+    3690706840U, 3771522796U, 3854108391U, 3938502376U, 4024744348U,
+    4112874773U, 4202935003U,
+};
+
+/* 2^(f / 2^32) * 2^31 for a fraction f in [0, 2^32): the top 5 bits of f
+ * index the table and the rest, below 1/32, goes into the Taylor polynomial
+ * of e^(r ln 2) up to the fourth power, which is accurate to 2^-31.
+ */
+static inline uint32_t fix16_exp2_frac(uint32_t f)
+{
+    uint32_t t  = fix16_exp2_table[f >> 27];
+    uint32_t u  = uint32_mulhi(f & 0x07FFFFFFU, 2977044472U); /* ln 2 */
+    uint32_t u2 = uint32_mulhi(u, u);
+    uint32_t u3 = uint32_mulhi(u2, u);
+    uint32_t u4 = uint32_mulhi(u3, u);
+    uint32_t p  = u + (u2 >> 1) + uint32_mulhi(u3, 715827883U) /* 1/6 */
+                 + uint32_mulhi(u4, 178956971U);              /* 1/24 */
+    return (t + uint32_mulhi(t, p));
+}
+
+/* 2^n * m / 2^31 as a fix16_t, for a mantissa m in [2^31, 2^32). */
+static inline fix16_t fix16_exp2_scale(int32_t n, uint32_t m)
+{
+    int shift = 15 - n;
+    if (shift <= 0)
+    {
+        if ((shift < 0) || (m > (uint32_t)fix16_maximum))
+            return (fix16_maximum);
+        return ((fix16_t)m);
+    }
+    if (shift > 32)
+        return (0);
+#ifndef FIXMATH_NO_ROUNDING
+    /* m is at least 2^31, so half an LSB rounds up for shift == 32, and
+     * only shift == 1 can round up to 2^31.
+     */
+    if (shift == 32)
+        return (1);
+    uint32_t result = (m >> shift) + ((m >> (shift - 1)) & 1U);
+    return ((result > (uint32_t)fix16_maximum) ? fix16_maximum
+                                               : (fix16_t)result);
+#else
+    if (shift == 32)
+        return (0);
+    return ((fix16_t)(m >> shift));
+#endif
+}
 
 fix16_t fix16_exp(fix16_t inValue)
 {
@@ -23,41 +84,30 @@ fix16_t fix16_exp(fix16_t inValue)
         return (0);
 
 #ifndef FIXMATH_NO_CACHE
-    fix16_t tempIndex = (inValue ^ (inValue >> 4)) & 0x0FFF;
+    uint32_t tempIndex = FIXMATH_EXP_CACHE_HASH(inValue) & FIXMATH_CACHE_MASK;
     if (_fix16_exp_cache_index[tempIndex] == inValue)
+    {
+#ifdef FIXMATH_CACHE_STATS
+        fix16_cache_hit(fix16_cache_exp);
+#endif
         return (_fix16_exp_cache_value[tempIndex]);
+    }
 #endif
 
-    /* The algorithm is based on the power series for exp(x):
-     * http://en.wikipedia.org/wiki/Exponential_function#Formal_definition
-     *
-     * From term n, we get term n+1 by multiplying with x/n.
-     * When the sum term drops to zero, we can stop summing.
+    /* e^x = 2^(x log2(e)) = 2^n * 2^f, with x log2(e) * 2^46 from one
+     * product: the integer part n is above bit 46 and the fraction f the
+     * 32 bits below it. No division and no loop, and negative inputs need
+     * no reciprocal.
      */
-
-    // The power-series converges much faster on positive values
-    // and exp(-x) = 1/exp(x).
-    bool neg = (inValue < 0);
-    if (neg)
-        inValue = -inValue;
-
-    fix16_t      result = inValue + fix16_one;
-    fix16_t      term   = inValue;
-
-    uint_fast8_t i;
-    for (i = 2; i < 30; i++)
-    {
-        term = fix16_mul(term, fix16_div(inValue, fix16_from_int((int)i)));
-        result += term;
-
-        if ((term < 500) && ((i > 15) || (term < 20)))
-            break;
-    }
-
-    if (neg)
-        result = fix16_div(fix16_one, result);
+    int64_t  t      = int64_mul_i32_i32(inValue, 1549082005); /* log2(e) */
+    int32_t  n      = int64_hi(t) >> 14;
+    uint32_t f      = ((uint32_t)int64_hi(t) << 18) | (int64_lo(t) >> 14);
+    fix16_t  result = fix16_exp2_scale(n, fix16_exp2_frac(f));
 
 #ifndef FIXMATH_NO_CACHE
+#ifdef FIXMATH_CACHE_STATS
+    fix16_cache_miss(fix16_cache_exp, _fix16_exp_cache_used, tempIndex);
+#endif
     _fix16_exp_cache_index[tempIndex] = inValue;
     _fix16_exp_cache_value[tempIndex] = result;
 #endif
@@ -65,95 +115,81 @@ fix16_t fix16_exp(fix16_t inValue)
     return (result);
 }
 
-fix16_t fix16_log(fix16_t inValue)
+void fix16_exp_array(fix16_t* dst, const fix16_t* src, size_t n)
 {
-    fix16_t guess = F16(2);
-    fix16_t delta;
-    int     scaling = 0;
-    int     count   = 0;
-
-    if (inValue <= 0)
-        return (fix16_minimum);
-
-    // Bring the value to the most accurate range (1 < x < 100)
-    const fix16_t e_to_fourth = 3578144;
-    while (inValue > F16(100))
-    {
-        inValue = fix16_div(inValue, e_to_fourth);
-        scaling += 4;
-    }
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_exp(src[i]);
+}
 
-    while (inValue < fix16_one)
-    {
-        inValue = fix16_mul(inValue, e_to_fourth);
-        scaling -= 4;
-    }
+/* 2^32 / (1 + k/32) for k in [0, 32), the first clamped to 2^32 - 1. */
+static const uint32_t fix16_log2_inv[32] = {
+    4294967295U, 4164816772U, 4042322161U, 3926827242U, 3817748708U,
+    3714566310U, 3616814565U, 3524075730U, 3435973837U, 3352169597U,
+    3272356035U, 3196254732U, 3123612579U, 3054198966U, 2987803336U,
+    2924233053U, 2863311531U, 2804876601U, 2748779069U, 2694881441U,
+    2643056798U, 2593187801U, 2545165805U, 2498890063U, 2454267026U,
+    2411209710U, 2369637129U, 2329473788U, 2290649225U, 2253097598U,
+    2216757314U, 2181570690U,
+};
 
-    do
-    {
-        // Solving e(x) = y using Newton's method
-        // f(x) = e(x) - y
-        // f'(x) = e(x)
-        fix16_t e = fix16_exp(guess);
-        delta     = fix16_div(inValue - e, e);
+/* log2(1 + k/32) * 2^31 for k in [0, 32). */
+static const uint32_t fix16_log2_table[32] = {
+    0U,          95335645U,   187825021U,  277633165U,  364911162U,
+    449797678U,  532420281U,  612896598U,  691335320U,  767837083U,
+    842495250U,  915396590U,  986621888U,  1056246482U, 1124340739U,
+    1190970490U, 1256197405U, 1320079339U, 1382670639U, 1444022426U,
+    1504182841U, 1563197273U, 1621108567U, 1677957208U, 1733781493U,
+    1788617686U, 1842500157U, 1895461516U, 1947532725U, 1998743213U,
+    2049120974U, 2098692655U,
+};
 
-        // It's unlikely that logarithm is very large, so avoid overshooting.
-        if (delta > F16(3))
-            delta = F16(3);
+/* log2(x / 2^16) * 2^26 for x > 0, within 2^-26.
+ *
+ * The leading one of x gives the integer part, and shifting it to bit 31
+ * leaves the mantissa m in [1, 2). The 5 bits after the leading one pick
+ * 1 + k/32 <= m, so that m = (1 + k/32)(1 + r) with r in [0, 1/32), and
+ * log2(m) is log2(1 + k/32) from the table plus log2(1 + r) from the series
+ * of ln(1 + r) up to the fourth power. The series is evaluated in s = 32r.
+ */
+static inline int32_t fix16_log2_q26(fix16_t x)
+{
+    uint8_t  lz = uint32_clz((uint32_t)x);
+    uint32_t m  = (uint32_t)x << lz;
+    uint32_t k  = (m >> 26) & 31U;
+    uint32_t s  = uint32_mulhi((m & 0x03FFFFFFU) << 6, fix16_log2_inv[k]);
+    uint32_t s2 = uint32_mulhi(s, s);
+    uint32_t s3 = uint32_mulhi(s2, s);
+    uint32_t s4 = uint32_mulhi(s3, s);
 
-        guess += delta;
-    } while ((count++ < 10) && ((delta > 1) || (delta < -1)));
+    /* ln(1 + r) * 2^37 and log2(m) * 2^31. */
+    uint32_t l  = s - (s2 >> 6)
+                 + (uint32_mulhi(s3, 1431655765U) >> 10) /* 1/3 */
+                 - (s4 >> 17);
+    uint32_t f  = fix16_log2_table[k]
+                 + (uint32_mulhi(l, 3098164009U) >> 5); /* log2(e) */
 
-    return guess + fix16_from_int(scaling);
+    return ((15 - (int32_t)lz) * (1 << 26) + (int32_t)((f + 16U) >> 5));
 }
 
-static inline fix16_t fix16_rs(fix16_t x)
+/* x / 2^shift, rounded unless FIXMATH_NO_ROUNDING. */
+static inline fix16_t fix16_log_round(int32_t x, int shift)
 {
-#ifdef FIXMATH_NO_ROUNDING
-    return (x >> 1);
+#ifndef FIXMATH_NO_ROUNDING
+    return ((x + (1 << (shift - 1))) >> shift);
 #else
-    fix16_t y = (x >> 1) + (x & 1);
-    return (y);
+    return (x >> shift);
 #endif
 }
 
-/**
- * This assumes that the input value is >= 1.
- *
- * Note that this is only ever called with inValue >= 1 (because it has a
- * wrapper to check. As such, the result is always less than the input.
- */
-static fix16_t fix16__log2_inner(fix16_t x)
+fix16_t fix16_log(fix16_t inValue)
 {
-    fix16_t result = 0;
-
-    while (x >= F16(2))
-    {
-        result++;
-        x = fix16_rs(x);
-    }
-
-    if (x == 0)
-        return (result << 16);
-
-    uint_fast8_t i;
-    for (i = 16; i > 0; i--)
-    {
-        x = fix16_mul(x, x);
-        result <<= 1;
-        if (x >= F16(2))
-        {
-            result |= 1;
-            x = fix16_rs(x);
-        }
-    }
-#ifndef FIXMATH_NO_ROUNDING
-    x = fix16_mul(x, x);
-    if (x >= F16(2))
-        result++;
-#endif
+    if (inValue <= 0)
+        return (fix16_minimum);
 
-    return (result);
+    /* ln(x) = log2(x) ln(2), with ln(2) * 2^31. */
+    int64_t t = int64_mul_i32_i32(fix16_log2_q26(inValue), 1488522236);
+    return (fix16_log_round(int64_hi(t), 9));
 }
 
 /**
@@ -177,21 +213,7 @@ fix16_t fix16_log2(fix16_t x)
     if (x <= 0)
         return (fix16_overflow);
 
-    // If the input is less than one, the result is -log2(1.0 / in)
-    if (x < fix16_one)
-    {
-        // Note that the inverse of this would overflow.
-        // This is the exact answer for log2(1.0 / 65536)
-        if (x == 1)
-            return fix16_from_int(-16);
-
-        fix16_t inverse = fix16_div(fix16_one, x);
-        return -fix16__log2_inner(inverse);
-    }
-
-    // If input >= 1, just proceed as normal.
-    // Note that x == fix16_one is a special case, where the answer is 0.
-    return (fix16__log2_inner(x));
+    return (fix16_log_round(fix16_log2_q26(x), 10));
 }
 
 /**
@@ -205,3 +227,213 @@ fix16_t fix16_slog2(fix16_t x)
         return (fix16_minimum);
     return (retval);
 }
+
+fix16_t fix16_log10(fix16_t inValue)
+{
+    if (inValue <= 0)
+        return (fix16_minimum);
+
+    /* log10(x) = log2(x) log10(2), with log10(2) * 2^32. */
+    int64_t t = int64_mul_i32_i32(fix16_log2_q26(inValue), 1292913986);
+    return (fix16_log_round(int64_hi(t), 10));
+}
+
+void fix16_log_array(fix16_t* dst, const fix16_t* src, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_log(src[i]);
+}
+
+void fix16_log2_array(fix16_t* dst, const fix16_t* src, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_log2(src[i]);
+}
+
+void fix16_log10_array(fix16_t* dst, const fix16_t* src, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_log10(src[i]);
+}
+
+fix16_t fix16_exp2(fix16_t inValue)
+{
+    /* The integer part and the fraction are the bits of inValue. */
+    return (fix16_exp2_scale(inValue >> 16,
+                             fix16_exp2_frac((uint32_t)inValue << 16)));
+}
+
+void fix16_exp2_array(fix16_t* dst, const fix16_t* src, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_exp2(src[i]);
+}
+
+/* The integer powers are computed on a mantissa m in [2^31, 2^32) and an
+ * exponent e for the value m * 2^(e - 31), so that the rounding of each
+ * product is 2^-32 of the value and not an LSB of fix16_t.
+ */
+
+/* *m * 2^*e times b * 2^eb, with the product rounded to 32 bits. The
+ * product is in [2^62, 2^64) and shifted left by s = 1 if it is below 2^63,
+ * without a branch.
+ */
+static inline void fix16_pow_mul(uint32_t* m, int32_t* e, uint32_t b,
+                                 int32_t eb)
+{
+    uint32_t hi = uint32_mulhi(*m, b);
+    uint32_t lo = *m * b;
+    uint32_t s  = 1U - (hi >> 31);
+
+    hi = (hi << s) | ((lo >> 31) & s);
+    lo <<= s;
+    *m = hi + (lo >> 31);
+    *e += eb + 1 - (int32_t)s;
+
+    /* Rounding up from 2^32 - 1. */
+    if (*m == 0U)
+    {
+        *m = 0x80000000U;
+        *e += 1;
+    }
+}
+
+/* floor(2^63 / m) for m in (2^31, 2^32). */
+static inline uint32_t fix16_pow_recip(uint32_t m)
+{
+#ifndef FIXMATH_NO_64BIT
+    return ((uint32_t)(((uint64_t)1 << 63) / m));
+#else
+    uint32_t remainder = 0x80000000U;
+    uint32_t quotient  = 0U;
+    int      i;
+    for (i = 0; i < 32; i++)
+    {
+        uint32_t carry = remainder >> 31;
+        remainder <<= 1;
+        quotient <<= 1;
+        if (carry || (remainder >= m))
+        {
+            remainder -= m;
+            quotient |= 1U;
+        }
+    }
+    return (quotient);
+#endif
+}
+
+fix16_t fix16_powi(fix16_t x, int32_t n)
+{
+    if (n == 0)
+        return (fix16_one);
+    if (x == 0)
+        return ((n > 0) ? 0 : fix16_overflow_raise());
+
+    uint32_t ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t un = (n < 0) ? -(uint32_t)n : (uint32_t)n;
+    uint8_t  lz = uint32_clz(ax);
+
+    /* Square-and-multiply. The powers of |x| move away from 1, so once the
+     * base is beyond the range of fix16_t every further product is too.
+     */
+    uint32_t bm = ax << lz;
+    int32_t  be = 15 - (int32_t)lz;
+    uint32_t m  = 0x80000000U;
+    int32_t  e  = 0;
+    for (;;)
+    {
+        if (un & 1U)
+            fix16_pow_mul(&m, &e, bm, be);
+        un >>= 1;
+        if ((un == 0U) || (be > 16) || (be < -17))
+            break;
+        fix16_pow_mul(&bm, &be, bm, be);
+    }
+
+    if (un != 0U)
+        e = (be > 0) ? 64 : -64;
+
+    if (n < 0)
+    {
+        /* 2^(31 - e) / m, as a mantissa and exponent again. */
+        if (m == 0x80000000U)
+        {
+            e = -e;
+        }
+        else
+        {
+            m = fix16_pow_recip(m);
+            e = -e - 1;
+        }
+    }
+
+    /* The mantissa is at least 2^31, so 2^15 and above do not fit. */
+    if (e > 14)
+        return (fix16_overflow_raise());
+
+    fix16_t result = fix16_exp2_scale(e, m);
+    return (((x < 0) && (n & 1)) ? -result : result);
+}
+
+fix16_t fix16_pow(fix16_t x, fix16_t y)
+{
+    /* Integer exponents, also of negative bases, are exact powers. */
+    if ((y & 0xFFFF) == 0)
+        return (fix16_powi(x, y >> 16));
+
+    if (x <= 0)
+        return (((x == 0) && (y > 0)) ? 0 : fix16_overflow_raise());
+
+    /* x^y = 2^(y log2(x)), with y log2(x) * 2^42 from one product: the
+     * integer part is above bit 42 and the fraction the 32 bits below it.
+     */
+    int64_t  t = int64_mul_i32_i32(fix16_log2_q26(x), y);
+    int32_t  n = int64_hi(t) >> 10;
+    uint32_t f = ((uint32_t)int64_hi(t) << 22) | (int64_lo(t) >> 10);
+    if (n > 14)
+        return (fix16_overflow_raise());
+    return (fix16_exp2_scale(n, fix16_exp2_frac(f)));
+}
+
+#ifndef FIXMATH_NO_OVERFLOW
+fix16_t fix16_spowi(fix16_t x, int32_t n)
+{
+    fix16_t result = fix16_powi(x, n);
+
+    if (result == fix16_overflow)
+    {
+        result = ((x < 0) && (n & 1)) ? fix16_minimum : fix16_maximum;
+    }
+
+    return (result);
+}
+
+fix16_t fix16_spow(fix16_t x, fix16_t y)
+{
+    /* A negative base with a fractional exponent has no real power. */
+    if ((x < 0) && (y & 0xFFFF))
+        return (fix16_overflow_raise());
+    if ((y & 0xFFFF) == 0)
+        return (fix16_spowi(x, y >> 16));
+
+    fix16_t result = fix16_pow(x, y);
+
+    if (result == fix16_overflow)
+    {
+        result = fix16_maximum;
+    }
+
+    return (result);
+}
+#endif
+
+void fix16_pow_array(fix16_t* dst, const fix16_t* src, fix16_t y, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_pow(src[i], y);
+}
@@ -66,8 +66,10 @@ static void butterfly(fix16_t* real, fix16_t* imag, unsigned blocksize,
     for (i = 0; i < blocksize; i++)
     {
         fix16_t  angle = fix16_pi * i / blocksize;
-        fix16_t  c     = fix16_cos(angle);
-        fix16_t  s     = -fix16_sin(angle);
+        fix16_t  c;
+        fix16_t  s;
+        fix16_sincos(angle, &s, &c);
+        s              = -s;
 
         fix16_t* rp    = real + i;
         fix16_t* ip    = imag + i;
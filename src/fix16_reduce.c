@@ -0,0 +1,404 @@
+#include "fix16_simd.h"
+
+/* Reductions over arrays of fix16_t. Sums go into a fix16_acc_t, so every
+ * kernel gives the same result as the scalar loop regardless of the order in
+ * which the lanes are added.
+ */
+
+static inline fix16_acc_t fix16_sum_loop(const fix16_t* a, size_t n,
+                                         fix16_acc_t acc)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        acc = fix16_acc_add(acc, a[i]);
+    return (acc);
+}
+
+static inline fix16_acc_t fix16_sumsq_loop(const fix16_t* a, size_t n,
+                                           fix16_acc_t acc)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        acc = fix16_acc_mac(acc, a[i], a[i]);
+    return (acc);
+}
+
+/* The maximum is found as the minimum of the complemented values, since ~x
+ * reverses the order of signed integers. flip is 0 or ~0.
+ */
+static inline fix16_t fix16_min_loop(const fix16_t* a, size_t n, fix16_t flip,
+                                     fix16_t min)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        fix16_t x = a[i] ^ flip;
+        if (x < min)
+            min = x;
+    }
+    return (min);
+}
+
+static inline size_t fix16_find_loop(const fix16_t* a, size_t n, fix16_t x)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+    {
+        if (a[i] == x)
+            break;
+    }
+    return (i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// SIMD KERNELS
+////////////////////////////////////////////////////////////////////////////////
+
+/* Squares are never negative, so rounding them only needs the added half
+ * before the logical shift down to 16 fraction bits.
+ */
+#ifdef FIXMATH_NO_ROUNDING
+#define FIX16_REDUCE_HALF 0
+#else
+#define FIX16_REDUCE_HALF 0x8000
+#endif
+
+#ifdef FIXMATH_SIMD_X86
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_SSE41 fix16_t
+fix16_min_fold_sse41(__m128i lanes)
+{
+    lanes = _mm_min_epi32(lanes,
+                          _mm_shuffle_epi32(lanes, _MM_SHUFFLE(1, 0, 3, 2)));
+    lanes = _mm_min_epi32(lanes,
+                          _mm_shuffle_epi32(lanes, _MM_SHUFFLE(2, 3, 0, 1)));
+    return (_mm_cvtsi128_si32(lanes));
+}
+
+FIXMATH_TARGET_SSE41 static fix16_acc_t fix16_sum_sse41(const fix16_t* a,
+                                                        size_t         n)
+{
+    size_t  i     = 0;
+    __m128i lanes = _mm_setzero_si128();
+
+    for (; (i + 4U) <= n; i += 4U)
+    {
+        __m128i v  = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i lo = _mm_cvtepi32_epi64(v);
+        __m128i hi = _mm_cvtepi32_epi64(_mm_srli_si128(v, 8));
+        lanes      = _mm_add_epi64(lanes, _mm_add_epi64(lo, hi));
+    }
+
+    return (fix16_sum_loop(a + i, n - i,
+                           fix16_simd_fold64_sse41(lanes, fix16_acc_zero())));
+}
+
+FIXMATH_TARGET_SSE41 static fix16_acc_t fix16_sumsq_sse41(const fix16_t* a,
+                                                          size_t         n)
+{
+    size_t  i     = 0;
+    __m128i half  = _mm_set1_epi64x(FIX16_REDUCE_HALF);
+    __m128i lanes = _mm_setzero_si128();
+
+    for (; (i + 4U) <= n; i += 4U)
+    {
+        __m128i v    = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i even = _mm_mul_epi32(v, v);
+        __m128i odd  = _mm_srli_epi64(v, 32);
+        odd          = _mm_mul_epi32(odd, odd);
+        even         = _mm_srli_epi64(_mm_add_epi64(even, half), 16);
+        odd          = _mm_srli_epi64(_mm_add_epi64(odd, half), 16);
+        lanes        = _mm_add_epi64(lanes, _mm_add_epi64(even, odd));
+    }
+
+    return (fix16_sumsq_loop(a + i, n - i,
+                             fix16_simd_fold64_sse41(lanes, fix16_acc_zero())));
+}
+
+FIXMATH_TARGET_SSE41 static fix16_t fix16_min_sse41(const fix16_t* a,
+                                                    size_t n, fix16_t flip)
+{
+    size_t  i     = 0;
+    __m128i vflip = _mm_set1_epi32(flip);
+    __m128i lanes = _mm_set1_epi32(fix16_maximum);
+
+    for (; (i + 4U) <= n; i += 4U)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+        lanes     = _mm_min_epi32(lanes, _mm_xor_si128(v, vflip));
+    }
+
+    return (fix16_min_loop(a + i, n - i, flip, fix16_min_fold_sse41(lanes)));
+}
+
+FIXMATH_TARGET_SSE41 static size_t fix16_find_sse41(const fix16_t* a,
+                                                    size_t n, fix16_t x)
+{
+    size_t  i  = 0;
+    __m128i vx = _mm_set1_epi32(x);
+
+    for (; (i + 4U) <= n; i += 4U)
+    {
+        __m128i v    = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i eq   = _mm_cmpeq_epi32(v, vx);
+        int     mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask != 0)
+            return (i + (size_t)__builtin_ctz((unsigned)mask));
+    }
+
+    return (i + fix16_find_loop(a + i, n - i, x));
+}
+
+FIXMATH_TARGET_AVX2 static fix16_acc_t fix16_sum_avx2(const fix16_t* a,
+                                                      size_t         n)
+{
+    size_t  i     = 0;
+    __m256i lanes = _mm256_setzero_si256();
+
+    for (; (i + 8U) <= n; i += 8U)
+    {
+        __m256i v  = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v));
+        __m256i hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1));
+        lanes      = _mm256_add_epi64(lanes, _mm256_add_epi64(lo, hi));
+    }
+
+    return (fix16_sum_loop(a + i, n - i,
+                           fix16_simd_fold64_avx2(lanes, fix16_acc_zero())));
+}
+
+FIXMATH_TARGET_AVX2 static fix16_acc_t fix16_sumsq_avx2(const fix16_t* a,
+                                                        size_t         n)
+{
+    size_t  i     = 0;
+    __m256i half  = _mm256_set1_epi64x(FIX16_REDUCE_HALF);
+    __m256i lanes = _mm256_setzero_si256();
+
+    for (; (i + 8U) <= n; i += 8U)
+    {
+        __m256i v    = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i even = _mm256_mul_epi32(v, v);
+        __m256i odd  = _mm256_srli_epi64(v, 32);
+        odd          = _mm256_mul_epi32(odd, odd);
+        even  = _mm256_srli_epi64(_mm256_add_epi64(even, half), 16);
+        odd   = _mm256_srli_epi64(_mm256_add_epi64(odd, half), 16);
+        lanes = _mm256_add_epi64(lanes, _mm256_add_epi64(even, odd));
+    }
+
+    return (fix16_sumsq_loop(a + i, n - i,
+                             fix16_simd_fold64_avx2(lanes, fix16_acc_zero())));
+}
+
+FIXMATH_TARGET_AVX2 static fix16_t fix16_min_avx2(const fix16_t* a, size_t n,
+                                                  fix16_t flip)
+{
+    size_t  i     = 0;
+    __m256i vflip = _mm256_set1_epi32(flip);
+    __m256i lanes = _mm256_set1_epi32(fix16_maximum);
+
+    for (; (i + 8U) <= n; i += 8U)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(a + i));
+        lanes     = _mm256_min_epi32(lanes, _mm256_xor_si256(v, vflip));
+    }
+
+    __m128i half = _mm_min_epi32(_mm256_castsi256_si128(lanes),
+                                 _mm256_extracti128_si256(lanes, 1));
+    return (fix16_min_loop(a + i, n - i, flip, fix16_min_fold_sse41(half)));
+}
+
+FIXMATH_TARGET_AVX2 static size_t fix16_find_avx2(const fix16_t* a, size_t n,
+                                                  fix16_t x)
+{
+    size_t  i  = 0;
+    __m256i vx = _mm256_set1_epi32(x);
+
+    for (; (i + 8U) <= n; i += 8U)
+    {
+        __m256i v    = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i eq   = _mm256_cmpeq_epi32(v, vx);
+        int     mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask != 0)
+            return (i + (size_t)__builtin_ctz((unsigned)mask));
+    }
+
+    return (i + fix16_find_loop(a + i, n - i, x));
+}
+
+/* The AVX-512 kernels handle the tail with masked loads. */
+FIXMATH_TARGET_AVX512 static fix16_acc_t fix16_sum_avx512(const fix16_t* a,
+                                                          size_t         n)
+{
+    size_t  i     = 0;
+    __m512i lanes = _mm512_setzero_si512();
+
+    for (; i < n; i += 16U)
+    {
+        __mmask16 m =
+            ((n - i) >= 16U) ? 0xFFFF : (__mmask16)((1U << (n - i)) - 1U);
+        __m512i v  = _mm512_maskz_loadu_epi32(m, a + i);
+        __m512i lo = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v));
+        __m512i hi = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1));
+        lanes      = _mm512_add_epi64(lanes, _mm512_add_epi64(lo, hi));
+    }
+
+    return (fix16_simd_fold64_avx512(lanes, fix16_acc_zero()));
+}
+
+FIXMATH_TARGET_AVX512 static fix16_acc_t fix16_sumsq_avx512(const fix16_t* a,
+                                                            size_t         n)
+{
+    size_t  i     = 0;
+    __m512i half  = _mm512_set1_epi64(FIX16_REDUCE_HALF);
+    __m512i lanes = _mm512_setzero_si512();
+
+    // Zeros past the end square to zero, and zero plus half rounds down.
+    for (; i < n; i += 16U)
+    {
+        __mmask16 m =
+            ((n - i) >= 16U) ? 0xFFFF : (__mmask16)((1U << (n - i)) - 1U);
+        __m512i v    = _mm512_maskz_loadu_epi32(m, a + i);
+        __m512i even = _mm512_mul_epi32(v, v);
+        __m512i odd  = _mm512_srli_epi64(v, 32);
+        odd          = _mm512_mul_epi32(odd, odd);
+        even  = _mm512_srli_epi64(_mm512_add_epi64(even, half), 16);
+        odd   = _mm512_srli_epi64(_mm512_add_epi64(odd, half), 16);
+        lanes = _mm512_add_epi64(lanes, _mm512_add_epi64(even, odd));
+    }
+
+    return (fix16_simd_fold64_avx512(lanes, fix16_acc_zero()));
+}
+
+FIXMATH_TARGET_AVX512 static fix16_t fix16_min_avx512(const fix16_t* a,
+                                                      size_t n, fix16_t flip)
+{
+    size_t  i     = 0;
+    __m512i vflip = _mm512_set1_epi32(flip);
+    __m512i lanes = _mm512_set1_epi32(fix16_maximum);
+
+    // Lanes past the end keep the initial maximum.
+    for (; i < n; i += 16U)
+    {
+        __mmask16 m =
+            ((n - i) >= 16U) ? 0xFFFF : (__mmask16)((1U << (n - i)) - 1U);
+        __m512i v = _mm512_maskz_loadu_epi32(m, a + i);
+        lanes     = _mm512_mask_min_epi32(lanes, m, lanes,
+                                          _mm512_xor_si512(v, vflip));
+    }
+
+    return (_mm512_reduce_min_epi32(lanes));
+}
+
+FIXMATH_TARGET_AVX512 static size_t fix16_find_avx512(const fix16_t* a,
+                                                      size_t n, fix16_t x)
+{
+    size_t  i  = 0;
+    __m512i vx = _mm512_set1_epi32(x);
+
+    for (; i < n; i += 16U)
+    {
+        __mmask16 m =
+            ((n - i) >= 16U) ? 0xFFFF : (__mmask16)((1U << (n - i)) - 1U);
+        __m512i   v  = _mm512_maskz_loadu_epi32(m, a + i);
+        __mmask16 eq = _mm512_mask_cmpeq_epi32_mask(m, v, vx);
+        if (eq != 0)
+            return (i + (size_t)__builtin_ctz((unsigned)eq));
+    }
+
+    return (n);
+}
+#endif /* FIXMATH_SIMD_X86 */
+
+////////////////////////////////////////////////////////////////////////////////
+// DISPATCH
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct
+{
+    fix16_acc_t (*sum)(const fix16_t* a, size_t n);
+    fix16_acc_t (*sumsq)(const fix16_t* a, size_t n);
+    fix16_t (*min)(const fix16_t* a, size_t n, fix16_t flip);
+    size_t (*find)(const fix16_t* a, size_t n, fix16_t x);
+} fix16_reduce_kernels_t;
+
+static fix16_acc_t fix16_sum_scalar(const fix16_t* a, size_t n)
+{
+    return (fix16_sum_loop(a, n, fix16_acc_zero()));
+}
+
+static fix16_acc_t fix16_sumsq_scalar(const fix16_t* a, size_t n)
+{
+    return (fix16_sumsq_loop(a, n, fix16_acc_zero()));
+}
+
+static fix16_t fix16_min_scalar(const fix16_t* a, size_t n, fix16_t flip)
+{
+    return (fix16_min_loop(a, n, flip, fix16_maximum));
+}
+
+static size_t fix16_find_scalar(const fix16_t* a, size_t n, fix16_t x)
+{
+    return (fix16_find_loop(a, n, x));
+}
+
+#define FIX16_REDUCE_SCALAR                                                    \
+    {                                                                          \
+        fix16_sum_scalar, fix16_sumsq_scalar, fix16_min_scalar,                \
+            fix16_find_scalar                                                  \
+    }
+
+/* Indexed by fix16_simd_e. */
+static const fix16_reduce_kernels_t fix16_reduce_kernels[fix16_simd_count] = {
+    FIX16_REDUCE_SCALAR,
+#ifdef FIXMATH_SIMD_X86
+    {fix16_sum_sse41, fix16_sumsq_sse41, fix16_min_sse41,
+     fix16_find_sse41},
+    {fix16_sum_avx2, fix16_sumsq_avx2, fix16_min_avx2, fix16_find_avx2},
+    {fix16_sum_avx512, fix16_sumsq_avx512, fix16_min_avx512,
+     fix16_find_avx512},
+#else
+    FIX16_REDUCE_SCALAR,
+    FIX16_REDUCE_SCALAR,
+    FIX16_REDUCE_SCALAR,
+#endif
+};
+
+static const fix16_reduce_kernels_t* fix16_reduce(void)
+{
+    return (&fix16_reduce_kernels[fix16_simd_level()]);
+}
+
+fix16_acc_t fix16_sum_array(const fix16_t* a, size_t n)
+{
+    return (fix16_reduce()->sum(a, n));
+}
+
+fix16_acc_t fix16_sumsq_array(const fix16_t* a, size_t n)
+{
+    return (fix16_reduce()->sumsq(a, n));
+}
+
+fix16_t fix16_min_array(const fix16_t* a, size_t n)
+{
+    return (fix16_reduce()->min(a, n, 0));
+}
+
+fix16_t fix16_max_array(const fix16_t* a, size_t n)
+{
+    return (~fix16_reduce()->min(a, n, ~0));
+}
+
+size_t fix16_argmin_array(const fix16_t* a, size_t n)
+{
+    if (n == 0)
+        return (0);
+    return (fix16_reduce()->find(a, n, fix16_min_array(a, n)));
+}
+
+size_t fix16_argmax_array(const fix16_t* a, size_t n)
+{
+    if (n == 0)
+        return (0);
+    return (fix16_reduce()->find(a, n, fix16_max_array(a, n)));
+}
+
+/*** end of file ***/
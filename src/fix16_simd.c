@@ -0,0 +1,101 @@
+#include "fix16_simd.h"
+
+#ifndef __KERNEL__
+#include <stdlib.h>
+#include <string.h>
+#endif
+
+#ifdef FIXMATH_SIMD_X86
+static fix16_simd_e fix16_simd_best   = fix16_simd_scalar;
+static fix16_simd_e fix16_simd_active = fix16_simd_scalar;
+
+/* Parses the FIXMATH_SIMD environment variable. Returns fix16_simd_count
+ * when it is unset or not recognized.
+ */
+static fix16_simd_e fix16_simd_from_env(void)
+{
+    const char* env = getenv("FIXMATH_SIMD");
+
+    if (env == NULL)
+        return (fix16_simd_count);
+    if (strcmp(env, "scalar") == 0)
+        return (fix16_simd_scalar);
+    if (strcmp(env, "sse4.1") == 0)
+        return (fix16_simd_sse41);
+    if (strcmp(env, "avx2") == 0)
+        return (fix16_simd_avx2);
+    if (strcmp(env, "avx512") == 0)
+        return (fix16_simd_avx512);
+    return (fix16_simd_count);
+}
+
+/* Runs once at load time, before any thread can call a kernel. */
+__attribute__((constructor)) static void fix16_simd_init(void)
+{
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+        fix16_simd_best = fix16_simd_avx512;
+    else if (__builtin_cpu_supports("avx2"))
+        fix16_simd_best = fix16_simd_avx2;
+    else if (__builtin_cpu_supports("sse4.1"))
+        fix16_simd_best = fix16_simd_sse41;
+    else
+        fix16_simd_best = fix16_simd_scalar;
+
+    fix16_simd_active = fix16_simd_best;
+    fix16_simd_force(fix16_simd_from_env());
+}
+
+fix16_simd_e fix16_simd_level(void)
+{
+    return (fix16_simd_active);
+}
+
+fix16_simd_e fix16_simd_supported(void)
+{
+    return (fix16_simd_best);
+}
+
+fix16_simd_e fix16_simd_force(fix16_simd_e level)
+{
+    if ((unsigned)level > (unsigned)fix16_simd_best)
+        level = fix16_simd_best;
+    fix16_simd_active = level;
+    return (fix16_simd_active);
+}
+#else
+fix16_simd_e fix16_simd_level(void)
+{
+    return (fix16_simd_scalar);
+}
+
+fix16_simd_e fix16_simd_supported(void)
+{
+    return (fix16_simd_scalar);
+}
+
+fix16_simd_e fix16_simd_force(fix16_simd_e level)
+{
+    (void)level;
+    return (fix16_simd_scalar);
+}
+#endif
+
+const char* fix16_simd_name(fix16_simd_e level)
+{
+    switch (level)
+    {
+    case fix16_simd_sse41:
+        return ("sse4.1");
+    case fix16_simd_avx2:
+        return ("avx2");
+    case fix16_simd_avx512:
+        return ("avx512");
+    case fix16_simd_scalar:
+    default:
+        return ("scalar");
+    }
+}
+
+/*** end of file ***/
@@ -0,0 +1,76 @@
+#ifndef libfixmath_fix16_simd_h__
+#define libfixmath_fix16_simd_h__
+
+/* Internal helpers shared by the vectorized kernels. The library is built
+ * for the baseline instruction set, the wider kernels are compiled per
+ * function with a target attribute and selected at run time through
+ * fix16_simd_level().
+ */
+
+#include "fix16_array.h"
+#include "int64.h"
+
+#if !defined(FIXMATH_NO_SIMD) && !defined(__KERNEL__) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define FIXMATH_SIMD_X86
+#include <immintrin.h>
+
+#define FIXMATH_TARGET_SSE41  __attribute__((target("sse4.1")))
+#define FIXMATH_TARGET_AVX2   __attribute__((target("avx2")))
+#define FIXMATH_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+#ifdef __GNUC__
+#define FIXMATH_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define FIXMATH_ALWAYS_INLINE inline
+#endif
+
+/* x + y modulo 2^64. int64_add() is a signed addition that must not
+ * overflow, this wraps like the 64 bit SIMD lanes do.
+ */
+static inline int64_t fix16_simd_add64(int64_t x, int64_t y)
+{
+#ifndef FIXMATH_NO_64BIT
+    return ((int64_t)((uint64_t)x + (uint64_t)y));
+#else
+    uint32_t lo = int64_lo(x) + int64_lo(y);
+    uint32_t hi = (uint32_t)int64_hi(x) + (uint32_t)int64_hi(y) +
+                  (lo < int64_lo(x));
+    return (int64_const((int32_t)hi, lo));
+#endif
+}
+
+#ifdef FIXMATH_SIMD_X86
+/* Adds the 64 bit lanes to sum. The lanes are read by their 32 bit halves,
+ * which also works with the int64.h emulation.
+ */
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_SSE41 int64_t
+fix16_simd_fold64_sse41(__m128i lanes, int64_t sum)
+{
+    lanes = _mm_add_epi64(lanes, _mm_unpackhi_epi64(lanes, lanes));
+    return (fix16_simd_add64(
+        sum, int64_const(_mm_extract_epi32(lanes, 1),
+                         (uint32_t)_mm_cvtsi128_si32(lanes))));
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX2 int64_t
+fix16_simd_fold64_avx2(__m256i lanes, int64_t sum)
+{
+    return (fix16_simd_fold64_sse41(
+        _mm_add_epi64(_mm256_castsi256_si128(lanes),
+                      _mm256_extracti128_si256(lanes, 1)),
+        sum));
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX512 int64_t
+fix16_simd_fold64_avx512(__m512i lanes, int64_t sum)
+{
+    return (fix16_simd_fold64_avx2(
+        _mm256_add_epi64(_mm512_castsi512_si256(lanes),
+                         _mm512_extracti64x4_epi64(lanes, 1)),
+        sum));
+}
+#endif
+
+#endif
@@ -1,91 +1,454 @@
 #include "fix16.h"
+#include "fix16_simd.h"
+#include "uint32_inline.h"
 
-/* The square root algorithm is quite directly from
- * http://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Binary_numeral_system_.28base_2.29
- * An important difference is that it is split to two parts
- * in order to use only 32-bit operations.
+/* Square roots from the inverse square root 1/sqrt(d) of a mantissa d in
+ * [1/4, 1), seeded from a table and refined with Newton's method. The seed
+ * table is indexed by the 7 top bits of d, the two Newton steps take its
+ * error of 2^-7 to about 2^-26.
  *
- * Note that for negative numbers we return -sqrt(-inValue).
+ * fix16_sqrt() and fix16_rsqrt() then correct the estimate by comparing its
+ * exact square with the argument. Vector normalization uses it directly.
+ */
+
+/* 1/sqrt(d) * 2^15 at the midpoint d of [k/128, (k+1)/128) for k in
+ * [32, 128).
+ */
+static const uint16_t fix16_rsqrt_seed[96] = {
+    65030, 64052, 63117, 62222, 61363, 60540, 59748, 58987, 58254, 57548,
+    56867, 56210, 55574, 54960, 54366, 53791, 53233, 52693, 52169, 51660,
+    51165, 50685, 50218, 49763, 49321, 48890, 48470, 48061, 47663, 47273,
+    46894, 46523, 46161, 45807, 45462, 45124, 44793, 44470, 44153, 43843,
+    43540, 43243, 42951, 42666, 42386, 42112, 41843, 41579, 41320, 41065,
+    40816, 40571, 40330, 40093, 39861, 39632, 39408, 39187, 38970, 38756,
+    38546, 38340, 38136, 37936, 37739, 37545, 37354, 37166, 36980, 36798,
+    36618, 36441, 36266, 36093, 35924, 35756, 35591, 35428, 35267, 35109,
+    34953, 34798, 34646, 34496, 34347, 34201, 34056, 33913, 33772, 33633,
+    33496, 33360, 33225, 33093, 32962, 32832,
+};
+
+/* 1/sqrt(m / 2^32) * 2^30 for m in [2^30, 2^32), within 2^-26. Each
+ * Newton step is y += y * (1 - d y^2) / 2, with d y^2 to 28 bits.
+ */
+static inline uint32_t fix16_rsqrt_norm(uint32_t m)
+{
+    uint32_t y = (uint32_t)fix16_rsqrt_seed[(m >> 25) - 32U] << 15;
+    int      i;
+    for (i = 0; i < 2; i++)
+    {
+        uint32_t dy2   = uint32_mulhi(m, uint32_mulhi(y, y));
+        int32_t  error = (int32_t)((1U << 28) - dy2);
+        uint32_t step  = uint32_mulhi(y, (uint32_t)((error < 0) ? -error
+                                                                    : error))
+                        << 3;
+        y = (error < 0) ? y - step : y + step;
+    }
+    return (y);
+}
+
+/* Returns nonzero if q^2 * num > 2^shift, for q^2 * num near 2^shift. */
+static inline int fix16_rsqrt_above(uint32_t q, uint32_t num, int shift)
+{
+    uint32_t lo;
+    uint32_t hi = uint32_mul(q, num, &lo);
+    uint32_t plo;
+    uint32_t phi = hi * q + uint32_mul(lo, q, &plo);
+    uint32_t top = 1U << (shift - 32);
+    return ((phi > top) || ((phi == top) && (plo != 0U)));
+}
+
+/* Returns nonzero if f^2 + add > (nhi, nlo). */
+static inline int fix16_sqrt_above(uint32_t f, uint32_t add, uint32_t nhi,
+                                   uint32_t nlo)
+{
+    uint32_t lo;
+    uint32_t hi = uint32_mul(f, f, &lo);
+    lo += add;
+    hi += (lo < add);
+    return ((hi > nhi) || ((hi == nhi) && (lo > nlo)));
+}
+
+/* Note that for negative numbers we return -sqrt(-inValue).
  * Not sure if someone relies on this behaviour, but not going
  * to break it for now. It doesn't slow the code much overall.
+ *
+ * The result is the root of num * 2^16 rounded to nearest, or truncated
+ * with FIXMATH_NO_ROUNDING, as by the bit-by-bit algorithm from
+ * http://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Binary_numeral_system_.28base_2.29
+ * that this replaces. That algorithm computed the top 24 bits first, and
+ * where their remainder was above 65535 it took 2^14 too much off the
+ * remainder for the low 8 bits, that is the root of num * 2^16 - 2^14. This
+ * is reproduced, so that the results stay the same.
  */
 fix16_t fix16_sqrt(fix16_t inValue)
 {
-    uint8_t  neg    = (inValue < 0) ? (uint8_t)1U : (uint8_t)0U;
-    uint32_t num    = fix_abs(inValue);
-    uint32_t result = 0;
-    uint32_t bit;
-    uint8_t  n;
-
-    // Many numbers will be less than 15, so
-    // this gives a good balance between time spent
-    // in if vs. time spent in the while loop
-    // when searching for the starting value.
-    if ((num & 0xFFF00000U) != 0U)
+    uint32_t num = fix_abs(inValue);
+    if (num == 0U)
+        return (0);
+
+    /* The estimate from num * 1/sqrt(num), within a few units, and then
+     * the floor of the root of n = num * 2^16.
+     */
+    uint8_t  shift = uint32_clz(num) & 0xFEU;
+    uint32_t m     = num << shift;
+    uint32_t f = uint32_mulhi(m, fix16_rsqrt_norm(m)) >> (6U + shift / 2U);
+    uint32_t nhi   = num >> 16;
+    uint32_t nlo   = num << 16;
+    while (fix16_sqrt_above(f, 0U, nhi, nlo))
+        f--;
+    while (!fix16_sqrt_above(f + 1U, 0U, nhi, nlo))
+        f++;
+
+    uint32_t top = f >> 8;
+    if ((num - top * top) > 65535U)
+    {
+        nhi -= (nlo < 0x4000U);
+        nlo -= 0x4000U;
+        if (fix16_sqrt_above(f, 0U, nhi, nlo))
+            f--;
+    }
+
+#ifndef FIXMATH_NO_ROUNDING
+    // Round up if n > f^2 + f, the root is then above f + 1/2.
+    if (!fix16_sqrt_above(f, f + 1U, nhi, nlo))
+        f++;
+#endif
+
+    return ((inValue < 0) ? -(fix16_t)f : (fix16_t)f);
+}
+
+fix16_t fix16_rsqrt(fix16_t inValue)
+{
+    uint32_t num = fix_abs(inValue);
+    if (num == 0U)
+        return (fix16_overflow_raise());
+
+    /* 1/sqrt(num / 2^16) * 2^16 = 2^24 / sqrt(num), from the estimate
+     * of 1/sqrt(m) for m = num * 2^shift.
+     */
+    uint8_t  shift = uint32_clz(num) & 0xFEU;
+    uint32_t r     = fix16_rsqrt_norm(num << shift) >> (22U - shift / 2U);
+
+#ifndef FIXMATH_NO_ROUNDING
+    // r - 1/2 <= 2^24 / sqrt(num) < r + 1/2.
+    while (!fix16_rsqrt_above(2U * r + 1U, num, 50))
+        r++;
+    while (fix16_rsqrt_above(2U * r - 1U, num, 50))
+        r--;
+#else
+    while (!fix16_rsqrt_above(r + 1U, num, 48))
+        r++;
+    while (fix16_rsqrt_above(r, num, 48))
+        r--;
+#endif
+
+    return ((inValue < 0) ? -(fix16_t)r : (fix16_t)r);
+}
+
+/* Scales the magnitude to [2^30, 2^31] by the given shift. */
+static inline uint32_t fix16_normalize_scale(fix16_t x, uint8_t shift)
+{
+    return (fix_abs(x) << shift);
+}
+
+/* Divides the scaled component u by the length sqrt(s) and applies the sign
+ * of x, from the estimate y of 1/sqrt(m) with s = m * 2^(32 - shift).
+ */
+static inline fix16_t fix16_normalize_apply(fix16_t x, uint32_t u,
+                                            uint32_t y, uint8_t shift)
+{
+    uint8_t  down   = 14U - shift / 2U;
+#ifndef FIXMATH_NO_ROUNDING
+    uint32_t result = (uint32_mulhi(u, y) + (1U << (down - 1U))) >> down;
+#else
+    /* y is within 2^-26, at most 16 units of the product, which would take
+     * exact quotients such as 1 below the next LSB.
+     */
+    uint32_t result = (uint32_mulhi(u, y) + 32U) >> down;
+#endif
+    return ((x < 0) ? -(fix16_t)result : (fix16_t)result);
+}
+
+/* Normalizes the vector with the scaled magnitudes u[0..n) and the sum of
+ * their squares s = (hi, lo), and returns its length sqrt(s) / 2^scale,
+ * saturated to fix16_maximum.
+ */
+static fix16_t fix16_normalize(fix16_t** v, const uint32_t* u, int n,
+                               uint32_t hi, uint32_t lo, uint8_t scale)
+{
+    /* The sum is in [2^60, 3 * 2^62), the mantissa takes all of hi and
+     * the top 2 bits of lo if hi is below 2^30.
+     */
+    uint8_t  shift = uint32_clz(hi) & 0xFEU;
+    uint32_t m     = (shift == 0U) ? hi : (hi << 2) | (lo >> 30);
+    uint32_t y     = fix16_rsqrt_norm(m);
+    int      i;
+
+    for (i = 0; i < n; i++)
+        *v[i] = fix16_normalize_apply(*v[i], u[i], y, shift);
+
+    /* The length estimate m * y * 2^(2 - shift / 2) / 2^32 is within about
+     * 64 units of sqrt(s) < 2^32. One Newton step f += (s - f^2) / 2f, with
+     * the remainder to 10 bits and 1/2f from y, brings it within a unit or
+     * two, and then it is corrected to the floor of the root.
+     */
+    uint32_t f = uint32_mulhi(m, y) << (2U - shift / 2U);
+    uint32_t plo;
+    uint32_t phi = uint32_mul(f, f, &plo);
+    uint32_t elo = lo - plo;
+    uint32_t ehi = hi - phi - (lo < plo);
+    int32_t  e   = (int32_t)((ehi << 22) | (elo >> 10));
+    uint32_t d   = uint32_mulhi((e < 0) ? -(uint32_t)e : (uint32_t)e, y)
+                 >> (21U - shift / 2U);
+    f = (e < 0) ? f - d : f + d;
+    while (fix16_sqrt_above(f, 0U, hi, lo))
+        f--;
+    while (!fix16_sqrt_above(f + 1U, 0U, hi, lo))
+        f++;
+
+#ifndef FIXMATH_NO_ROUNDING
+    if (scale == 0U)
     {
-        bit = (uint32_t)1U << 30U;
+        if (!fix16_sqrt_above(f, f + 1U, hi, lo))
+            f++;
     }
     else
     {
-        bit = (uint32_t)1U << 18U;
+        f = (f + (1U << (scale - 1U))) >> scale;
     }
+#else
+    f >>= scale;
+#endif
+    return ((f > (uint32_t)fix16_maximum) ? fix16_maximum : (fix16_t)f);
+}
 
-    while (bit > num)
+/* Adds u^2 to the 64 bit sum (hi, lo). */
+static inline void fix16_normalize_add(uint32_t* hi, uint32_t* lo, uint32_t u)
+{
+    uint32_t plo;
+    *hi += uint32_mul(u, u, &plo);
+    *lo += plo;
+    *hi += (*lo < plo);
+}
+
+fix16_t fix16_normalize2(fix16_t* x, fix16_t* y)
+{
+    uint32_t ax  = fix_abs(*x);
+    uint32_t ay  = fix_abs(*y);
+    uint32_t max = (ax > ay) ? ax : ay;
+    if (max == 0U)
+        return (0);
+
+    uint8_t  scale = (max > 0x7FFFFFFFU) ? 0U : uint32_clz(max) - 1U;
+    uint32_t u[2]  = {fix16_normalize_scale(*x, scale),
+                      fix16_normalize_scale(*y, scale)};
+    uint32_t hi    = 0U;
+    uint32_t lo    = 0U;
+    fix16_normalize_add(&hi, &lo, u[0]);
+    fix16_normalize_add(&hi, &lo, u[1]);
+
+    fix16_t* v[2] = {x, y};
+    return (fix16_normalize(v, u, 2, hi, lo, scale));
+}
+
+fix16_t fix16_normalize3(fix16_t* x, fix16_t* y, fix16_t* z)
+{
+    uint32_t ax  = fix_abs(*x);
+    uint32_t ay  = fix_abs(*y);
+    uint32_t az  = fix_abs(*z);
+    uint32_t max = (ax > ay) ? ax : ay;
+    if (az > max)
+        max = az;
+    if (max == 0U)
+        return (0);
+
+    uint8_t  scale = (max > 0x7FFFFFFFU) ? 0U : uint32_clz(max) - 1U;
+    uint32_t u[3]  = {fix16_normalize_scale(*x, scale),
+                      fix16_normalize_scale(*y, scale),
+                      fix16_normalize_scale(*z, scale)};
+    uint32_t hi    = 0U;
+    uint32_t lo    = 0U;
+    fix16_normalize_add(&hi, &lo, u[0]);
+    fix16_normalize_add(&hi, &lo, u[1]);
+    fix16_normalize_add(&hi, &lo, u[2]);
+
+    fix16_t* v[3] = {x, y, z};
+    return (fix16_normalize(v, u, 3, hi, lo, scale));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// SIMD KERNELS
+////////////////////////////////////////////////////////////////////////////////
+
+/* fix16_sqrt() of 4 or 8 lanes. The single precision estimate sqrt(num) *
+ * 256 is within 2 of the root of n = num * 2^16 < 2^47, so that the
+ * remainder r = n - f^2 fits in 32 bits and is exact modulo 2^32. The
+ * remainder corrects f to the floor of the root one step at a time without
+ * a branch, and then gives the quirk and the rounding of fix16_sqrt().
+ */
+#ifdef FIXMATH_SIMD_X86
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_SSE41 __m128i
+fix16_sqrt_sse41(__m128i x)
+{
+    const __m128i one = _mm_set1_epi32(1);
+    __m128i       num = _mm_abs_epi32(x);
+
+    // The absolute value of the conversion reads 2^31 as unsigned.
+    __m128 root = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_cvtepi32_ps(num));
+    root        = _mm_mul_ps(_mm_sqrt_ps(root), _mm_set1_ps(256.0f));
+    __m128i f   = _mm_cvttps_epi32(root);
+    __m128i r   = _mm_sub_epi32(_mm_slli_epi32(num, 16), _mm_mullo_epi32(f, f));
+
+    // (f - 1)^2 = f^2 - 2f + 1 and (f + 1)^2 = f^2 + 2f + 1.
+    __m128i m = _mm_srai_epi32(r, 31);
+    r = _mm_add_epi32(r, _mm_and_si128(m, _mm_sub_epi32(_mm_add_epi32(f, f),
+                                                        one)));
+    f = _mm_add_epi32(f, m);
+    for (int i = 0; i < 2; i++)
     {
-        bit >>= 2U;
+        m = _mm_cmpgt_epi32(r, _mm_add_epi32(f, f));
+        r = _mm_sub_epi32(r, _mm_and_si128(m, _mm_add_epi32(_mm_add_epi32(f, f),
+                                                            one)));
+        f = _mm_sub_epi32(f, m);
     }
 
-    // The main part is executed twice, in order to avoid
-    // using 64 bit values in computations.
-    for (n = 0; n < 2U; n++)
+    __m128i top = _mm_srli_epi32(f, 8);
+    m = _mm_cmpgt_epi32(_mm_sub_epi32(num, _mm_mullo_epi32(top, top)),
+                        _mm_set1_epi32(65535));
+    r = _mm_sub_epi32(r, _mm_and_si128(m, _mm_set1_epi32(0x4000)));
+    m = _mm_srai_epi32(r, 31);
+    r = _mm_add_epi32(r, _mm_and_si128(m, _mm_sub_epi32(_mm_add_epi32(f, f),
+                                                        one)));
+    f = _mm_add_epi32(f, m);
+
+#ifndef FIXMATH_NO_ROUNDING
+    f = _mm_sub_epi32(f, _mm_cmpgt_epi32(r, f));
+#endif
+    return (_mm_sign_epi32(f, x));
+}
+
+static FIXMATH_ALWAYS_INLINE FIXMATH_TARGET_AVX2 __m256i
+fix16_sqrt_avx2(__m256i x)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    __m256i       num = _mm256_abs_epi32(x);
+
+    __m256 root = _mm256_andnot_ps(_mm256_set1_ps(-0.0f),
+                                   _mm256_cvtepi32_ps(num));
+    root        = _mm256_mul_ps(_mm256_sqrt_ps(root), _mm256_set1_ps(256.0f));
+    __m256i f   = _mm256_cvttps_epi32(root);
+    __m256i r   = _mm256_sub_epi32(_mm256_slli_epi32(num, 16),
+                                   _mm256_mullo_epi32(f, f));
+
+    __m256i m = _mm256_srai_epi32(r, 31);
+    r = _mm256_add_epi32(
+        r, _mm256_and_si256(m, _mm256_sub_epi32(_mm256_add_epi32(f, f), one)));
+    f = _mm256_add_epi32(f, m);
+    for (int i = 0; i < 2; i++)
     {
-        // First we get the top 24 bits of the answer.
-        while (bit != 0U)
-        {
-            if (num >= (result + bit))
-            {
-                num -= result + bit;
-                result = (result >> 1U) + bit; ///
-            }
-            else
-            {
-                result = (result >> 1U);
-            }
-            bit >>= 2U;
-        }
-
-        if (n == 0U)
-        {
-            // Then process it again to get the lowest 8 bits.
-            if (num > 65535U)
-            {
-                // The remainder 'num' is too large to be shifted left
-                // by 16, so we have to add 1 to result manually and
-                // adjust 'num' accordingly.
-                // num = a - (result + 0.5)^2
-                //	 = num + result^2 - (result + 0.5)^2
-                //	 = num - result - 0.5
-                num -= result;
-                num    = (num << 16U) - 0x8000U;
-                result = (result << 16U) + 0x8000U;
-            }
-            else
-            {
-                num <<= 16U;
-                result <<= 16U;
-            }
-
-            bit = (uint32_t)1U << 14U;
-        }
+        m = _mm256_cmpgt_epi32(r, _mm256_add_epi32(f, f));
+        r = _mm256_sub_epi32(
+            r,
+            _mm256_and_si256(m, _mm256_add_epi32(_mm256_add_epi32(f, f), one)));
+        f = _mm256_sub_epi32(f, m);
     }
 
+    __m256i top = _mm256_srli_epi32(f, 8);
+    m = _mm256_cmpgt_epi32(_mm256_sub_epi32(num, _mm256_mullo_epi32(top, top)),
+                           _mm256_set1_epi32(65535));
+    r = _mm256_sub_epi32(r, _mm256_and_si256(m, _mm256_set1_epi32(0x4000)));
+    m = _mm256_srai_epi32(r, 31);
+    r = _mm256_add_epi32(
+        r, _mm256_and_si256(m, _mm256_sub_epi32(_mm256_add_epi32(f, f), one)));
+    f = _mm256_add_epi32(f, m);
+
 #ifndef FIXMATH_NO_ROUNDING
-    // Finally, if next bit would have been 1, round the result upwards.
-    if (num > result)
+    f = _mm256_sub_epi32(f, _mm256_cmpgt_epi32(r, f));
+#endif
+    return (_mm256_sign_epi32(f, x));
+}
+
+FIXMATH_TARGET_SSE41 static void fix16_sqrt_array_sse41(fix16_t*       dst,
+                                                        const fix16_t* src,
+                                                        size_t         n)
+{
+    size_t i = 0;
+    for (; (i + 4U) <= n; i += 4U)
     {
-        result++;
+        __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), fix16_sqrt_sse41(x));
     }
+    for (; i < n; i++)
+        dst[i] = fix16_sqrt(src[i]);
+}
+
+FIXMATH_TARGET_AVX2 static void fix16_sqrt_array_avx2(fix16_t*       dst,
+                                                      const fix16_t* src,
+                                                      size_t         n)
+{
+    size_t i = 0;
+    for (; (i + 8U) <= n; i += 8U)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), fix16_sqrt_avx2(x));
+    }
+    for (; i < n; i++)
+        dst[i] = fix16_sqrt(src[i]);
+}
+#endif /* FIXMATH_SIMD_X86 */
+
+////////////////////////////////////////////////////////////////////////////////
+// DISPATCH
+////////////////////////////////////////////////////////////////////////////////
+
+typedef void (*fix16_sqrt_array_fn_t)(fix16_t* dst, const fix16_t* src,
+                                      size_t n);
+
+static void fix16_sqrt_array_scalar(fix16_t* dst, const fix16_t* src, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_sqrt(src[i]);
+}
+
+/* Indexed by fix16_simd_e. The AVX-512 level runs the 8 lane AVX2 kernel. */
+static const fix16_sqrt_array_fn_t
+    fix16_sqrt_array_kernels[fix16_simd_count] = {
+#ifdef FIXMATH_SIMD_X86
+    fix16_sqrt_array_scalar,
+    fix16_sqrt_array_sse41,
+    fix16_sqrt_array_avx2,
+    fix16_sqrt_array_avx2,
+#else
+    fix16_sqrt_array_scalar,
+    fix16_sqrt_array_scalar,
+    fix16_sqrt_array_scalar,
+    fix16_sqrt_array_scalar,
 #endif
+};
 
-    return (neg ? -(fix16_t)result : (fix16_t)result);
+void fix16_sqrt_array(fix16_t* dst, const fix16_t* src, size_t n)
+{
+    fix16_sqrt_array_kernels[fix16_simd_level()](dst, src, n);
+}
+
+void fix16_rsqrt_array(fix16_t* dst, const fix16_t* src, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix16_rsqrt(src[i]);
+}
+
+void fix16_normalize2_array(fix16_t* x, fix16_t* y, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        fix16_normalize2(&x[i], &y[i]);
+}
+
+void fix16_normalize3_array(fix16_t* x, fix16_t* y, fix16_t* z, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        fix16_normalize3(&x[i], &y[i], &z[i]);
 }
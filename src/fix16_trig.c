@@ -5,18 +5,28 @@
 #else
 #include <limits.h>
 #endif
-#include "fix16.h"
+#include "fix16_array.h"
+#include "fix16_cache.h"
 
-#if defined(FIXMATH_SIN_LUT)
+#if defined(FIXMATH_SIN_LUT_BITS)
+#include "fix16_angle.h"
+#elif defined(FIXMATH_SIN_LUT)
 #include "fix16_trig_sin_lut.h"
 #elif !defined(FIXMATH_NO_CACHE)
-static fix16_t _fix16_sin_cache_index[4096] = {0};
-static fix16_t _fix16_sin_cache_value[4096] = {0};
+FIXMATH_CACHE_STORAGE fix16_t _fix16_sin_cache_index[FIXMATH_CACHE_SIZE] = {0};
+FIXMATH_CACHE_STORAGE fix16_t _fix16_sin_cache_value[FIXMATH_CACHE_SIZE] = {0};
+#ifdef FIXMATH_CACHE_STATS
+FIXMATH_CACHE_STORAGE uint32_t _fix16_sin_cache_used[FIXMATH_CACHE_USED_WORDS];
+#endif
 #endif
 
 #ifndef FIXMATH_NO_CACHE
-static fix16_t _fix16_atan_cache_index[2][4096] = {{0}, {0}};
-static fix16_t _fix16_atan_cache_value[4096]    = {0};
+FIXMATH_CACHE_STORAGE fix16_t _fix16_atan_cache_index[2][FIXMATH_CACHE_SIZE] = {
+    {0}, {0}};
+FIXMATH_CACHE_STORAGE fix16_t _fix16_atan_cache_value[FIXMATH_CACHE_SIZE] = {0};
+#ifdef FIXMATH_CACHE_STATS
+FIXMATH_CACHE_STORAGE uint32_t _fix16_atan_cache_used[FIXMATH_CACHE_USED_WORDS];
+#endif
 #endif
 
 fix16_t fix16_sin_parabola(fix16_t inAngle)
@@ -55,14 +65,29 @@ fix16_t fix16_sin_parabola(fix16_t inAngle)
     return (retval);
 }
 
-fix16_t fix16_sin(fix16_t inAngle)
+#ifndef FIXMATH_SIN_LUT_BITS
+/* Reduces inAngle to [0, 2pi) for the table, or to [-pi, pi] for the series.
+ */
+static inline fix16_t fix16_sin_reduce(fix16_t inAngle)
 {
     fix16_t tempAngle = inAngle % (fix16_pi << 1);
 
 #ifdef FIXMATH_SIN_LUT
     if (tempAngle < 0)
         tempAngle += (fix16_pi << 1);
+#else
+    if (tempAngle > fix16_pi)
+        tempAngle -= (fix16_pi << 1);
+    else if (tempAngle < -fix16_pi)
+        tempAngle += (fix16_pi << 1);
+#endif
+    return (tempAngle);
+}
 
+/* Sine of an angle reduced by fix16_sin_reduce(). */
+static inline fix16_t fix16_sin_reduced(fix16_t tempAngle)
+{
+#ifdef FIXMATH_SIN_LUT
     fix16_t tempOut;
     if (tempAngle >= fix16_pi)
     {
@@ -82,17 +107,6 @@ fix16_t fix16_sin(fix16_t inAngle)
                                                : _fix16_sin_lut[tempAngle]);
     }
 #else
-    if (tempAngle > fix16_pi)
-        tempAngle -= (fix16_pi << 1);
-    else if (tempAngle < -fix16_pi)
-        tempAngle += (fix16_pi << 1);
-
-#ifndef FIXMATH_NO_CACHE
-    fix16_t tempIndex = ((inAngle >> 5) & 0x00000FFF);
-    if (_fix16_sin_cache_index[tempIndex] == inAngle)
-        return (_fix16_sin_cache_value[tempIndex]);
-#endif
-
     fix16_t tempAngleSq = fix16_mul(tempAngle, tempAngle);
 
 #ifndef FIXMATH_FAST_SIN // Most accurate version, accurate to ~2.1%
@@ -114,20 +128,89 @@ fix16_t fix16_sin(fix16_t inAngle)
     tempOut = fix16_mul(tempOut, tempAngleSq) - 10923;
     tempOut = fix16_mul(tempOut, tempAngleSq) + 65536;
     tempOut = fix16_mul(tempOut, tempAngle);
+#endif
 #endif
 
-#ifndef FIXMATH_NO_CACHE
+    return (tempOut);
+}
+#endif
+
+fix16_t fix16_sin(fix16_t inAngle)
+{
+#ifdef FIXMATH_SIN_LUT_BITS
+    return (fix16_angle_sin(fix16_angle_from_rad(inAngle)));
+#else
+#if !defined(FIXMATH_SIN_LUT) && !defined(FIXMATH_NO_CACHE)
+    uint32_t tempIndex = FIXMATH_SIN_CACHE_HASH(inAngle) & FIXMATH_CACHE_MASK;
+    if (_fix16_sin_cache_index[tempIndex] == inAngle)
+    {
+#ifdef FIXMATH_CACHE_STATS
+        fix16_cache_hit(fix16_cache_sin);
+#endif
+        return (_fix16_sin_cache_value[tempIndex]);
+    }
+#endif
+
+    fix16_t tempOut = fix16_sin_reduced(fix16_sin_reduce(inAngle));
+
+#if !defined(FIXMATH_SIN_LUT) && !defined(FIXMATH_NO_CACHE)
+#ifdef FIXMATH_CACHE_STATS
+    fix16_cache_miss(fix16_cache_sin, _fix16_sin_cache_used, tempIndex);
+#endif
     _fix16_sin_cache_index[tempIndex] = inAngle;
     _fix16_sin_cache_value[tempIndex] = tempOut;
-#endif
 #endif
 
     return (tempOut);
+#endif
 }
 
 fix16_t fix16_cos(fix16_t inAngle)
 {
+#ifdef FIXMATH_SIN_LUT_BITS
+    /* A quarter turn is exact here, unlike fix16_pi / 2. */
+    return (fix16_angle_cos(fix16_angle_from_rad(inAngle)));
+#else
     return fix16_sin(inAngle + (fix16_pi >> 1));
+#endif
+}
+
+void fix16_sincos(fix16_t inAngle, fix16_t* outSin, fix16_t* outCos)
+{
+#ifdef FIXMATH_SIN_LUT_BITS
+    fix16_angle_t angle = fix16_angle_from_rad(inAngle);
+    *outSin             = fix16_angle_sin(angle);
+    *outCos             = fix16_angle_cos(angle);
+#else
+    fix16_t sinAngle = fix16_sin_reduce(inAngle);
+
+    /* fix16_cos() takes the sine of inAngle + pi/2, which reduces to the
+     * reduced angle plus pi/2, moved back into range. fix16_sin_reduce()
+     * maps odd multiples of pi to -pi for negative angles and to pi
+     * otherwise, and so does this.
+     */
+    fix16_t cosAngle = sinAngle + (fix16_pi >> 1);
+#ifdef FIXMATH_SIN_LUT
+    if (cosAngle >= (fix16_pi << 1))
+        cosAngle -= (fix16_pi << 1);
+#else
+    if (cosAngle > fix16_pi)
+        cosAngle -= (fix16_pi << 1);
+    else if ((cosAngle == fix16_pi) && (inAngle < -(fix16_pi >> 1)))
+        cosAngle = -fix16_pi;
+#endif
+
+    *outSin = fix16_sin_reduced(sinAngle);
+    *outCos = fix16_sin_reduced(cosAngle);
+#endif
+}
+
+void fix16_sincos_array(fix16_t* s, fix16_t* c, const fix16_t* angle,
+                        size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        fix16_sincos(angle[i], &s[i], &c[i]);
 }
 
 fix16_t fix16_tan(fix16_t inAngle)
@@ -165,12 +248,15 @@ fix16_t fix16_atan2(fix16_t inY, fix16_t inX)
     fix16_t r_3;
 
 #ifndef FIXMATH_NO_CACHE
-    uintptr_t hash = (inX ^ inY);
-    hash ^= hash >> 20;
-    hash &= 0x0FFF;
+    uint32_t hash = FIXMATH_ATAN_CACHE_HASH(inY, inX) & FIXMATH_CACHE_MASK;
     if ((_fix16_atan_cache_index[0][hash] == inX) &&
         (_fix16_atan_cache_index[1][hash] == inY))
+    {
+#ifdef FIXMATH_CACHE_STATS
+        fix16_cache_hit(fix16_cache_atan2);
+#endif
         return (_fix16_atan_cache_value[hash]);
+    }
 #endif
 
     /* Absolute inY */
@@ -197,6 +283,9 @@ fix16_t fix16_atan2(fix16_t inY, fix16_t inX)
     }
 
 #ifndef FIXMATH_NO_CACHE
+#ifdef FIXMATH_CACHE_STATS
+    fix16_cache_miss(fix16_cache_atan2, _fix16_atan_cache_used, hash);
+#endif
     _fix16_atan_cache_index[0][hash] = inX;
     _fix16_atan_cache_index[1][hash] = inY;
     _fix16_atan_cache_value[hash]    = angle;
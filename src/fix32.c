@@ -0,0 +1,521 @@
+#include "fix32.h"
+#include "uint32_inline.h"
+
+/* 128 bit unsigned intermediates for the Q32.32 products, quotients and
+ * square roots. The helpers below hide whether they are a native
+ * unsigned __int128 or four 32 bit limbs, least significant first.
+ */
+#if defined(__SIZEOF_INT128__) && !defined(FIXMATH_NO_64BIT)
+#define FIX32_WIDE_NATIVE
+__extension__ typedef unsigned __int128 fix32_wide_t;
+#else
+typedef struct
+{
+    uint32_t w[4];
+} fix32_wide_t;
+#endif
+
+static inline fix32_wide_t fix32_wide_make(uint32_t w3, uint32_t w2,
+                                           uint32_t w1, uint32_t w0)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return (((fix32_wide_t)(((uint64_t)w3 << 32U) | w2) << 64U) |
+            (((uint64_t)w1 << 32U) | w0));
+#else
+    fix32_wide_t x = {{w0, w1, w2, w3}};
+    return (x);
+#endif
+}
+
+static inline uint32_t fix32_wide_word(fix32_wide_t x, uint8_t i)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return ((uint32_t)(x >> (32U * i)));
+#else
+    return (x.w[i]);
+#endif
+}
+
+static inline int fix32_wide_is_zero(fix32_wide_t x)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return (x == 0U);
+#else
+    return ((x.w[0] | x.w[1] | x.w[2] | x.w[3]) == 0U);
+#endif
+}
+
+static inline int fix32_wide_lt(fix32_wide_t x, fix32_wide_t y)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return (x < y);
+#else
+    int8_t i;
+    for (i = 3; i >= 0; i--)
+    {
+        if (x.w[i] != y.w[i])
+            return (x.w[i] < y.w[i]);
+    }
+    return (0);
+#endif
+}
+
+static inline fix32_wide_t fix32_wide_add(fix32_wide_t x, fix32_wide_t y)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return (x + y);
+#else
+    uint32_t carry = 0U;
+    uint8_t  i;
+    for (i = 0U; i < 4U; i++)
+    {
+        uint32_t sum = x.w[i] + carry;
+        carry        = (sum < carry);
+        x.w[i]       = sum + y.w[i];
+        carry += (x.w[i] < sum);
+    }
+    return (x);
+#endif
+}
+
+static inline fix32_wide_t fix32_wide_sub(fix32_wide_t x, fix32_wide_t y)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return (x - y);
+#else
+    uint32_t borrow = 0U;
+    uint8_t  i;
+    for (i = 0U; i < 4U; i++)
+    {
+        uint32_t diff = x.w[i] - borrow;
+        borrow        = (x.w[i] < borrow);
+        borrow += (diff < y.w[i]);
+        x.w[i] = diff - y.w[i];
+    }
+    return (x);
+#endif
+}
+
+/* Shifts right by s bits, s < 128. */
+static inline fix32_wide_t fix32_wide_shr(fix32_wide_t x, uint8_t s)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return (x >> s);
+#else
+    fix32_wide_t r     = {{0U, 0U, 0U, 0U}};
+    uint8_t      words = s / 32U;
+    uint8_t      bits  = s % 32U;
+    uint8_t      i;
+    for (i = 0U; i + words < 4U; i++)
+    {
+        r.w[i] = x.w[i + words] >> bits;
+        if (bits != 0U && i + words + 1U < 4U)
+            r.w[i] |= x.w[i + words + 1U] << (32U - bits);
+    }
+    return (r);
+#endif
+}
+
+/* Shifts left by s bits, s < 128. */
+static inline fix32_wide_t fix32_wide_shl(fix32_wide_t x, uint8_t s)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return (x << s);
+#else
+    fix32_wide_t r     = {{0U, 0U, 0U, 0U}};
+    uint8_t      words = s / 32U;
+    uint8_t      bits  = s % 32U;
+    uint8_t      i;
+    for (i = words; i < 4U; i++)
+    {
+        r.w[i] = x.w[i - words] << bits;
+        if (bits != 0U && i > words)
+            r.w[i] |= x.w[i - words - 1U] >> (32U - bits);
+    }
+    return (r);
+#endif
+}
+
+/* Product of two 64 bit magnitudes given as high and low words. */
+static inline fix32_wide_t fix32_wide_mul(uint32_t ahi, uint32_t alo,
+                                          uint32_t bhi, uint32_t blo)
+{
+#ifdef FIX32_WIDE_NATIVE
+    return ((fix32_wide_t)(((uint64_t)ahi << 32U) | alo) *
+            (((uint64_t)bhi << 32U) | blo));
+#else
+    uint32_t ll_lo, lh_lo, hl_lo, hh_lo;
+    uint32_t ll_hi = uint32_mul(alo, blo, &ll_lo);
+    uint32_t lh_hi = uint32_mul(alo, bhi, &lh_lo);
+    uint32_t hl_hi = uint32_mul(ahi, blo, &hl_lo);
+    uint32_t hh_hi = uint32_mul(ahi, bhi, &hh_lo);
+
+    fix32_wide_t r = fix32_wide_make(hh_hi, hh_lo, ll_hi, ll_lo);
+    r              = fix32_wide_add(r, fix32_wide_make(0U, lh_hi, lh_lo, 0U));
+    return (fix32_wide_add(r, fix32_wide_make(0U, hl_hi, hl_lo, 0U)));
+#endif
+}
+
+/* Quotient and remainder of n by a 64 bit divisor d. */
+static inline fix32_wide_t fix32_wide_div(fix32_wide_t n, fix32_wide_t d,
+                                          fix32_wide_t* rem)
+{
+#ifdef FIX32_WIDE_NATIVE
+    *rem = n % d;
+    return (n / d);
+#else
+    fix32_wide_t q = {{0U, 0U, 0U, 0U}};
+    fix32_wide_t r = {{0U, 0U, 0U, 0U}};
+    int8_t       i;
+    for (i = 127; i >= 0; i--)
+    {
+        r = fix32_wide_shl(r, 1U);
+        r.w[0] |= (n.w[i / 32] >> (i % 32)) & 1U;
+        if (!fix32_wide_lt(r, d))
+        {
+            r = fix32_wide_sub(r, d);
+            q.w[i / 32] |= 1U << (i % 32);
+        }
+    }
+    *rem = r;
+    return (q);
+#endif
+}
+
+static inline fix32_t fix32_overflowed(void)
+{
+    (void)fix16_overflow_raise();
+    return (fix32_overflow);
+}
+
+/* Splits x into its magnitude and returns whether it is negative. The
+ * magnitude of fix32_minimum is 2^63, which still fits the two words.
+ */
+static inline int fix32_magnitude(fix32_t x, uint32_t* hi, uint32_t* lo)
+{
+    int neg = (int64_hi(x) < 0);
+    *hi     = (uint32_t)int64_hi(x);
+    *lo     = int64_lo(x);
+    if (neg)
+    {
+        *lo = 0U - *lo;
+        *hi = ~*hi + (*lo == 0U);
+    }
+    return (neg);
+}
+
+/* Applies the sign to a magnitude, returning fix32_overflow if it does not
+ * fit unless FIXMATH_NO_OVERFLOW is defined.
+ */
+static inline fix32_t fix32_pack(fix32_wide_t m, int neg)
+{
+    uint32_t hi = fix32_wide_word(m, 1U);
+    uint32_t lo = fix32_wide_word(m, 0U);
+#ifndef FIXMATH_NO_OVERFLOW
+    // Only a negative result may have a magnitude of exactly 2^63.
+    if ((fix32_wide_word(m, 3U) | fix32_wide_word(m, 2U)) != 0U ||
+        hi > 0x80000000U || (hi == 0x80000000U && (!neg || lo != 0U)))
+        return (fix32_overflowed());
+#endif
+    if (neg)
+    {
+        lo = 0U - lo;
+        hi = ~hi + (lo == 0U);
+    }
+    return (int64_const((int32_t)hi, lo));
+}
+
+fix32_t fix32_add(fix32_t a, fix32_t b)
+{
+    // Add the words as unsigned integers, see fix16_add().
+    uint32_t ahi = (uint32_t)int64_hi(a);
+    uint32_t bhi = (uint32_t)int64_hi(b);
+    uint32_t lo  = int64_lo(a) + int64_lo(b);
+    uint32_t hi  = ahi + bhi + (lo < int64_lo(a));
+#ifndef FIXMATH_NO_OVERFLOW
+    if (!((ahi ^ bhi) & 0x80000000U) && ((ahi ^ hi) & 0x80000000U))
+        return (fix32_overflowed());
+#endif
+    return (int64_const((int32_t)hi, lo));
+}
+
+fix32_t fix32_sub(fix32_t a, fix32_t b)
+{
+    uint32_t ahi = (uint32_t)int64_hi(a);
+    uint32_t bhi = (uint32_t)int64_hi(b);
+    uint32_t lo  = int64_lo(a) - int64_lo(b);
+    uint32_t hi  = ahi - bhi - (int64_lo(a) < int64_lo(b));
+#ifndef FIXMATH_NO_OVERFLOW
+    if (((ahi ^ bhi) & 0x80000000U) && ((ahi ^ hi) & 0x80000000U))
+        return (fix32_overflowed());
+#endif
+    return (int64_const((int32_t)hi, lo));
+}
+
+fix32_t fix32_mul(fix32_t a, fix32_t b)
+{
+    uint32_t     ahi, alo, bhi, blo;
+    int          neg = fix32_magnitude(a, &ahi, &alo);
+    neg ^= fix32_magnitude(b, &bhi, &blo);
+
+    fix32_wide_t product = fix32_wide_mul(ahi, alo, bhi, blo);
+#ifndef FIXMATH_NO_ROUNDING
+    product = fix32_wide_add(product, fix32_wide_make(0U, 0U, 0U, 0x80000000U));
+#endif
+    return (fix32_pack(fix32_wide_shr(product, 32U), neg));
+}
+
+fix32_t fix32_div(fix32_t a, fix32_t b)
+{
+    uint32_t ahi, alo, bhi, blo;
+    int      neg = fix32_magnitude(a, &ahi, &alo);
+    neg ^= fix32_magnitude(b, &bhi, &blo);
+
+    if ((bhi | blo) == 0U)
+    {
+        (void)fix16_overflow_raise();
+        return (fix32_minimum);
+    }
+
+    fix32_wide_t d = fix32_wide_make(0U, 0U, bhi, blo);
+    fix32_wide_t rem;
+    fix32_wide_t quotient =
+        fix32_wide_div(fix32_wide_make(0U, ahi, alo, 0U), d, &rem);
+#ifndef FIXMATH_NO_ROUNDING
+    // Round half away from zero: rem >= d / 2.
+    if (!fix32_wide_lt(rem, fix32_wide_sub(d, rem)))
+        quotient = fix32_wide_add(quotient, fix32_wide_make(0U, 0U, 0U, 1U));
+#endif
+    return (fix32_pack(quotient, neg));
+}
+
+fix32_t fix32_sqrt(fix32_t x)
+{
+    uint32_t hi, lo;
+    int      neg = fix32_magnitude(x, &hi, &lo);
+
+    // Digit by digit square root of the magnitude shifted up by 32 bits,
+    // which is below 2^95, so the first candidate bit is 2^94.
+    fix32_wide_t num    = fix32_wide_make(0U, hi, lo, 0U);
+    fix32_wide_t result = fix32_wide_make(0U, 0U, 0U, 0U);
+    fix32_wide_t bit    = fix32_wide_make(0U, 0x40000000U, 0U, 0U);
+
+    while (fix32_wide_lt(num, bit))
+        bit = fix32_wide_shr(bit, 2U);
+
+    while (!fix32_wide_is_zero(bit))
+    {
+        fix32_wide_t trial = fix32_wide_add(result, bit);
+        result             = fix32_wide_shr(result, 1U);
+        if (!fix32_wide_lt(num, trial))
+        {
+            num    = fix32_wide_sub(num, trial);
+            result = fix32_wide_add(result, bit);
+        }
+        bit = fix32_wide_shr(bit, 2U);
+    }
+
+#ifndef FIXMATH_NO_ROUNDING
+    // The root is above result + 0.5 exactly when the remainder exceeds
+    // result, and it is never exactly halfway.
+    if (fix32_wide_lt(result, num))
+        result = fix32_wide_add(result, fix32_wide_make(0U, 0U, 0U, 1U));
+#endif
+    return (fix32_pack(result, neg));
+}
+
+/* Multiplies a fix32_t by an integer, for products known to be in range. */
+static inline fix32_t fix32_mul_int(fix32_t a, int32_t k)
+{
+    return (int64_mul_i64_i32(a, k));
+}
+
+/* Rounds to the nearest integer whatever FIXMATH_NO_ROUNDING says, for the
+ * argument reductions below.
+ */
+static inline int32_t fix32_nearest_int(fix32_t x)
+{
+    return (int64_hi(int64_add(x, int64_const(0, 0x80000000U))));
+}
+
+/* Reduces x to [-pi, pi] by subtracting the nearest multiple of 2 pi. The
+ * multiple is taken from a 64 bit approximation of 2 pi plus a correction
+ * for its remaining 32 bits.
+ */
+static fix32_t fix32_reduce_2pi(fix32_t x)
+{
+    static const fix32_t two_pi     = FIX32_C(6, 0x487ED511U);
+    static const fix32_t inv_two_pi = FIX32_C(0, 0x28BE60DCU);
+
+    int32_t k = fix32_nearest_int(fix32_mul(x, inv_two_pi));
+    if (k == 0)
+        return (x);
+
+    fix32_t r = int64_sub(x, fix32_mul_int(two_pi, k));
+    return (int64_sub(r, int64_from_int32(
+                             int64_hi(int64_mul_i32_i32(k, 189141414)))));
+}
+
+/* Taylor series of the sine for |x| <= pi / 2, to the x^21 term. */
+static fix32_t fix32_sin_kernel(fix32_t x)
+{
+    fix32_t x2   = fix32_mul(x, x);
+    fix32_t term = fix32_one;
+    int32_t k;
+    for (k = 10; k > 0; k--)
+    {
+        fix32_t t = int64_div_i64_i32(fix32_mul(x2, term), 2 * k * (2 * k + 1));
+        term      = int64_sub(fix32_one, t);
+    }
+    return (fix32_mul(x, term));
+}
+
+fix32_t fix32_sin(fix32_t x)
+{
+    static const fix32_t half_pi = FIX32_C(1, 0x921FB544U);
+
+    x = fix32_reduce_2pi(x);
+    if (int64_cmp_gt(x, half_pi))
+        x = int64_sub(fix32_pi, x);
+    else if (int64_cmp_lt(x, int64_neg(half_pi)))
+        x = int64_sub(int64_neg(fix32_pi), x);
+    return (fix32_sin_kernel(x));
+}
+
+fix32_t fix32_cos(fix32_t x)
+{
+    static const fix32_t half_pi = FIX32_C(1, 0x921FB544U);
+
+    x = fix32_reduce_2pi(x);
+    if (int64_hi(x) < 0)
+        x = int64_neg(x);
+    return (fix32_sin_kernel(int64_sub(half_pi, x)));
+}
+
+fix32_t fix32_exp(fix32_t x)
+{
+    static const fix32_t exp_max = FIX32_C(21, 0x7CD0E702U); /* ln(2^31) */
+    static const fix32_t exp_min = FIX32_C(-23, 0x204AE90EU); /* ln(2^-33) */
+    static const fix32_t ln2     = FIX32_C(0, 0xB17217F8U);
+    static const fix32_t inv_ln2 = FIX32_C(1, 0x71547653U);
+
+    if (int64_cmp_ge(x, exp_max))
+        return (fix32_maximum);
+    if (int64_cmp_lt(x, exp_min))
+        return (int64_const(0, 0U));
+
+    // e^x = 2^k e^r with |r| <= ln(2) / 2. The correction term accounts for
+    // ln2 being rounded up by 774932052 / 2^64.
+    int32_t k = fix32_nearest_int(fix32_mul(x, inv_ln2));
+    fix32_t r = int64_sub(x, fix32_mul_int(ln2, k));
+    r         = int64_add(r, int64_from_int32(
+                         int64_hi(int64_mul_i32_i32(k, 774932052))));
+
+    fix32_t result = fix32_one;
+    int32_t n;
+    for (n = 11; n > 0; n--)
+        result = int64_add(fix32_one,
+                           int64_div_i64_i32(fix32_mul(r, result), n));
+
+    if (k >= 0)
+    {
+        if ((uint32_t)int64_hi(result) >= (0x80000000U >> k))
+            return (fix32_maximum);
+        return (int64_shift(result, (int8_t)k));
+    }
+#ifndef FIXMATH_NO_ROUNDING
+    result = int64_add(result, int64_shift(fix32_eps, (int8_t)(-k - 1)));
+#endif
+    return (int64_shift(result, (int8_t)k));
+}
+
+fix32_t fix32_log(fix32_t x)
+{
+    static const fix32_t ln2   = FIX32_C(0, 0xB17217F8U);
+    static const fix32_t sqrt2 = FIX32_C(1, 0x6A09E668U);
+
+    if (int64_cmp_le(x, int64_const(0, 0U)))
+        return (fix32_minimum);
+
+    // x = 2^e m with m in [sqrt(2) / 2, sqrt(2)].
+    int8_t   e    = -32;
+    uint32_t word = int64_lo(x);
+    if (int64_hi(x) != 0)
+    {
+        e    = 0;
+        word = (uint32_t)int64_hi(x);
+    }
+    while (word > 1U)
+    {
+        word >>= 1U;
+        e++;
+    }
+    fix32_t m = int64_shift(x, (int8_t)-e);
+    if (int64_cmp_gt(m, sqrt2))
+    {
+        m = int64_shift(x, (int8_t)(-e - 1));
+        e++;
+    }
+
+    // ln(m) = 2 atanh(s) with s = (m - 1) / (m + 1), |s| < 0.172, summed to
+    // the s^15 term.
+    fix32_t s  = fix32_div(int64_sub(m, fix32_one), int64_add(m, fix32_one));
+    fix32_t s2 = fix32_mul(s, s);
+    fix32_t t  = int64_div_i64_i32(fix32_one, 15);
+    int32_t n;
+    for (n = 13; n > 0; n -= 2)
+        t = int64_add(int64_div_i64_i32(fix32_one, n), fix32_mul(s2, t));
+    t = int64_shift(fix32_mul(s, t), 1);
+
+    fix32_t result = int64_add(t, fix32_mul_int(ln2, e));
+    return (int64_add(result, int64_from_int32(
+                                  int64_hi(int64_mul_i32_i32(e, -774932052)))));
+}
+
+void fix32_add_array(fix32_t* dst, const fix32_t* a, const fix32_t* b,
+                     size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix32_add(a[i], b[i]);
+}
+
+void fix32_sub_array(fix32_t* dst, const fix32_t* a, const fix32_t* b,
+                     size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix32_sub(a[i], b[i]);
+}
+
+void fix32_mul_array(fix32_t* dst, const fix32_t* a, const fix32_t* b,
+                     size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix32_mul(a[i], b[i]);
+}
+
+void fix32_div_array(fix32_t* dst, const fix32_t* a, const fix32_t* b,
+                     size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix32_div(a[i], b[i]);
+}
+
+void fix32_from_fix16_array(fix32_t* dst, const fix16_t* a, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix32_from_fix16(a[i]);
+}
+
+void fix32_to_fix16_array(fix16_t* dst, const fix32_t* a, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++)
+        dst[i] = fix32_to_fix16(a[i]);
+}
+
+/*** end of file ***/
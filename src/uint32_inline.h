@@ -0,0 +1,62 @@
+#ifndef libfixmath_uint32_inline_h__
+#define libfixmath_uint32_inline_h__
+
+/* Internal helpers on 32 bit words shared by the square root, exponential,
+ * CORDIC, divisor and fix32 code.
+ */
+
+#include "fix16.h"
+
+/* Count leading zeros of a non-zero value. */
+static inline uint8_t uint32_clz(uint32_t x)
+{
+#ifdef __GNUC__
+    return ((uint8_t)__builtin_clz(x));
+#else
+    uint8_t result = 0U;
+    while ((x & 0xF0000000U) == 0U)
+    {
+        result += 4U;
+        x <<= 4U;
+    }
+    while ((x & 0x80000000U) == 0U)
+    {
+        result += 1U;
+        x <<= 1U;
+    }
+    return (result);
+#endif
+}
+
+/* Full 32*32->64 bit unsigned product, returned as high and low word. */
+static inline uint32_t uint32_mul(uint32_t x, uint32_t y, uint32_t* lo)
+{
+#ifndef FIXMATH_NO_64BIT
+    uint64_t product = (uint64_t)x * y;
+    *lo              = (uint32_t)product;
+    return ((uint32_t)(product >> 32U));
+#else
+    uint32_t xl  = x & 0xFFFFU;
+    uint32_t xh  = x >> 16U;
+    uint32_t yl  = y & 0xFFFFU;
+    uint32_t yh  = y >> 16U;
+
+    uint32_t ll  = xl * yl;
+    uint32_t lh  = xl * yh;
+    uint32_t hl  = xh * yl;
+    uint32_t hh  = xh * yh;
+
+    uint32_t mid = (ll >> 16U) + (lh & 0xFFFFU) + (hl & 0xFFFFU);
+    *lo          = (mid << 16U) | (ll & 0xFFFFU);
+    return (hh + (lh >> 16U) + (hl >> 16U) + (mid >> 16U));
+#endif
+}
+
+/* High word of the 32*32->64 bit unsigned product. */
+static inline uint32_t uint32_mulhi(uint32_t x, uint32_t y)
+{
+    uint32_t lo;
+    return (uint32_mul(x, y, &lo));
+}
+
+#endif
@@ -1,9 +1,23 @@
 #include "tests.h"
+#include "tests_acc.h"
+#include "tests_angle.h"
+#include "tests_array.h"
 #include "tests_basic.h"
+#include "tests_cache.h"
+#include "tests_cordic.h"
+#include "tests_divisor.h"
+#include "tests_dot.h"
+#include "tests_exp.h"
+#include "tests_expr.h"
+#include "tests_fix32.h"
+#include "tests_fixed.h"
 #include "tests_lerp.h"
 #include "tests_macros.h"
+#include "tests_pack.h"
 #include "tests_sqrt.h"
+#include "tests_sticky.h"
 #include "tests_str.h"
+#include "tests_trig.h"
 #include <stdio.h>
 
 const fix16_t testcases[] = {
@@ -74,10 +88,25 @@ int      main()
     TEST(test_mul());
     TEST(test_div());
     TEST(test_sub());
+    TEST(test_saturate());
     TEST(test_sqrt());
     TEST(test_lerp());
     TEST(test_macros());
     TEST(test_str());
+    TEST(test_array());
+    TEST(test_divisor());
+    TEST(test_dot());
+    TEST(test_acc());
+    TEST(test_sticky());
+    TEST(test_fix32());
+    TEST(test_fixed());
+    TEST(test_expr());
+    TEST(test_pack());
+    TEST(test_trig());
+    TEST(test_cache());
+    TEST(test_cordic());
+    TEST(test_angle());
+    TEST(test_exp());
 #endif
     return 0;
 }
@@ -1,4 +1,4 @@
-file(GLOB tests-srcs tests/*.c tests/*.h)
+file(GLOB tests-srcs tests/*.c tests/*.cpp tests/*.h)
 
 enable_testing()
 
@@ -30,6 +30,9 @@ function(create_variant name)
 endfunction()
 
 create_variant(ro64)
+# Without TEST fix16.h picks up fix16_options.h, which turns off the hardware
+# division and 64-bit arithmetic, so this is the only variant covering them.
+create_variant(ro64hard TEST)
 create_variant(no64 FIXMATH_NO_ROUNDING)
 create_variant(rn64 FIXMATH_NO_OVERFLOW)
 create_variant(nn64 FIXMATH_NO_ROUNDING FIXMATH_NO_OVERFLOW)
@@ -54,3 +57,48 @@ create_variant(ro08div FIXMATH_NO_HARD_DIV FIXMATH_OPTIMIZE_8BIT)
 create_variant(no08div FIXMATH_NO_HARD_DIV FIXMATH_NO_ROUNDING FIXMATH_OPTIMIZE_8BIT)
 create_variant(rn08div FIXMATH_NO_HARD_DIV FIXMATH_NO_OVERFLOW FIXMATH_OPTIMIZE_8BIT)
 create_variant(nn08div FIXMATH_NO_HARD_DIV FIXMATH_NO_OVERFLOW FIXMATH_NO_ROUNDING FIXMATH_OPTIMIZE_8BIT)
+
+create_variant(ro64fast FIXMATH_FAST_DIV FIXMATH_NO_HARD_DIVISION)
+create_variant(nn32fast FIXMATH_FAST_DIV FIXMATH_NO_HARD_DIVISION FIXMATH_NO_OVERFLOW FIXMATH_NO_ROUNDING FIXMATH_NO_64BIT)
+
+create_variant(ro64inline FIXMATH_INLINE)
+create_variant(ro32inline FIXMATH_INLINE FIXMATH_NO_HARD_DIVISION FIXMATH_NO_64BIT)
+create_variant(nn08inline FIXMATH_INLINE FIXMATH_NO_OVERFLOW FIXMATH_NO_ROUNDING FIXMATH_OPTIMIZE_8BIT)
+create_variant(rn64fastinline FIXMATH_INLINE FIXMATH_FAST_DIV FIXMATH_NO_HARD_DIVISION FIXMATH_NO_OVERFLOW)
+
+create_variant(ro64sticky FIXMATH_STICKY_OVERFLOW)
+create_variant(ro32sticky FIXMATH_STICKY_OVERFLOW FIXMATH_NO_HARD_DIVISION FIXMATH_NO_64BIT)
+create_variant(ro08sticky FIXMATH_STICKY_OVERFLOW FIXMATH_OPTIMIZE_8BIT)
+create_variant(no64faststicky FIXMATH_STICKY_OVERFLOW FIXMATH_FAST_DIV FIXMATH_NO_HARD_DIVISION FIXMATH_NO_ROUNDING)
+create_variant(ro64stickyinline FIXMATH_STICKY_OVERFLOW FIXMATH_INLINE)
+
+# Fix16x4 and Fix16x8 take the instruction set from the compiler flags, so
+# these build the tests for SSE4.1 and AVX2 where the compiler and the build
+# machine support them.
+include(CheckCXXSourceRuns)
+set(CMAKE_REQUIRED_FLAGS -msse4.1)
+check_cxx_source_runs("int main() { return !__builtin_cpu_supports(\"sse4.1\"); }"
+    FIXMATH_HAVE_SSE41)
+set(CMAKE_REQUIRED_FLAGS -mavx2)
+check_cxx_source_runs("int main() { return !__builtin_cpu_supports(\"avx2\"); }"
+    FIXMATH_HAVE_AVX2)
+unset(CMAKE_REQUIRED_FLAGS)
+if(FIXMATH_HAVE_SSE41)
+    create_variant(ro64sse41)
+    target_compile_options(tests_ro64sse41 PRIVATE -msse4.1)
+endif()
+if(FIXMATH_HAVE_AVX2)
+    create_variant(ro64avx2)
+    target_compile_options(tests_ro64avx2 PRIVATE -mavx2)
+endif()
+
+create_variant(ro64sinlut FIXMATH_SIN_LUT)
+create_variant(ro64sinlut10 FIXMATH_SIN_LUT_BITS=10)
+create_variant(no32sinlut8 FIXMATH_SIN_LUT_BITS=8 FIXMATH_NO_ROUNDING FIXMATH_NO_64BIT)
+create_variant(no64fastsin FIXMATH_FAST_SIN FIXMATH_NO_CACHE FIXMATH_NO_ROUNDING)
+
+create_variant(ro64threadcache FIXMATH_THREAD_CACHE)
+create_variant(ro64stickythreadcache FIXMATH_STICKY_OVERFLOW FIXMATH_THREAD_CACHE)
+
+create_variant(ro64cachestats FIXMATH_CACHE_STATS)
+create_variant(no32cachestats8 FIXMATH_CACHE_STATS FIXMATH_CACHE_BITS=8 FIXMATH_THREAD_CACHE FIXMATH_NO_ROUNDING FIXMATH_NO_64BIT)
@@ -14,6 +14,8 @@ extern unsigned stack_depth;
 #define COMMENT(x)  printf("\n----" x "----\n");
 #define STR(x)      #x
 #define STR2(x)     STR(x)
+// The ro64hard variant passes -DTEST so that fix16.h skips fix16_options.h.
+#undef TEST
 #define TEST(x)                                                                \
     do                                                                         \
     {                                                                          \
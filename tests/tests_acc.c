@@ -0,0 +1,127 @@
+#include "tests_acc.h"
+#include "tests.h"
+#include <libfixmath/fix16_array.h>
+
+#define ACC_MAX_LEN 45
+
+int test_acc_basic()
+{
+    fix16_acc_t acc = fix16_acc_zero();
+    for (unsigned i = 0; i < 100000; ++i)
+        acc = fix16_acc_add(acc, fix16_maximum);
+    ASSERT_NEAR_DOUBLE(fix16_acc_to_dbl(acc),
+                       100000.0 * fix16_to_dbl(fix16_maximum), 1e-6, "\n");
+#ifndef FIXMATH_NO_OVERFLOW
+    ASSERT_EQ_INT(fix16_acc_to_fix16(acc), fix16_maximum);
+#endif
+
+    // Going back into range gives the exact value.
+    for (unsigned i = 0; i < 100000; ++i)
+        acc = fix16_acc_sub(acc, fix16_maximum);
+    acc = fix16_acc_merge(acc, fix16_acc_from_fix16(-fix16_one));
+    ASSERT_EQ_INT(fix16_acc_to_fix16(acc), -fix16_one);
+
+#ifndef FIXMATH_NO_OVERFLOW
+    acc = fix16_acc_zero();
+    for (unsigned i = 0; i < 3; ++i)
+        acc = fix16_acc_add(acc, fix16_minimum);
+    ASSERT_EQ_INT(fix16_acc_to_fix16(acc), fix16_minimum);
+#endif
+    return 0;
+}
+
+int test_acc_mac()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            fix16_t     a   = testcases[i];
+            fix16_t     b   = testcases[j];
+            fix16_acc_t acc = fix16_acc_mac(fix16_acc_zero(), a, b);
+            ASSERT_EQ_INT(fix16_acc_to_fix16(acc), fix16_fma(a, b, 0));
+
+            // The product is never saturated.
+            double ref = fix16_to_dbl(a) * fix16_to_dbl(b);
+            ASSERT_NEAR_DOUBLE(ref, fix16_acc_to_dbl(acc), 1.0 / 65536.0,
+                               "%i * %i\n", a, b);
+        }
+    }
+    return 0;
+}
+
+static void acc_fill(fix16_t* buf, size_t n, uint32_t* seed)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        *seed  = (*seed * 1103515245U) + 12345U;
+        buf[i] = (fix16_t)(*seed ^ (*seed << 7)) >> (*seed % 8U);
+        // Repeat some values so that ties between indices occur.
+        if ((*seed & 0x300U) == 0U && (i > 0))
+            buf[i] = buf[i - 1];
+    }
+}
+
+int test_acc_reduce()
+{
+    fix16_t  buf[ACC_MAX_LEN + 3];
+    uint32_t seed = 97531U;
+
+    for (unsigned round = 0; round < 100; ++round)
+    {
+        acc_fill(buf, ACC_MAX_LEN + 3, &seed);
+        for (size_t offset = 0; offset < 3; ++offset)
+        {
+            const fix16_t* a = buf + offset;
+            for (size_t n = 0; n <= ACC_MAX_LEN; ++n)
+            {
+                double      sum   = 0.0;
+                fix16_acc_t sumsq = fix16_acc_zero();
+                size_t      imin = 0, imax = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    sum += (double)a[i];
+                    sumsq = fix16_acc_mac(sumsq, a[i], a[i]);
+                    if (a[i] < a[imin])
+                        imin = i;
+                    if (a[i] > a[imax])
+                        imax = i;
+                }
+
+                ASSERT_NEAR_DOUBLE(sum / 65536.0,
+                                   fix16_acc_to_dbl(fix16_sum_array(a, n)),
+                                   1e-9, "n = %u\n", (unsigned)n);
+                ASSERT_NEAR_DOUBLE(fix16_acc_to_dbl(sumsq),
+                                   fix16_acc_to_dbl(fix16_sumsq_array(a, n)),
+                                   1e-9, "n = %u\n", (unsigned)n);
+                ASSERT_EQ_INT((int)fix16_argmin_array(a, n), (int)imin);
+                ASSERT_EQ_INT((int)fix16_argmax_array(a, n), (int)imax);
+                ASSERT_EQ_INT(fix16_min_array(a, n),
+                              (n > 0) ? a[imin] : fix16_maximum);
+                ASSERT_EQ_INT(fix16_max_array(a, n),
+                              (n > 0) ? a[imax] : fix16_minimum);
+            }
+        }
+    }
+    return 0;
+}
+
+int test_acc_level(fix16_simd_e level)
+{
+    printf("%*s simd: %s\n", stack_depth, "", fix16_simd_name(level));
+    fix16_simd_force(level);
+    TEST(test_acc_reduce());
+    return 0;
+}
+
+int test_acc()
+{
+    TEST(test_acc_basic());
+    TEST(test_acc_mac());
+
+    fix16_simd_e initial = fix16_simd_level();
+    for (unsigned l = 0; l <= (unsigned)fix16_simd_supported(); ++l)
+        TEST(test_acc_level((fix16_simd_e)l));
+    fix16_simd_force(initial);
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef TESTS_ACC_H
+#define TESTS_ACC_H
+
+int test_acc();
+
+#endif // TESTS_ACC_H
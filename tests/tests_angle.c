@@ -0,0 +1,124 @@
+#include "tests_angle.h"
+#include "tests.h"
+#include <libfixmath/fix16_angle.h>
+
+/* The exact binary angle of a number of radians or degrees per turn. */
+static long long angle_ref(double x, double turn)
+{
+    double a = fmod(x / turn, 1.0);
+    return (long long)floor((a < 0.0 ? a + 1.0 : a) * 4294967296.0 + 0.5);
+}
+
+/* Difference of two binary angles, the shorter way around. */
+static long long angle_delta(long long a, long long b)
+{
+    long long d = (a - b) & 0xFFFFFFFFLL;
+    return (d >= 0x80000000LL) ? 0x100000000LL - d : d;
+}
+
+static int test_angle_convert()
+{
+    for (long long x = fix16_minimum; x <= fix16_maximum; x += 4999)
+    {
+        double rad = fix16_to_dbl((fix16_t)x);
+        if ((angle_delta(fix16_angle_from_rad((fix16_t)x),
+                         angle_ref(rad, 2.0 * M_PI)) > 1) ||
+            (angle_delta(fix16_angle_from_deg((fix16_t)x),
+                         angle_ref(rad, 360.0)) > 1))
+        {
+            printf("from_rad/deg(%lli)\n", x);
+            return 1;
+        }
+
+        fix16_angle_t a   = (fix16_angle_t)(x * 2);
+        double        ref = (double)(int32_t)a / 4294967296.0;
+        if ((delta(fix16_angle_to_rad(a), fix16_from_dbl(ref * 2 * M_PI)) >
+             1) ||
+            (delta(fix16_angle_to_deg(a), fix16_from_dbl(ref * 360.0)) > 1))
+        {
+            printf("to_rad/deg(%u)\n", a);
+            return 1;
+        }
+    }
+
+    ASSERT_EQ_INT(fix16_angle_from_deg(fix16_from_int(90)),
+                  fix16_angle_quarter);
+    ASSERT_EQ_INT(fix16_angle_from_deg(fix16_from_int(-180)),
+                  fix16_angle_half);
+    ASSERT_EQ_INT(fix16_angle_to_deg(fix16_angle_quarter), fix16_from_int(90));
+    ASSERT_EQ_INT(fix16_angle_to_rad(fix16_angle_half), -fix16_pi);
+    return 0;
+}
+
+static int test_angle_sincos()
+{
+    for (long long a = 0; a <= 0xFFFFFFFFLL; a += 65521)
+    {
+        double  rad = (double)a / 4294967296.0 * 2.0 * M_PI;
+        fix16_t s   = fix16_angle_sin((fix16_angle_t)a);
+        fix16_t c   = fix16_angle_cos((fix16_angle_t)a);
+        if ((delta(s, fix16_from_dbl(sin(rad))) > 1) ||
+            (delta(c, fix16_from_dbl(cos(rad))) > 1))
+        {
+            printf("sin/cos(%lli) = %i/%i\n", a, s, c);
+            return 1;
+        }
+    }
+
+    ASSERT_EQ_INT(fix16_angle_sin(0), 0);
+    ASSERT_EQ_INT(fix16_angle_sin(fix16_angle_quarter), fix16_one);
+    ASSERT_EQ_INT(fix16_angle_sin(fix16_angle_half), 0);
+    ASSERT_EQ_INT(fix16_angle_cos(fix16_angle_half), -fix16_one);
+    ASSERT_EQ_INT(fix16_angle_sin(-fix16_angle_quarter), -fix16_one);
+    return 0;
+}
+
+/* A phase accumulator wraps around without drift: 2^32 / 3 steps of three
+ * times the step size are a whole number of turns.
+ */
+static int test_angle_phase()
+{
+    fix16_angle_t phase = 0;
+    fix16_angle_t step  = 3U * 1000003U;
+    for (unsigned i = 0; i < 3U * 0x1000U; ++i)
+        phase += step;
+    ASSERT_EQ_INT(phase, (fix16_angle_t)(3U * 1000003U * 3U * 0x1000U));
+    ASSERT_EQ_INT(fix16_angle_sin(phase + fix16_angle_half),
+                  -fix16_angle_sin(phase));
+    return 0;
+}
+
+static int test_angle_atan2()
+{
+    uint32_t seed = 7U;
+    for (int i = 0; i < 100000; ++i)
+    {
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t y = (fix16_t)seed >> (seed % 31U);
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t x = (fix16_t)seed >> (seed % 31U);
+        if ((x == 0) && (y == 0))
+            continue;
+
+        fix16_angle_t a = fix16_angle_atan2(y, x);
+        if (angle_delta(a, angle_ref(atan2(y, x), 2.0 * M_PI)) > 256)
+        {
+            printf("atan2(%i, %i) = %u\n", y, x, a);
+            return 1;
+        }
+    }
+
+    ASSERT_EQ_INT(fix16_angle_atan2(0, 0), 0);
+    ASSERT_EQ_INT(fix16_angle_atan2(0, -fix16_one), fix16_angle_half);
+    ASSERT_EQ_INT(fix16_angle_atan2(0, fix16_one), 0);
+    return 0;
+}
+
+int test_angle()
+{
+    TEST(test_angle_convert());
+    TEST(test_angle_sincos());
+    TEST(test_angle_phase());
+    TEST(test_angle_atan2());
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef TESTS_ANGLE_H
+#define TESTS_ANGLE_H
+
+int test_angle();
+
+#endif // TESTS_ANGLE_H
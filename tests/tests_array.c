@@ -0,0 +1,123 @@
+#include "tests_array.h"
+#include "tests.h"
+#include <libfixmath/fix16_array.h>
+
+#define PAIRS_COUNT (TESTCASES_COUNT * TESTCASES_COUNT)
+
+typedef fix16_t (*scalar_fn_t)(fix16_t, fix16_t);
+typedef void (*array_fn_t)(fix16_t*, const fix16_t*, const fix16_t*, size_t);
+typedef void (*array_scalar_fn_t)(fix16_t*, const fix16_t*, fix16_t, size_t);
+
+typedef struct
+{
+    const char*       name;
+    scalar_fn_t       scalar;
+    array_fn_t        array;
+    array_scalar_fn_t array_scalar;
+} array_case_t;
+
+static fix16_t wrap_add(fix16_t a, fix16_t b)
+{
+    return fix16_add(a, b);
+}
+
+static fix16_t wrap_sub(fix16_t a, fix16_t b)
+{
+    return fix16_sub(a, b);
+}
+
+static const array_case_t array_cases[] = {
+    {"add", wrap_add, fix16_add_array, fix16_add_array_scalar},
+    {"sub", wrap_sub, fix16_sub_array, fix16_sub_array_scalar},
+    {"mul", fix16_mul, fix16_mul_array, fix16_mul_array_scalar},
+    {"div", fix16_div, fix16_div_array, fix16_div_array_scalar},
+#ifndef FIXMATH_NO_OVERFLOW
+    {"sadd", fix16_sadd, fix16_sadd_array, fix16_sadd_array_scalar},
+    {"ssub", fix16_ssub, fix16_ssub_array, fix16_ssub_array_scalar},
+    {"smul", fix16_smul, fix16_smul_array, fix16_smul_array_scalar},
+    {"sdiv", fix16_sdiv, fix16_sdiv_array, fix16_sdiv_array_scalar},
+#endif
+};
+
+#define ARRAY_CASES_COUNT (sizeof(array_cases) / sizeof(array_cases[0]))
+
+static fix16_t lhs[PAIRS_COUNT];
+static fix16_t rhs[PAIRS_COUNT];
+static fix16_t out[PAIRS_COUNT];
+
+int test_array_pairs()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            lhs[(i * TESTCASES_COUNT) + j] = testcases[i];
+            rhs[(i * TESTCASES_COUNT) + j] = testcases[j];
+        }
+    }
+
+    for (unsigned c = 0; c < ARRAY_CASES_COUNT; ++c)
+    {
+        const array_case_t* tc = &array_cases[c];
+        tc->array(out, lhs, rhs, PAIRS_COUNT);
+        for (unsigned k = 0; k < PAIRS_COUNT; ++k)
+        {
+            if (out[k] != tc->scalar(lhs[k], rhs[k]))
+                printf("%s: %i, %i\n", tc->name, lhs[k], rhs[k]);
+            ASSERT_EQ_INT(out[k], tc->scalar(lhs[k], rhs[k]));
+        }
+    }
+    return 0;
+}
+
+int test_array_scalar()
+{
+    for (unsigned c = 0; c < ARRAY_CASES_COUNT; ++c)
+    {
+        const array_case_t* tc = &array_cases[c];
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            fix16_t b = testcases[j];
+            tc->array_scalar(out, testcases, b, TESTCASES_COUNT);
+            for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+            {
+                if (out[i] != tc->scalar(testcases[i], b))
+                    printf("%s: %i, %i\n", tc->name, testcases[i], b);
+                ASSERT_EQ_INT(out[i], tc->scalar(testcases[i], b));
+            }
+        }
+    }
+    return 0;
+}
+
+int test_array_inplace()
+{
+    for (unsigned c = 0; c < ARRAY_CASES_COUNT; ++c)
+    {
+        const array_case_t* tc = &array_cases[c];
+        memcpy(out, lhs, sizeof(out));
+        tc->array(out, out, rhs, PAIRS_COUNT);
+        for (unsigned k = 0; k < PAIRS_COUNT; ++k)
+            ASSERT_EQ_INT(out[k], tc->scalar(lhs[k], rhs[k]));
+    }
+    return 0;
+}
+
+int test_array_level(fix16_simd_e level)
+{
+    printf("%*s simd: %s\n", stack_depth, "", fix16_simd_name(level));
+    fix16_simd_force(level);
+    TEST(test_array_pairs());
+    TEST(test_array_scalar());
+    TEST(test_array_inplace());
+    return 0;
+}
+
+int test_array()
+{
+    fix16_simd_e initial = fix16_simd_level();
+    for (unsigned l = 0; l <= (unsigned)fix16_simd_supported(); ++l)
+        TEST(test_array_level((fix16_simd_e)l));
+    fix16_simd_force(initial);
+    return 0;
+}
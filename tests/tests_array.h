@@ -0,0 +1,6 @@
+#ifndef TESTS_ARRAY_H
+#define TESTS_ARRAY_H
+
+int test_array();
+
+#endif // TESTS_ARRAY_H
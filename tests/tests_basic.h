@@ -6,5 +6,6 @@ int test_add(void);
 int test_mul(void);
 int test_div(void);
 int test_sub();
+int test_saturate();
 
 #endif // TESTS_BASIC_H
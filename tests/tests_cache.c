@@ -0,0 +1,62 @@
+#include "tests_cache.h"
+#include "tests.h"
+
+#if defined(FIXMATH_CACHE_STATS) && !defined(FIXMATH_NO_CACHE)
+/* Every call is a hit or a miss, and only misses evict. */
+static int cache_check(fix16_cache_e cache, uint32_t calls)
+{
+    fix16_cache_stats_t stats = fix16_cache_stats(cache);
+    ASSERT_EQ_INT(stats.hits + stats.misses, calls);
+    if (stats.evictions > stats.misses)
+        ASSERT_EQ_INT(stats.evictions, stats.misses);
+    return 0;
+}
+
+/* A repeated input hits, it may have been cached by an earlier test. More
+ * distinct inputs than there are slots evict.
+ */
+static int test_cache_counters()
+{
+    fix16_cache_stats_clear();
+#ifndef FIXMATH_SIN_LUT
+    fix16_sin(F16(0.75));
+    fix16_sin(F16(0.75));
+    TEST(cache_check(fix16_cache_sin, 2));
+    ASSERT_EQ_INT(fix16_cache_stats(fix16_cache_sin).hits >= 1, 1);
+#endif
+    fix16_atan2(F16(0.5), F16(2));
+    fix16_atan2(F16(0.5), F16(2));
+    TEST(cache_check(fix16_cache_atan2, 2));
+    ASSERT_EQ_INT(fix16_cache_stats(fix16_cache_atan2).hits >= 1, 1);
+    fix16_exp(F16(-1.5));
+    fix16_exp(F16(-1.5));
+    TEST(cache_check(fix16_cache_exp, 2));
+    ASSERT_EQ_INT(fix16_cache_stats(fix16_cache_exp).hits >= 1, 1);
+
+    fix16_cache_stats_clear();
+    for (fix16_t i = 0; i < 0x10000; ++i)
+    {
+        fix16_sin(i << 5);
+        fix16_atan2(i, F16(3));
+        fix16_exp(-i);
+    }
+#ifndef FIXMATH_SIN_LUT
+    TEST(cache_check(fix16_cache_sin, 0x10000));
+    ASSERT_EQ_INT(fix16_cache_stats(fix16_cache_sin).evictions > 0, 1);
+#endif
+    TEST(cache_check(fix16_cache_atan2, 0x10000));
+    ASSERT_EQ_INT(fix16_cache_stats(fix16_cache_atan2).evictions > 0, 1);
+    // fix16_exp(0) returns before the cache.
+    TEST(cache_check(fix16_cache_exp, 0xFFFF));
+    ASSERT_EQ_INT(fix16_cache_stats(fix16_cache_exp).evictions > 0, 1);
+    return 0;
+}
+#endif
+
+int test_cache()
+{
+#if defined(FIXMATH_CACHE_STATS) && !defined(FIXMATH_NO_CACHE)
+    TEST(test_cache_counters());
+#endif
+    return 0;
+}
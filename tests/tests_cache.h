@@ -0,0 +1,6 @@
+#ifndef TESTS_CACHE_H
+#define TESTS_CACHE_H
+
+int test_cache();
+
+#endif // TESTS_CACHE_H
@@ -0,0 +1,126 @@
+#include "tests_cordic.h"
+#include "tests.h"
+#include <libfixmath/fix16_array.h>
+
+/* Largest difference from libm of fix16_cordic_sincos over the whole range. */
+static int cordic_sincos_error(unsigned iterations)
+{
+    int max = 0;
+    for (long long x = fix16_minimum; x <= fix16_maximum; x += 9973)
+    {
+        fix16_t s;
+        fix16_t c;
+        fix16_cordic_sincos((fix16_t)x, &s, &c, iterations);
+        double a  = fix16_to_dbl((fix16_t)x);
+        int    es = delta(s, fix16_from_dbl(sin(a)));
+        int    ec = delta(c, fix16_from_dbl(cos(a)));
+        if (es > max)
+            max = es;
+        if (ec > max)
+            max = ec;
+    }
+    return max;
+}
+
+static int test_cordic_sincos()
+{
+    ASSERT_EQ_INT(cordic_sincos_error(fix16_cordic_iterations), 1);
+    ASSERT_EQ_INT(cordic_sincos_error(1000), 1);
+    /* Four bits fewer are about 16 times less accurate. */
+    int error = cordic_sincos_error(16);
+    if ((error < 2) || (error > 4))
+    {
+        printf("16 iterations: %i LSB\n", error);
+        return 1;
+    }
+
+    fix16_t s;
+    fix16_t c;
+    fix16_cordic_sincos(0, &s, &c, fix16_cordic_iterations);
+    ASSERT_EQ_INT(s, 0);
+    ASSERT_EQ_INT(c, fix16_one);
+    fix16_cordic_sincos(fix16_pi, &s, &c, fix16_cordic_iterations);
+    ASSERT_EQ_INT(s, 0);
+    ASSERT_EQ_INT(c, -fix16_one);
+    return 0;
+}
+
+static int test_cordic_atan2()
+{
+    uint32_t seed = 1U;
+    for (int i = 0; i < 100000; ++i)
+    {
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t y = (fix16_t)seed >> (seed % 31U);
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t x = (fix16_t)seed >> (seed % 31U);
+
+        fix16_t hypot;
+        fix16_t angle = fix16_cordic_atan2(y, x, &hypot,
+                                           fix16_cordic_iterations);
+        double  ref   = sqrt(((double)x * x) + ((double)y * y)) / 65536.0;
+        fix16_t refh  = (ref < 32767.0) ? fix16_from_dbl(ref) : fix16_maximum;
+        if ((delta(angle, fix16_from_dbl(atan2(y, x))) > 1) ||
+            (delta(hypot, refh) > 1 + (refh >> 25)))
+        {
+            printf("atan2(%i, %i) = %i, hypot %i\n", y, x, angle, hypot);
+            return 1;
+        }
+    }
+
+    fix16_t hypot;
+    ASSERT_EQ_INT(fix16_cordic_atan2(0, 0, &hypot, fix16_cordic_iterations),
+                  0);
+    ASSERT_EQ_INT(hypot, 0);
+    ASSERT_EQ_INT(fix16_cordic_atan2(0, -fix16_one, &hypot,
+                                     fix16_cordic_iterations),
+                  fix16_pi);
+    ASSERT_EQ_INT(hypot, fix16_one);
+    ASSERT_EQ_INT(fix16_cordic_atan2(fix16_from_int(3), fix16_from_int(-4),
+                                     NULL, fix16_cordic_iterations),
+                  fix16_from_dbl(atan2(3, -4)));
+    fix16_cordic_atan2(fix16_minimum, fix16_minimum, &hypot,
+                       fix16_cordic_iterations);
+    ASSERT_EQ_INT(hypot, fix16_maximum);
+    return 0;
+}
+
+static int test_cordic_array()
+{
+    fix16_t a[37];
+    fix16_t b[37];
+    fix16_t s[37];
+    fix16_t c[37];
+    for (int i = 0; i < 37; ++i)
+    {
+        a[i] = fix16_from_int(i - 18) * 5 + i;
+        b[i] = fix16_from_int(18 - i) + i;
+    }
+
+    fix16_cordic_sincos_array(s, c, a, 37, 18);
+    for (int i = 0; i < 37; ++i)
+    {
+        fix16_t si;
+        fix16_t ci;
+        fix16_cordic_sincos(a[i], &si, &ci, 18);
+        ASSERT_EQ_INT(s[i], si);
+        ASSERT_EQ_INT(c[i], ci);
+    }
+
+    fix16_cordic_atan2_array(s, c, a, b, 37, 18);
+    for (int i = 0; i < 37; ++i)
+    {
+        fix16_t hypot;
+        ASSERT_EQ_INT(s[i], fix16_cordic_atan2(a[i], b[i], &hypot, 18));
+        ASSERT_EQ_INT(c[i], hypot);
+    }
+    return 0;
+}
+
+int test_cordic()
+{
+    TEST(test_cordic_sincos());
+    TEST(test_cordic_atan2());
+    TEST(test_cordic_array());
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef TESTS_CORDIC_H
+#define TESTS_CORDIC_H
+
+int test_cordic();
+
+#endif // TESTS_CORDIC_H
@@ -0,0 +1,156 @@
+#include "tests_divisor.h"
+#include "tests.h"
+#include <libfixmath/fix16_array.h>
+
+/* Under FIXMATH_NO_OVERFLOW the result of an overflowing division is
+ * unspecified, so only quotients that fit are compared there.
+ */
+static int divisor_comparable(fix16_t a, fix16_t b)
+{
+#ifdef FIXMATH_NO_OVERFLOW
+    double q = fix16_to_dbl(a) / fix16_to_dbl(b);
+    return (b != 0) && (q < 32767.0) && (q > -32767.0);
+#else
+    (void)a;
+    (void)b;
+    return 1;
+#endif
+}
+
+/* fix16_div is exact except with FIXMATH_FAST_DIV, which may be up to 3 LSB
+ * off.
+ */
+static int divisor_equal(fix16_t by, fix16_t div)
+{
+#ifndef FIXMATH_FAST_DIV
+    return (by == div);
+#else
+    const uint32_t lsb = 3U;
+    if ((by == fix16_overflow) || (div == fix16_overflow))
+    {
+        fix16_t other = (by == fix16_overflow) ? div : by;
+        return (other == fix16_overflow) ||
+               (fix16_abs(other) >= (fix16_t)(0x7FFFFFFFU - lsb));
+    }
+    return (((uint32_t)by - (uint32_t)div + lsb) <= (2U * lsb));
+#endif
+}
+
+static int divisor_check(fix16_t a, fix16_t b)
+{
+    fix16_divisor_t d = fix16_divisor_create(b);
+    if (divisor_comparable(a, b))
+    {
+        if (!divisor_equal(fix16_div_by(a, &d), fix16_div(a, b)))
+        {
+            printf("%i / %i\n", a, b);
+            ASSERT_EQ_INT(fix16_div_by(a, &d), fix16_div(a, b));
+        }
+#ifndef FIXMATH_NO_OVERFLOW
+        if (!divisor_equal(fix16_sdiv_by(a, &d), fix16_sdiv(a, b)))
+            ASSERT_EQ_INT(fix16_sdiv_by(a, &d), fix16_sdiv(a, b));
+#endif
+    }
+    return 0;
+}
+
+int test_divisor_short()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            if (divisor_check(testcases[i], testcases[j]))
+                return 1;
+        }
+    }
+    return 0;
+}
+
+int test_divisor_random()
+{
+    // Fixed LCG so every variant sees the same operands.
+    uint32_t seed = 12345U;
+    for (unsigned i = 0; i < 200000; ++i)
+    {
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t a = (fix16_t)(seed ^ (seed << 13)) >> (seed % 31U);
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t b = (fix16_t)(seed ^ (seed << 11)) >> (seed % 31U);
+        if (divisor_check(a, b))
+            return 1;
+    }
+    return 0;
+}
+
+int test_divisor_large()
+{
+    // Divisors of 2^20 and more take the estimated path of the hardware
+    // division, e.g. -198211346 / 289273670 is -44905.4999 LSB.
+    if (divisor_check(-198211346, 289273670))
+        return 1;
+    uint32_t seed = 2468U;
+    for (unsigned i = 0; i < 200000; ++i)
+    {
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t a = (fix16_t)(seed ^ (seed << 9));
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t b = (fix16_t)(((seed ^ (seed << 5)) >> 1) | 0x100000U);
+        if (seed & 0x10000U)
+            b = -b;
+        if (divisor_check(a, b))
+            return 1;
+    }
+    return 0;
+}
+
+int test_divisor_recip()
+{
+    // Every reciprocal that does not overflow and a sweep of larger inputs.
+    for (fix16_t x = -0x20000; x <= 0x20000; ++x)
+    {
+        if (divisor_check(fix16_one, x))
+            return 1;
+        if (divisor_comparable(fix16_one, x) &&
+            !divisor_equal(fix16_recip(x), fix16_div(fix16_one, x)))
+            ASSERT_EQ_INT(fix16_recip(x), fix16_div(fix16_one, x));
+    }
+
+    uint32_t seed = 54321U;
+    for (unsigned i = 0; i < 200000; ++i)
+    {
+        seed      = (seed * 1103515245U) + 12345U;
+        fix16_t x = (fix16_t)(seed ^ (seed << 7));
+        if (divisor_comparable(fix16_one, x) &&
+            !divisor_equal(fix16_recip(x), fix16_div(fix16_one, x)))
+            ASSERT_EQ_INT(fix16_recip(x), fix16_div(fix16_one, x));
+#ifndef FIXMATH_NO_OVERFLOW
+        if (!divisor_equal(fix16_srecip(x), fix16_sdiv(fix16_one, x)))
+            ASSERT_EQ_INT(fix16_srecip(x), fix16_sdiv(fix16_one, x));
+#endif
+    }
+    return 0;
+}
+
+int test_divisor_array()
+{
+    fix16_t out[TESTCASES_COUNT];
+    for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+    {
+        fix16_divisor_t d = fix16_divisor_create(testcases[j]);
+        fix16_div_by_array(out, testcases, &d, TESTCASES_COUNT);
+        for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+            ASSERT_EQ_INT(out[i], fix16_div_by(testcases[i], &d));
+    }
+    return 0;
+}
+
+int test_divisor()
+{
+    TEST(test_divisor_short());
+    TEST(test_divisor_random());
+    TEST(test_divisor_large());
+    TEST(test_divisor_recip());
+    TEST(test_divisor_array());
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef TESTS_DIVISOR_H
+#define TESTS_DIVISOR_H
+
+int test_divisor();
+
+#endif // TESTS_DIVISOR_H
@@ -0,0 +1,176 @@
+#include "tests_dot.h"
+#include "tests.h"
+#include <libfixmath/fix16_array.h>
+
+#define DOT_MAX_LEN 37
+
+/* The products are summed exactly, so a single rounding separates the result
+ * from the real-valued one.
+ */
+static const double dot_eps = 2.0 / 65536.0;
+
+static double dot_ref(const fix16_t* a, size_t stride_a, const fix16_t* b,
+                      size_t stride_b, size_t n)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < n; ++i)
+        sum += fix16_to_dbl(a[i * stride_a]) * fix16_to_dbl(b[i * stride_b]);
+    return sum;
+}
+
+int test_fma_short()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            fix16_t a = testcases[i];
+            fix16_t b = testcases[j];
+#if !defined(FIXMATH_OPTIMIZE_8BIT) && !defined(FIXMATH_NO_OVERFLOW)
+            ASSERT_EQ_INT(fix16_fma(a, b, 0), fix16_smul(a, b));
+#endif
+            for (unsigned k = 0; k < TESTCASES_COUNT; k += 7)
+            {
+                fix16_t c   = testcases[k];
+                double  ref = fix16_to_dbl(a) * fix16_to_dbl(b) +
+                             fix16_to_dbl(c);
+                fix16_t res = fix16_fma(a, b, c);
+                if ((ref < 32767.0) && (ref > -32767.0))
+                {
+                    ASSERT_NEAR_DOUBLE(ref, fix16_to_dbl(res), dot_eps,
+                                       "%i * %i + %i\n", a, b, c);
+                }
+#ifndef FIXMATH_NO_OVERFLOW
+                else if (ref >= 32768.0)
+                {
+                    ASSERT_EQ_INT(res, fix16_maximum);
+                }
+                else if (ref < -32768.0)
+                {
+                    ASSERT_EQ_INT(res, fix16_minimum);
+                }
+#endif
+            }
+        }
+    }
+    return 0;
+}
+
+int test_dot_random()
+{
+    fix16_t a[DOT_MAX_LEN];
+    fix16_t b[DOT_MAX_LEN];
+
+    // Operands below 64 in magnitude keep every sum in range.
+    uint32_t seed = 24680U;
+    for (unsigned round = 0; round < 200; ++round)
+    {
+        for (unsigned i = 0; i < DOT_MAX_LEN; ++i)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            a[i] = (fix16_t)(seed ^ (seed << 9)) >> (10U + (seed % 16U));
+            seed = (seed * 1103515245U) + 12345U;
+            b[i] = (fix16_t)(seed ^ (seed << 5)) >> (10U + (seed % 16U));
+        }
+
+        for (size_t n = 0; n <= DOT_MAX_LEN; ++n)
+        {
+            fix16_t res = fix16_dot(a, b, n);
+            ASSERT_EQ_INT(res, fix16_dot_strided(a, 1, b, 1, n));
+            ASSERT_NEAR_DOUBLE(dot_ref(a, 1, b, 1, n), fix16_to_dbl(res),
+                               dot_eps, "n = %u\n", (unsigned)n);
+        }
+    }
+    return 0;
+}
+
+int test_dot_strided()
+{
+    // Columns of a 4x4 row-major matrix against a contiguous vector.
+    fix16_t m[16];
+    fix16_t col[4];
+    for (unsigned i = 0; i < 16; ++i)
+        m[i] = testcases[40 + (i * 3U)] >> 8;
+
+    for (unsigned c = 0; c < 4; ++c)
+    {
+        for (unsigned r = 0; r < 4; ++r)
+            col[r] = m[(r << 2) + c];
+        ASSERT_EQ_INT(fix16_dot_strided(&m[c], 4, &m[c << 2], 1, 4),
+                      fix16_dot(col, &m[c << 2], 4));
+        ASSERT_NEAR_DOUBLE(dot_ref(&m[c], 4, &m[c << 2], 1, 4),
+                           fix16_to_dbl(fix16_dot(col, &m[c << 2], 4)),
+                           dot_eps, "column %u\n", c);
+    }
+    return 0;
+}
+
+int test_dot_saturate()
+{
+    fix16_t big[DOT_MAX_LEN];
+    fix16_t neg[DOT_MAX_LEN];
+    for (unsigned i = 0; i < DOT_MAX_LEN; ++i)
+    {
+        big[i] = fix16_from_int(200);
+        neg[i] = fix16_from_int(-200);
+    }
+
+    // Partial sums far out of range are fine as long as the total fits.
+    fix16_t alt[2 * DOT_MAX_LEN];
+    for (unsigned i = 0; i < DOT_MAX_LEN; ++i)
+    {
+        alt[2 * i]     = big[i];
+        alt[2 * i + 1] = neg[i];
+    }
+    fix16_t ones[2 * DOT_MAX_LEN];
+    for (unsigned i = 0; i < 2 * DOT_MAX_LEN; ++i)
+        ones[i] = fix16_from_int(200);
+    ASSERT_EQ_INT(fix16_dot(alt, ones, 2 * DOT_MAX_LEN), 0);
+
+#ifndef FIXMATH_NO_OVERFLOW
+    ASSERT_EQ_INT(fix16_dot(big, big, DOT_MAX_LEN), fix16_maximum);
+    ASSERT_EQ_INT(fix16_dot(big, neg, DOT_MAX_LEN), fix16_minimum);
+#endif
+    return 0;
+}
+
+/* Sixteen products of 2^62 sum to 0 modulo 2^64 at every SIMD level, and in
+ * the scalar loop, which must not overflow a signed sum on the way.
+ */
+int test_dot_wrap()
+{
+    fix16_t a[17];
+    fix16_t b[17];
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        a[i] = fix16_minimum;
+        b[i] = fix16_minimum;
+    }
+    a[16] = fix16_one;
+    b[16] = fix16_one;
+    ASSERT_EQ_INT(fix16_dot(a, b, 17), fix16_one);
+    ASSERT_EQ_INT(fix16_dot_strided(a, 1, b, 1, 17), fix16_one);
+    return 0;
+}
+
+int test_dot_level(fix16_simd_e level)
+{
+    printf("%*s simd: %s\n", stack_depth, "", fix16_simd_name(level));
+    fix16_simd_force(level);
+    TEST(test_dot_random());
+    TEST(test_dot_strided());
+    TEST(test_dot_saturate());
+    TEST(test_dot_wrap());
+    return 0;
+}
+
+int test_dot()
+{
+    TEST(test_fma_short());
+
+    fix16_simd_e initial = fix16_simd_level();
+    for (unsigned l = 0; l <= (unsigned)fix16_simd_supported(); ++l)
+        TEST(test_dot_level((fix16_simd_e)l));
+    fix16_simd_force(initial);
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef TESTS_DOT_H
+#define TESTS_DOT_H
+
+int test_dot();
+
+#endif // TESTS_DOT_H
@@ -0,0 +1,254 @@
+#include "tests_exp.h"
+#include "tests.h"
+#include <libfixmath/fix16_array.h>
+
+/* fix16_exp against libm over every input that does not saturate, within
+ * 1 LSB plus 2^-29 of the result.
+ */
+static int test_exp_accuracy()
+{
+    fix16_t prev = 0;
+    for (fix16_t x = -772242; x < 681391; ++x)
+    {
+        fix16_t out = fix16_exp(x);
+        double  ref = exp(fix16_to_dbl(x)) * fix16_one;
+        if ((fabs(out - ref) > 1.0 + (ref / (1 << 29))) || (out < prev))
+        {
+            printf("exp(%i) = %i, expected %.1f\n", x, out, ref);
+            return 1;
+        }
+        prev = out;
+    }
+    return 0;
+}
+
+static int test_exp_limits()
+{
+    ASSERT_EQ_INT(fix16_exp(0), fix16_one);
+    ASSERT_EQ_INT(fix16_exp(fix16_one), fix16_e);
+    ASSERT_EQ_INT(fix16_exp(fix16_from_int(-1)), fix16_from_dbl(exp(-1.0)));
+    ASSERT_EQ_INT(fix16_exp(681391), fix16_maximum);
+    ASSERT_EQ_INT(fix16_exp(fix16_maximum), fix16_maximum);
+    ASSERT_EQ_INT(fix16_exp(-772243), 0);
+    ASSERT_EQ_INT(fix16_exp(fix16_minimum), 0);
+    return 0;
+}
+
+static int test_exp_array()
+{
+    fix16_t in[37];
+    fix16_t out[37];
+    for (int i = 0; i < 37; ++i)
+        in[i] = fix16_from_int(i - 18) / 2 + i;
+
+    fix16_exp_array(out, in, 37);
+    for (int i = 0; i < 37; ++i)
+        ASSERT_EQ_INT(out[i], fix16_exp(in[i]));
+    return 0;
+}
+
+/* fix16_log, fix16_log2 and fix16_log10 against libm within 1 LSB, at
+ * about 4096 inputs per octave over the positive range, and monotonic. The
+ * truncation of FIXMATH_NO_ROUNDING may add the 2^-26 of the intermediate.
+ */
+static int test_log_accuracy()
+{
+    fix16_t prev[3] = {fix16_minimum, fix16_minimum, fix16_minimum};
+    for (uint32_t u = 1; u <= (uint32_t)fix16_maximum; u += (u >> 12) + 1)
+    {
+        fix16_t x      = (fix16_t)u;
+        double  v      = fix16_to_dbl(x);
+        fix16_t out[3] = {fix16_log(x), fix16_log2(x), fix16_log10(x)};
+        double  ref[3] = {log(v), log2(v), log10(v)};
+        for (int i = 0; i < 3; ++i)
+        {
+            double err = fabs(out[i] - ref[i] * fix16_one);
+            if ((err > 1.0 + 1.0 / 1024) || (out[i] < prev[i]))
+            {
+                printf("log #%i (%i) = %i, expected %.1f\n", i, x, out[i],
+                       ref[i] * fix16_one);
+                return 1;
+            }
+            prev[i] = out[i];
+        }
+    }
+    return 0;
+}
+
+static int test_log_limits()
+{
+    ASSERT_EQ_INT(fix16_log(fix16_one), 0);
+    ASSERT_EQ_INT(fix16_log(0), fix16_minimum);
+    ASSERT_EQ_INT(fix16_log(-fix16_one), fix16_minimum);
+    ASSERT_EQ_INT(fix16_log2(1), fix16_from_int(-16));
+    ASSERT_EQ_INT(fix16_log2(fix16_from_int(1024)), fix16_from_int(10));
+    ASSERT_EQ_INT(fix16_log2(fix16_one / 8), fix16_from_int(-3));
+    ASSERT_EQ_INT(fix16_log2(0), fix16_overflow);
+    ASSERT_EQ_INT(fix16_slog2(-1), fix16_minimum);
+#ifndef FIXMATH_NO_ROUNDING
+    ASSERT_EQ_INT(fix16_log(fix16_e), fix16_one);
+    ASSERT_EQ_INT(fix16_log10(fix16_from_int(1000)), fix16_from_int(3));
+#endif
+    ASSERT_EQ_INT(fix16_log10(fix16_one), 0);
+    ASSERT_EQ_INT(fix16_log10(0), fix16_minimum);
+    return 0;
+}
+
+static int test_log_array()
+{
+    fix16_t in[37];
+    fix16_t out[37];
+    for (int i = 0; i < 37; ++i)
+        in[i] = fix16_from_int(i - 18) * 99 + i;
+
+    fix16_log_array(out, in, 37);
+    for (int i = 0; i < 37; ++i)
+        ASSERT_EQ_INT(out[i], fix16_log(in[i]));
+    fix16_log2_array(out, in, 37);
+    for (int i = 0; i < 37; ++i)
+        ASSERT_EQ_INT(out[i], fix16_log2(in[i]));
+    fix16_log10_array(out, in, 37);
+    for (int i = 0; i < 37; ++i)
+        ASSERT_EQ_INT(out[i], fix16_log10(in[i]));
+    return 0;
+}
+
+/* fix16_exp2 against libm within 1 LSB plus 2^-29 of the result. */
+static int test_exp2()
+{
+    for (uint32_t u = 0; u < 0xFFFFFFFFU - 9999; u += 9973)
+    {
+        fix16_t x   = (fix16_t)u;
+        double  ref = exp2(fix16_to_dbl(x)) * fix16_one;
+        if (ref > fix16_maximum)
+            ref = fix16_maximum;
+        if (fabs(fix16_exp2(x) - ref) > 1.0 + (ref / (1 << 29)))
+        {
+            printf("exp2(%i) = %i, expected %.1f\n", x, fix16_exp2(x), ref);
+            return 1;
+        }
+    }
+    ASSERT_EQ_INT(fix16_exp2(0), fix16_one);
+    ASSERT_EQ_INT(fix16_exp2(fix16_from_int(-16)), 1);
+    ASSERT_EQ_INT(fix16_exp2(fix16_from_int(14)), fix16_from_int(16384));
+    ASSERT_EQ_INT(fix16_exp2(fix16_from_int(15)), fix16_maximum);
+    ASSERT_EQ_INT(fix16_exp2(fix16_from_int(-18)), 0);
+    return 0;
+}
+
+/* fix16_pow against libm over a grid of positive bases and exponents in
+ * [-8, 8), within 1 LSB plus |y| * 2^-25 of the result.
+ */
+static int test_pow_accuracy()
+{
+    for (fix16_t x = 7; x < fix16_from_int(1000); x += (x >> 5) + 3)
+    {
+        for (fix16_t y = -fix16_from_int(8); y < fix16_from_int(8); y += 4099)
+        {
+            double ref = pow(fix16_to_dbl(x), fix16_to_dbl(y)) * fix16_one;
+            fix16_t out = fix16_pow(x, y);
+            if (ref >= fix16_maximum)
+            {
+                if (out != fix16_maximum)
+                    ASSERT_EQ_INT(out, fix16_overflow);
+                continue;
+            }
+            double bound = 1.0 + ref * fabs(fix16_to_dbl(y)) / (1 << 25);
+            if (fabs(out - ref) > bound)
+            {
+                printf("pow(%i, %i) = %i, expected %.1f\n", x, y, out, ref);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* fix16_powi against libm, within 1 LSB plus |n| * 2^-31 of the result. */
+static int test_powi()
+{
+    for (size_t i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        fix16_t x = testcases[i];
+        for (int32_t n = -40; n <= 40; ++n)
+        {
+            double ref = pow(fix16_to_dbl(x), n) * fix16_one;
+            fix16_t out = fix16_powi(x, n);
+            if ((x == 0) ? (n < 0) : (fabs(ref) >= 2147483647.5))
+            {
+                ASSERT_EQ_INT(out, fix16_overflow);
+                continue;
+            }
+            if (fabs(out - ref) > 1.0 + fabs(ref) * abs(n) / 2147483648.0)
+            {
+                printf("powi(%i, %i) = %i, expected %.1f\n", x, n, out, ref);
+                return 1;
+            }
+        }
+    }
+    ASSERT_EQ_INT(fix16_powi(fix16_from_int(-2), 15), fix16_minimum);
+    ASSERT_EQ_INT(fix16_powi(fix16_from_int(3), 9), fix16_from_int(19683));
+    ASSERT_EQ_INT(fix16_powi(fix16_one / 2, 16), 1);
+    ASSERT_EQ_INT(fix16_powi(fix16_from_int(2), -16), 1);
+    ASSERT_EQ_INT(fix16_powi(fix16_from_int(-2), -3), -fix16_one / 8);
+    ASSERT_EQ_INT(fix16_powi(0, 0), fix16_one);
+    ASSERT_EQ_INT(fix16_powi(0, -1), fix16_overflow);
+    ASSERT_EQ_INT(fix16_powi(fix16_maximum, 0x7FFFFFFF), fix16_overflow);
+    ASSERT_EQ_INT(fix16_powi(fix16_maximum, -0x7FFFFFFF - 1), 0);
+    return 0;
+}
+
+static int test_pow_limits()
+{
+    ASSERT_EQ_INT(fix16_pow(fix16_from_int(-3), fix16_from_int(3)),
+                  fix16_from_int(-27));
+    ASSERT_EQ_INT(fix16_pow(fix16_from_int(4), fix16_one / 2),
+                  fix16_from_int(2));
+    ASSERT_EQ_INT(fix16_pow(fix16_one, fix16_maximum), fix16_one);
+    ASSERT_EQ_INT(fix16_pow(0, fix16_one / 2), 0);
+    ASSERT_EQ_INT(fix16_pow(0, -fix16_one / 2), fix16_overflow);
+    ASSERT_EQ_INT(fix16_pow(-fix16_one, fix16_one / 2), fix16_overflow);
+    ASSERT_EQ_INT(fix16_pow(fix16_from_int(2), F16(15.5)), fix16_overflow);
+    ASSERT_EQ_INT(fix16_pow(fix16_from_int(2), F16(-17.5)), 0);
+#ifndef FIXMATH_NO_OVERFLOW
+    ASSERT_EQ_INT(fix16_spow(fix16_from_int(2), F16(15.5)), fix16_maximum);
+    ASSERT_EQ_INT(fix16_spow(0, -fix16_one / 2), fix16_maximum);
+    ASSERT_EQ_INT(fix16_spow(-fix16_one, fix16_one / 2), fix16_overflow);
+    ASSERT_EQ_INT(fix16_spowi(fix16_from_int(-2), 17), fix16_minimum);
+    ASSERT_EQ_INT(fix16_spowi(fix16_from_int(-2), 18), fix16_maximum);
+    ASSERT_EQ_INT(fix16_spowi(0, -2), fix16_maximum);
+#endif
+    return 0;
+}
+
+static int test_pow_array()
+{
+    fix16_t in[37];
+    fix16_t out[37];
+    for (int i = 0; i < 37; ++i)
+        in[i] = fix16_one * i / 36 + i;
+
+    fix16_pow_array(out, in, F16(1 / 2.2), 37);
+    for (int i = 0; i < 37; ++i)
+        ASSERT_EQ_INT(out[i], fix16_pow(in[i], F16(1 / 2.2)));
+    fix16_exp2_array(out, in, 37);
+    for (int i = 0; i < 37; ++i)
+        ASSERT_EQ_INT(out[i], fix16_exp2(in[i]));
+    return 0;
+}
+
+int test_exp()
+{
+    TEST(test_exp_accuracy());
+    TEST(test_exp_limits());
+    TEST(test_exp_array());
+    TEST(test_log_accuracy());
+    TEST(test_log_limits());
+    TEST(test_log_array());
+    TEST(test_exp2());
+    TEST(test_pow_accuracy());
+    TEST(test_powi());
+    TEST(test_pow_limits());
+    TEST(test_pow_array());
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef TESTS_EXP_H
+#define TESTS_EXP_H
+
+int test_exp();
+
+#endif // TESTS_EXP_H
@@ -0,0 +1,106 @@
+#include "tests_expr.h"
+#include "tests.h"
+#include <libfixmath/fix16.hpp>
+
+using fixmath::expr::lazy;
+
+typedef fixmath::Fixed<8, 24> Q8_24;
+typedef long long             Acc;
+
+/* Rounds an exact value with F fraction bits to Q16.16 like the default
+ * policy and saturates it.
+ */
+static fix16_t reference(Acc x, int F)
+{
+    bool               negative = (x < 0);
+    unsigned long long m = negative ? 0ULL - (unsigned long long)x
+                                    : (unsigned long long)x;
+    int                s = F - 16;
+#ifndef FIXMATH_NO_ROUNDING
+    m += 1ULL << (s - 1);
+#else
+    if (negative)
+        m += (1ULL << s) - 1;
+#endif
+    m >>= s;
+    if (m > 0x7FFFFFFFULL + negative)
+        return (negative ? fix16_minimum : fix16_maximum);
+    return ((fix16_t)(negative ? 0U - (uint32_t)m : (uint32_t)m));
+}
+
+/* a * b + c * d and a * b - c * d with one rounding, against the exact
+ * 64 bit result. The testcases are picked so that it fits.
+ */
+int test_expr_dot()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            Fix16 a = testcases[i];
+            Fix16 b = testcases[j];
+            Fix16 c = testcases[(i + 7) % TESTCASES_COUNT];
+            Fix16 d = testcases[(j + 3) % TESTCASES_COUNT];
+
+            Acc ab = (Acc)a.value * b.value;
+            Acc cd = (Acc)c.value * d.value;
+            if (ab > (1LL << 61) || ab < -(1LL << 61) || cd > (1LL << 61) ||
+                cd < -(1LL << 61))
+                continue;
+
+            Fix16 sum  = lazy(a) * b + lazy(c) * d;
+            Fix16 diff = lazy(a) * b - c * lazy(d);
+            ASSERT_EQ_INT(sum.value, reference(ab + cd, 32));
+            ASSERT_EQ_INT(diff.value, reference(ab - cd, 32));
+            ASSERT_EQ_INT(fixmath::expr::eval(-(lazy(a) * b)).value,
+                          reference(-ab, 32));
+        }
+    }
+    return 0;
+}
+
+/* Sums align the fraction bits of their operands, and products of
+ * different formats keep all of them.
+ */
+int test_expr_mixed()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            Fix16 a = testcases[i];
+            Fix16 b = testcases[j];
+            Fix16 t = Fix16((int32_t)(testcases[j] & 0xFFFF));
+
+            // a + t (b - a), a lerp with t in [0, 1).
+            Acc   exact = ((Acc)a.value << 16) +
+                        (Acc)t.value * ((Acc)b.value - a.value);
+            Fix16 lerp  = a + t * (lazy(b) - a);
+            ASSERT_EQ_INT(lerp.value, reference(exact, 32));
+
+            Q8_24 q     = Q8_24((int32_t)(testcases[j] >> 4));
+            Fix16 mixed = lazy(q) * a + b;
+            exact = (Acc)q.value * a.value + ((Acc)b.value << 24);
+            ASSERT_EQ_INT(mixed.value, reference(exact, 40));
+        }
+    }
+
+    Q8_24 narrow = lazy(Fix16(1.5)) + Fix16(0.25);
+    ASSERT_EQ_INT(narrow.value, 0x1C00000);
+    narrow = lazy(Fix16((int16_t)200)) + Fix16((int16_t)1);
+    ASSERT_EQ_INT(narrow.value, fix16_maximum);
+    return 0;
+}
+
+#if __cplusplus >= 201402L
+static_assert(Fix16(lazy(Fix16(0.5)) * Fix16(3.0) + Fix16(0.25)).value ==
+                  Fix16(1.75).value,
+              "");
+#endif
+
+int test_expr()
+{
+    TEST(test_expr_dot());
+    TEST(test_expr_mixed());
+    return 0;
+}
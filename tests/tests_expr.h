@@ -0,0 +1,15 @@
+#ifndef TESTS_EXPR_H
+#define TESTS_EXPR_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    int test_expr();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TESTS_EXPR_H
@@ -0,0 +1,300 @@
+#include "tests_fix32.h"
+#include "tests.h"
+#include <libfixmath/fix32.h>
+
+#define ASSERT_EQ_FIX32(a, b)                                                  \
+    do                                                                         \
+    {                                                                          \
+        ASSERT_EQ_INT(int64_hi(a), int64_hi(b));                               \
+        ASSERT_EQ_INT((int)int64_lo(a), (int)int64_lo(b));                     \
+    } while (0)
+
+#define FIX32_VALUES_COUNT (3 * TESTCASES_COUNT)
+
+/* Mixes the fix16_t test cases into fix32_t values of three magnitudes, so
+ * that both words and the carries between them are exercised.
+ */
+static fix32_t fix32_value(unsigned i)
+{
+    fix16_t  t  = testcases[i % TESTCASES_COUNT];
+    uint32_t lo = (uint32_t)t * 2654435761U;
+    switch (i / TESTCASES_COUNT)
+    {
+    case 0:
+        return fix32_from_fix16(t);
+    case 1:
+        return int64_const(t, lo);
+    default:
+        return int64_const(t >> 20, lo);
+    }
+}
+
+int test_fix32_convert()
+{
+    ASSERT_EQ_FIX32(fix32_from_int(-3), int64_const(-3, 0U));
+    ASSERT_EQ_INT(fix32_to_int(fix32_from_dbl(2.25)), 2);
+    ASSERT_EQ_INT(fix32_to_int(fix32_from_dbl(-2.75)), -3);
+#ifndef FIXMATH_NO_ROUNDING
+    ASSERT_EQ_INT(fix32_to_int(fix32_from_dbl(2.5)), 3);
+    ASSERT_EQ_INT(fix32_to_int(fix32_from_dbl(-2.5)), -3);
+#else
+    ASSERT_EQ_INT(fix32_to_int(fix32_from_dbl(2.5)), 2);
+    ASSERT_EQ_INT(fix32_to_int(fix32_from_dbl(-2.25)), -3);
+#endif
+
+    ASSERT_EQ_FIX32(fix32_from_dbl(-1.0 / 4294967296.0), int64_const(-1, ~0U));
+    ASSERT_EQ_FIX32(fix32_from_dbl(3.141592653589793), fix32_pi);
+    ASSERT_NEAR_DOUBLE(fix32_to_dbl(fix32_e), 2.718281828459045, 1e-9, "\n");
+
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        fix16_t t = testcases[i];
+        ASSERT_EQ_INT(fix32_to_fix16(fix32_from_fix16(t)), t);
+        ASSERT_NEAR_DOUBLE(fix32_to_dbl(fix32_from_fix16(t)), fix16_to_dbl(t),
+                           1e-12, "\n");
+    }
+
+    fix32_t half_ulp = int64_const(1, 0x8000U);
+#ifndef FIXMATH_NO_ROUNDING
+    ASSERT_EQ_INT(fix32_to_fix16(half_ulp), fix16_one + 1);
+    ASSERT_EQ_INT(fix32_to_fix16(int64_neg(half_ulp)), -fix16_one - 1);
+#else
+    ASSERT_EQ_INT(fix32_to_fix16(half_ulp), fix16_one);
+    ASSERT_EQ_INT(fix32_to_fix16(int64_neg(half_ulp)), -fix16_one - 1);
+#endif
+#ifndef FIXMATH_NO_OVERFLOW
+    ASSERT_EQ_INT(fix32_to_fix16(fix32_from_int(32768)), fix16_maximum);
+    ASSERT_EQ_INT(fix32_to_fix16(fix32_from_int(-32769)), fix16_minimum);
+    ASSERT_EQ_INT(fix32_to_fix16(fix32_maximum), fix16_maximum);
+    ASSERT_EQ_INT(fix32_to_fix16(fix32_minimum), fix16_minimum);
+#endif
+    return 0;
+}
+
+int test_fix32_special()
+{
+    ASSERT_EQ_FIX32(fix32_div(fix32_one, int64_const(0, 0U)), fix32_minimum);
+    ASSERT_EQ_FIX32(fix32_log(int64_const(0, 0U)), fix32_minimum);
+    ASSERT_EQ_FIX32(fix32_log(int64_neg(fix32_one)), fix32_minimum);
+    ASSERT_EQ_FIX32(fix32_log(fix32_one), int64_const(0, 0U));
+    ASSERT_EQ_FIX32(fix32_exp(int64_const(0, 0U)), fix32_one);
+    ASSERT_EQ_FIX32(fix32_exp(fix32_from_int(22)), fix32_maximum);
+    ASSERT_EQ_FIX32(fix32_exp(fix32_from_int(-23)), int64_const(0, 0U));
+    ASSERT_EQ_FIX32(fix32_sqrt(fix32_from_int(4)), fix32_from_int(2));
+    ASSERT_EQ_FIX32(fix32_sqrt(fix32_from_int(-4)), fix32_from_int(-2));
+    ASSERT_NEAR_DOUBLE(fix32_to_dbl(fix32_sqrt(fix32_minimum)),
+                       -46340.950011841578, 1e-9, "\n");
+    ASSERT_EQ_FIX32(fix32_mul(fix32_minimum, fix32_one), fix32_minimum);
+#ifndef FIXMATH_NO_OVERFLOW
+    ASSERT_EQ_FIX32(fix32_add(fix32_maximum, fix32_eps), fix32_overflow);
+    ASSERT_EQ_FIX32(fix32_sub(fix32_minimum, fix32_eps), fix32_overflow);
+    ASSERT_EQ_FIX32(fix32_mul(fix32_minimum, int64_neg(fix32_one)),
+                    fix32_overflow);
+    ASSERT_EQ_FIX32(fix32_div(fix32_from_int(65536), fix32_from_dbl(1e-5)),
+                    fix32_overflow);
+#endif
+    return 0;
+}
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 fix32_ref_t;
+
+static fix32_ref_t fix32_to_ref(fix32_t x)
+{
+    return (fix32_ref_t)int64_hi(x) * 4294967296LL + int64_lo(x);
+}
+
+/* Converts a reference result to fix32_t, or returns 0 if it overflows. */
+static int fix32_from_ref(fix32_ref_t r, fix32_t* x)
+{
+    if (r > (fix32_ref_t)0x7FFFFFFFFFFFFFFFLL ||
+        r < -(fix32_ref_t)0x7FFFFFFFFFFFFFFFLL - 1)
+        return 0;
+    *x = int64_const((int32_t)(r >> 32), (uint32_t)r);
+    return 1;
+}
+
+/* Rounds the magnitude of n / d like the library does. */
+static fix32_ref_t fix32_ref_div(fix32_ref_t n, fix32_ref_t d)
+{
+    int         neg = ((n < 0) != (d < 0));
+    fix32_ref_t an  = (n < 0) ? -n : n;
+    fix32_ref_t ad  = (d < 0) ? -d : d;
+    fix32_ref_t q   = an / ad;
+#ifndef FIXMATH_NO_ROUNDING
+    if (2 * (an % ad) >= ad)
+        q++;
+#endif
+    return neg ? -q : q;
+}
+
+int test_fix32_pairs()
+{
+    for (unsigned i = 0; i < FIX32_VALUES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < FIX32_VALUES_COUNT; ++j)
+        {
+            fix32_t     a  = fix32_value(i);
+            fix32_t     b  = fix32_value(j);
+            fix32_ref_t ra = fix32_to_ref(a);
+            fix32_ref_t rb = fix32_to_ref(b);
+            fix32_t     expected;
+
+            int         ok = fix32_from_ref(ra + rb, &expected);
+#ifndef FIXMATH_NO_OVERFLOW
+            if (!ok)
+            {
+                expected = fix32_overflow;
+                ok       = 1;
+            }
+#endif
+            if (ok)
+                ASSERT_EQ_FIX32(fix32_add(a, b), expected);
+
+            ok = fix32_from_ref(ra - rb, &expected);
+#ifndef FIXMATH_NO_OVERFLOW
+            if (!ok)
+            {
+                expected = fix32_overflow;
+                ok       = 1;
+            }
+#endif
+            if (ok)
+                ASSERT_EQ_FIX32(fix32_sub(a, b), expected);
+
+            ok = fix32_from_ref(fix32_ref_div(ra * rb, 4294967296LL),
+                                &expected);
+#ifndef FIXMATH_NO_OVERFLOW
+            if (!ok)
+            {
+                expected = fix32_overflow;
+                ok       = 1;
+            }
+#endif
+            if (ok)
+                ASSERT_EQ_FIX32(fix32_mul(a, b), expected);
+
+            if (rb == 0)
+                continue;
+            ok = fix32_from_ref(fix32_ref_div(ra * 4294967296LL, rb),
+                                &expected);
+#ifndef FIXMATH_NO_OVERFLOW
+            if (!ok)
+            {
+                expected = fix32_overflow;
+                ok       = 1;
+            }
+#endif
+            if (ok)
+                ASSERT_EQ_FIX32(fix32_div(a, b), expected);
+        }
+    }
+    return 0;
+}
+
+int test_fix32_sqrt()
+{
+    for (unsigned i = 0; i < FIX32_VALUES_COUNT; ++i)
+    {
+        fix32_t     x = fix32_value(i);
+        fix32_ref_t n = fix32_to_ref(x);
+        int         neg = (n < 0);
+        if (neg)
+            n = -n;
+        n *= 4294967296LL;
+
+        fix32_ref_t r = (fix32_ref_t)sqrt((double)n);
+        while (r * r > n)
+            r--;
+        while ((r + 1) * (r + 1) <= n)
+            r++;
+#ifndef FIXMATH_NO_ROUNDING
+        if (n - r * r > r)
+            r++;
+#endif
+        fix32_t expected;
+        ASSERT_EQ_INT(fix32_from_ref(neg ? -r : r, &expected), 1);
+        ASSERT_EQ_FIX32(fix32_sqrt(x), expected);
+    }
+    return 0;
+}
+#endif
+
+int test_fix32_transcendental()
+{
+    const double eps_trig = 1.0 / 268435456.0; // 2^-28
+    const double eps_exp  = 1.0 / 536870912.0; // 2^-29
+
+    for (double x = -1024.0; x <= 1024.0; x += 0.7853)
+    {
+        fix32_t fx = fix32_from_dbl(x);
+        double  dx = fix32_to_dbl(fx);
+        ASSERT_NEAR_DOUBLE(fix32_to_dbl(fix32_sin(fx)), sin(dx), eps_trig,
+                           "sin(%.12f)\n", dx);
+        ASSERT_NEAR_DOUBLE(fix32_to_dbl(fix32_cos(fx)), cos(dx), eps_trig,
+                           "cos(%.12f)\n", dx);
+    }
+
+    for (double x = -22.8; x < 21.48; x += 0.0137)
+    {
+        fix32_t fx  = fix32_from_dbl(x);
+        double  ref = exp(fix32_to_dbl(fx));
+        double  eps = (ref > 1.0) ? ref * eps_exp : eps_exp;
+        ASSERT_NEAR_DOUBLE(fix32_to_dbl(fix32_exp(fx)), ref, eps,
+                           "exp(%.12f)\n", fix32_to_dbl(fx));
+    }
+
+    for (unsigned i = 0; i < FIX32_VALUES_COUNT; ++i)
+    {
+        fix32_t x = fix32_value(i);
+        if (int64_hi(x) < 0)
+            x = int64_neg(x);
+        if (int64_cmp_eq(x, int64_const(0, 0U)))
+            continue;
+        ASSERT_NEAR_DOUBLE(fix32_to_dbl(fix32_log(x)), log(fix32_to_dbl(x)),
+                           eps_exp, "log(%.12f)\n", fix32_to_dbl(x));
+    }
+    return 0;
+}
+
+int test_fix32_array()
+{
+    fix32_t a[4] = {fix32_one, fix32_pi, fix32_from_int(-7), fix32_e};
+    fix32_t b[4] = {fix32_e, fix32_from_int(3), fix32_eps, fix32_one};
+    fix32_t dst[4];
+    fix16_t f[4];
+
+    fix32_add_array(dst, a, b, 4);
+    for (unsigned i = 0; i < 4; ++i)
+        ASSERT_EQ_FIX32(dst[i], fix32_add(a[i], b[i]));
+    fix32_sub_array(dst, a, b, 4);
+    for (unsigned i = 0; i < 4; ++i)
+        ASSERT_EQ_FIX32(dst[i], fix32_sub(a[i], b[i]));
+    fix32_mul_array(dst, a, b, 4);
+    for (unsigned i = 0; i < 4; ++i)
+        ASSERT_EQ_FIX32(dst[i], fix32_mul(a[i], b[i]));
+    fix32_div_array(dst, a, b, 4);
+    for (unsigned i = 0; i < 4; ++i)
+        ASSERT_EQ_FIX32(dst[i], fix32_div(a[i], b[i]));
+
+    fix32_to_fix16_array(f, a, 4);
+    for (unsigned i = 0; i < 4; ++i)
+        ASSERT_EQ_INT(f[i], fix32_to_fix16(a[i]));
+    fix32_from_fix16_array(dst, f, 4);
+    for (unsigned i = 0; i < 4; ++i)
+        ASSERT_EQ_FIX32(dst[i], fix32_from_fix16(f[i]));
+    return 0;
+}
+
+int test_fix32()
+{
+    TEST(test_fix32_convert());
+    TEST(test_fix32_special());
+#ifdef __SIZEOF_INT128__
+    TEST(test_fix32_pairs());
+    TEST(test_fix32_sqrt());
+#endif
+    TEST(test_fix32_transcendental());
+    TEST(test_fix32_array());
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef TESTS_FIX32_H
+#define TESTS_FIX32_H
+
+int test_fix32();
+
+#endif // TESTS_FIX32_H
@@ -0,0 +1,299 @@
+#include "tests_fixed.h"
+#include "tests.h"
+#include <libfixmath/fix16.hpp>
+
+using fixmath::Fixed;
+using fixmath::Overflow;
+using fixmath::Policy;
+using fixmath::Rounding;
+
+typedef Fixed<8, 24>  Q8_24;
+typedef Fixed<24, 8>  Q24_8;
+typedef Policy<fixmath::default_rounding, Overflow::Saturate> Saturate;
+
+/* Rounding error allowed by the policy, in units of the last place. */
+static const double ulps =
+    (fixmath::default_rounding == Rounding::Nearest) ? 0.5 : 1.0;
+
+/* Fix16 still forwards to the C functions. */
+int test_fixed_fix16()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            Fix16 a = testcases[i];
+            Fix16 b = testcases[j];
+            ASSERT_EQ_INT((a + b).value, fix16_add(a.value, b.value));
+            ASSERT_EQ_INT((a - b).value, fix16_sub(a.value, b.value));
+            ASSERT_EQ_INT((a * b).value, fix16_mul(a.value, b.value));
+            ASSERT_EQ_INT((a / b).value, fix16_div(a.value, b.value));
+#ifndef FIXMATH_NO_OVERFLOW
+            ASSERT_EQ_INT(a.sadd(b).value, fix16_sadd(a.value, b.value));
+            ASSERT_EQ_INT(a.smul(b).value, fix16_smul(a.value, b.value));
+            ASSERT_EQ_INT(a.sdiv(b).value, fix16_sdiv(a.value, b.value));
+#endif
+        }
+        ASSERT_EQ_INT((int)(int16_t)Fix16(testcases[i]),
+                      (int)(int16_t)fix16_to_int(testcases[i]));
+    }
+
+    ASSERT_EQ_INT(Fix16(2.5).value, fix16_from_dbl(2.5));
+    ASSERT_EQ_INT(Fix16((int16_t)-3).value, fix16_from_int(-3));
+    ASSERT_EQ_INT(Fix16(fix16_pi).sin().value, fix16_sin(fix16_pi));
+    return 0;
+}
+
+/* The generic kernels agree with the C functions on Q16.16 wherever the
+ * result is in range, except where the C function rounds differently: the
+ * 8-bit fix16_mul truncates toward zero with FIXMATH_NO_ROUNDING, the
+ * fix16_div for hardware division can be one off with FIXMATH_NO_ROUNDING,
+ * and FIXMATH_FAST_DIV is not exact.
+ */
+int test_fixed_generic()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            fix16_t a = testcases[i];
+            fix16_t b = testcases[j];
+#if !defined(FIXMATH_OPTIMIZE_8BIT) || !defined(FIXMATH_NO_ROUNDING)
+            double product = fix16_to_dbl(a) * fix16_to_dbl(b);
+            if (fabs(product) < 32767.0)
+            {
+                ASSERT_EQ_INT((fixmath::detail::mul<16, Saturate>(a, b)),
+                              fix16_mul(a, b));
+            }
+#endif
+#if !defined(FIXMATH_FAST_DIV) &&                                             \
+    (defined(FIXMATH_NO_HARD_DIVISION) || !defined(FIXMATH_NO_ROUNDING))
+            if (b != 0 && fabs(fix16_to_dbl(a) / fix16_to_dbl(b)) < 32767.0)
+            {
+                ASSERT_EQ_INT((fixmath::detail::div<16, Saturate>(a, b)),
+                              fix16_div(a, b));
+            }
+#endif
+        }
+    }
+    return 0;
+}
+
+template <class T> static double to_dbl(T x)
+{
+    return (double)x.value / (double)(1ULL << T::frac_bits);
+}
+
+/* Q8.24 and Q24.8 arithmetic against doubles, saturating out of range. */
+template <class T> static int test_fixed_format()
+{
+    typedef Fixed<T::int_bits, T::frac_bits, Saturate> S;
+
+    const double eps = 1.0 / (double)(1ULL << T::frac_bits);
+    const double max = to_dbl(S(fix16_maximum));
+    const double min = to_dbl(S(fix16_minimum));
+
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            S      a = testcases[i];
+            S      b = testcases[j];
+            double x = to_dbl(a);
+            double y = to_dbl(b);
+
+            double sum = x + y;
+            if (sum > max)
+                ASSERT_EQ_INT((a + b).value, fix16_maximum);
+            else if (sum < min)
+                ASSERT_EQ_INT((a + b).value, fix16_minimum);
+            else
+                ASSERT_NEAR_DOUBLE(to_dbl(a + b), sum, eps / 2, "\n");
+
+            double product = x * y;
+            if (product > max + eps)
+                ASSERT_EQ_INT((a * b).value, fix16_maximum);
+            else if (product < min - eps)
+                ASSERT_EQ_INT((a * b).value, fix16_minimum);
+            else if (product < max - eps && product > min + eps)
+                ASSERT_NEAR_DOUBLE(to_dbl(a * b), product, eps * ulps * 1.01,
+                                   "%f * %f\n", x, y);
+
+            if (b.value == 0)
+                continue;
+            double quotient = x / y;
+            if (quotient > max + eps)
+                ASSERT_EQ_INT((a / b).value, fix16_maximum);
+            else if (quotient < min - eps)
+                ASSERT_EQ_INT((a / b).value, fix16_minimum);
+            else if (quotient < max - eps && quotient > min + eps)
+                ASSERT_NEAR_DOUBLE(to_dbl(a / b), quotient, eps * ulps * 1.01,
+                                   "%f / %f\n", x, y);
+        }
+    }
+    return 0;
+}
+
+int test_fixed_formats()
+{
+    TEST(test_fixed_format<Q8_24>());
+    TEST(test_fixed_format<Q24_8>());
+#ifndef FIXMATH_FAST_DIV
+    // Saturating Q16.16 uses fix16_sdiv, which is approximate here.
+    TEST(test_fixed_format<Fix16>());
+#endif
+    return 0;
+}
+
+/* Conversions between formats and mixed-format multiplies and divides. */
+int test_fixed_mixed()
+{
+    typedef Fixed<8, 24, Saturate>  S8_24;
+    typedef Fixed<24, 8, Saturate>  S24_8;
+    typedef Fixed<16, 16, Saturate> S16_16;
+
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        Fix16 a = testcases[i];
+        if (a.value > -0x800000 && a.value < 0x800000)
+            ASSERT_EQ_INT(Fix16(Q8_24(a)).value, a.value);
+        ASSERT_EQ_INT(Fix16(Q24_8(a)).value & 0xFF, 0);
+        ASSERT_NEAR_DOUBLE(to_dbl(Q24_8(a)), to_dbl(a), ulps / 256.0, "\n");
+
+        double x = to_dbl(a);
+        S8_24  s(a);
+        if (x >= 128.0)
+            ASSERT_EQ_INT(s.value, fix16_maximum);
+        else if (x < -128.0)
+            ASSERT_EQ_INT(s.value, fix16_minimum);
+
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            S8_24  p(Fix16(testcases[j]));
+            S24_8  q(Fix16(testcases[i]));
+            double y       = to_dbl(p);
+            double z       = to_dbl(q);
+            double product = y * z;
+            S16_16 r       = fixmath::mul<S16_16>(p, q);
+            if (fabs(product) < 32767.0)
+                ASSERT_NEAR_DOUBLE(to_dbl(r), product,
+                                   ulps * 1.01 / 65536.0, "%f * %f\n", y, z);
+            else if (fabs(product) > 32768.0)
+                ASSERT_EQ_INT(r.value, product > 0 ? fix16_maximum
+                                                   : fix16_minimum);
+
+            if (q.value == 0)
+                continue;
+            double quotient = y / z;
+            S8_24  d        = fixmath::div<S8_24>(p, q);
+            if (fabs(quotient) < 127.0)
+                ASSERT_NEAR_DOUBLE(to_dbl(d), quotient,
+                                   ulps * 1.01 / 16777216.0, "%f / %f\n", y,
+                                   z);
+        }
+    }
+    return 0;
+}
+
+#if __cplusplus >= 201402L
+/* Construction, conversion and the generic kernels are constexpr. */
+static_assert(Fix16(1.5).value == 0x18000, "");
+static_assert(Fix16((int16_t)-3).value == -0x30000, "");
+static_assert(Fix16((int16_t)3) > Fix16(2.5), "");
+static_assert(Fix16(Q8_24(0.25)).value == 0x4000, "");
+static_assert((Q8_24(0.5) * Q8_24(0.25)).value == Q8_24(0.125).value, "");
+static_assert((Q24_8(3.0) / Q24_8(-4.0)).value == Q24_8(-0.75).value, "");
+#endif
+
+#ifdef FIXMATH_CONSTEXPR_FIX16
+static constexpr fix16_t constexpr_inputs[] = {
+    F16(0.5), F16(-0.25),  1,        -1,          F16(1),   F16(-1),
+    F16(3.14159), F16(2.5), F16(-3.7), F16(10), F16(-42.125), F16(100),
+    F16(-170.5),
+};
+static const unsigned constexpr_count =
+    sizeof(constexpr_inputs) / sizeof(constexpr_inputs[0]);
+
+/* Fix16 results for each input x and the next one y, in the order of the
+ * checks in test_fixed_constexpr().
+ */
+struct ConstexprTable
+{
+    int32_t value[constexpr_count][14];
+
+    constexpr ConstexprTable() : value()
+    {
+        for (unsigned i = 0; i < constexpr_count; ++i)
+        {
+            Fix16 x = constexpr_inputs[i];
+            Fix16 y = constexpr_inputs[(i + 1) % constexpr_count];
+            value[i][0]  = (x + y).value;
+            value[i][1]  = (x - y).value;
+            value[i][2]  = x.sqrt().value;
+            value[i][3]  = (x * y).value;
+            value[i][4]  = x.sin().value;
+            value[i][5]  = x.cos().value;
+            value[i][6]  = (x / y).value;
+            value[i][7]  = x.tan().value;
+            value[i][8]  = x.atan().value;
+            value[i][9]  = x.atan2(y).value;
+            value[i][10] = x.asin().value;
+            value[i][11] = x.acos().value;
+            value[i][12] = x.exp().value;
+            value[i][13] = x.log().value;
+        }
+    }
+};
+
+/* A table built by the compiler matches the C functions wherever those are
+ * exact, see test_fixed_generic().
+ */
+int test_fixed_constexpr()
+{
+    static constexpr ConstexprTable table;
+
+    for (unsigned i = 0; i < constexpr_count; ++i)
+    {
+        fix16_t        x = constexpr_inputs[i];
+        fix16_t        y = constexpr_inputs[(i + 1) % constexpr_count];
+        const int32_t* v = table.value[i];
+        ASSERT_EQ_INT(v[0], fix16_add(x, y));
+        ASSERT_EQ_INT(v[1], fix16_sub(x, y));
+        ASSERT_EQ_INT(v[2], fix16_sqrt(x));
+#if !defined(FIXMATH_OPTIMIZE_8BIT) || !defined(FIXMATH_NO_ROUNDING)
+        ASSERT_EQ_INT(v[3], fix16_mul(x, y));
+// The constant version has only the small table.
+#if !defined(FIXMATH_SIN_LUT) || defined(FIXMATH_SIN_LUT_BITS)
+        ASSERT_EQ_INT(v[4], fix16_sin(x));
+        ASSERT_EQ_INT(v[5], fix16_cos(x));
+#endif
+#if !defined(FIXMATH_FAST_DIV) &&                                             \
+    (defined(FIXMATH_NO_HARD_DIVISION) || !defined(FIXMATH_NO_ROUNDING))
+        ASSERT_EQ_INT(v[6], fix16_div(x, y));
+#if !defined(FIXMATH_SIN_LUT) || defined(FIXMATH_SIN_LUT_BITS)
+        ASSERT_EQ_INT(v[7], fix16_tan(x));
+#endif
+        ASSERT_EQ_INT(v[8], fix16_atan(x));
+        ASSERT_EQ_INT(v[9], fix16_atan2(x, y));
+        ASSERT_EQ_INT(v[10], fix16_asin(x));
+        ASSERT_EQ_INT(v[11], fix16_acos(x));
+        ASSERT_EQ_INT(v[12], fix16_exp(x));
+        ASSERT_EQ_INT(v[13], fix16_log(x));
+#endif
+#endif
+    }
+    return 0;
+}
+#endif
+
+int test_fixed()
+{
+    TEST(test_fixed_fix16());
+    TEST(test_fixed_generic());
+    TEST(test_fixed_formats());
+    TEST(test_fixed_mixed());
+#ifdef FIXMATH_CONSTEXPR_FIX16
+    TEST(test_fixed_constexpr());
+#endif
+    return 0;
+}
@@ -0,0 +1,15 @@
+#ifndef TESTS_FIXED_H
+#define TESTS_FIXED_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    int test_fixed();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TESTS_FIXED_H
@@ -0,0 +1,114 @@
+#include "tests_pack.h"
+#include "tests.h"
+#include <libfixmath/fix16.hpp>
+
+/* Every operator of Fix16xN<N> against Fix16 in each lane, for all pairs of
+ * testcases. The lanes get different pairs so that the even and the odd
+ * lanes of the SIMD multiplication are both covered.
+ */
+template <int N> static int test_pack_ops()
+{
+    typedef fixmath::Fix16xN<N> Pack;
+
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            fix16_t a[N];
+            fix16_t b[N];
+            for (int k = 0; k < N; ++k)
+            {
+                a[k] = testcases[(i + k) % TESTCASES_COUNT];
+                b[k] = testcases[(j + 7 * k) % TESTCASES_COUNT];
+            }
+
+            Pack pa = Pack::load(a);
+            Pack pb = Pack::load(b);
+            Pack lo = fixmath::min(pa, pb);
+            Pack hi = fixmath::max(pa, pb);
+
+            fix16_t sum[N], diff[N], product[N], quotient[N], negated[N];
+            fix16_t ssum[N], sdiff[N], sproduct[N], squotient[N];
+            fix16_t absolute[N], clamped[N], selected[N];
+            (pa + pb).store(sum);
+            (pa - pb).store(diff);
+            (pa * pb).store(product);
+            (pa / pb).store(quotient);
+            (-pa).store(negated);
+            pa.sadd(pb).store(ssum);
+            pa.ssub(pb).store(sdiff);
+            pa.smul(pb).store(sproduct);
+            pa.sdiv(pb).store(squotient);
+            fixmath::abs(pa).store(absolute);
+            fixmath::clamp(Pack(Fix16(0.5)), lo, hi).store(clamped);
+            fixmath::select(pa < pb, pa * pb, pa + pb).store(selected);
+
+            int lt = (pa < pb).bits(), le = (pa <= pb).bits();
+            int gt = (pa > pb).bits(), ge = (pa >= pb).bits();
+            int eq = (pa == pb).bits(), ne = (pa != pb).bits();
+
+            for (int k = 0; k < N; ++k)
+            {
+                Fix16 x = a[k];
+                Fix16 y = b[k];
+                ASSERT_EQ_INT(sum[k], (x + y).value);
+                ASSERT_EQ_INT(diff[k], (x - y).value);
+                ASSERT_EQ_INT(product[k], (x * y).value);
+                ASSERT_EQ_INT(quotient[k], (x / y).value);
+                ASSERT_EQ_INT(negated[k], (fix16_t)(0U - (uint32_t)a[k]));
+                ASSERT_EQ_INT(ssum[k], x.sadd(y).value);
+                ASSERT_EQ_INT(sdiff[k], x.ssub(y).value);
+                ASSERT_EQ_INT(sproduct[k], x.smul(y).value);
+                ASSERT_EQ_INT(squotient[k], x.sdiv(y).value);
+                ASSERT_EQ_INT(absolute[k], fix16_abs(a[k]));
+                ASSERT_EQ_INT(clamped[k],
+                              fix16_clamp(F16(0.5), fix16_min(a[k], b[k]),
+                                          fix16_max(a[k], b[k])));
+                ASSERT_EQ_INT(selected[k],
+                              (x < y ? x * y : x + y).value);
+                ASSERT_EQ_INT(pa[k].value, a[k]);
+
+                ASSERT_EQ_INT((lt >> k) & 1, x < y);
+                ASSERT_EQ_INT((le >> k) & 1, x <= y);
+                ASSERT_EQ_INT((gt >> k) & 1, x > y);
+                ASSERT_EQ_INT((ge >> k) & 1, x >= y);
+                ASSERT_EQ_INT((eq >> k) & 1, x == y);
+                ASSERT_EQ_INT((ne >> k) & 1, x != y);
+            }
+        }
+    }
+    return 0;
+}
+
+/* Broadcasts, masks and the compound assignments. */
+static int test_pack_misc()
+{
+    Fix16x8 x = Fix16(1.5);
+    x *= Fix16x8(Fix16(2.0));
+    x += Fix16(0.25);
+    x -= Fix16(1.0);
+    x /= Fix16(0.5);
+    for (int k = 0; k < 8; ++k)
+        ASSERT_EQ_INT(x[k].value, F16(4.5));
+
+    fix16_t v[4] = {F16(-1), 0, F16(1), F16(2)};
+    Fix16x4 p    = Fix16x4::load(v);
+    ASSERT_EQ_INT((p > Fix16(0.0)).bits(), 0xC);
+    ASSERT_EQ_INT((~(p > Fix16(0.0))).bits(), 0x3);
+    ASSERT_EQ_INT(((p > Fix16(0.0)) | (p < Fix16(0.0))).bits(), 0xD);
+    ASSERT_EQ_INT(((p >= Fix16(0.0)) & (p <= Fix16(1.0))).bits(), 0x6);
+    ASSERT_EQ_INT(((p >= Fix16(0.0)) ^ (p <= Fix16(1.0))).bits(), 0x9);
+    ASSERT_EQ_INT((p == p).all(), 1);
+    ASSERT_EQ_INT((p != p).any(), 0);
+    ASSERT_EQ_INT((p == Fix16(1.0)).any(), 1);
+    ASSERT_EQ_INT((p == Fix16(1.0)).all(), 0);
+    return 0;
+}
+
+int test_pack()
+{
+    TEST(test_pack_ops<4>());
+    TEST(test_pack_ops<8>());
+    TEST(test_pack_misc());
+    return 0;
+}
@@ -0,0 +1,15 @@
+#ifndef TESTS_PACK_H
+#define TESTS_PACK_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    int test_pack();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TESTS_PACK_H
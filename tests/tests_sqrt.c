@@ -1,5 +1,6 @@
 #include "tests_sqrt.h"
 #include "tests.h"
+#include <libfixmath/fix16_array.h>
 
 int test_sqrt_specific()
 {
@@ -29,9 +30,268 @@ int test_sqrt_short()
     return 0;
 }
 
+/* The bit-by-bit algorithm fix16_sqrt() replaced, which defines its
+ * results.
+ */
+static fix16_t test_sqrt_reference(fix16_t inValue)
+{
+    uint32_t num    = fix_abs(inValue);
+    uint32_t result = 0;
+    uint32_t bit    = ((num & 0xFFF00000U) != 0U) ? (1U << 30) : (1U << 18);
+    while (bit > num)
+        bit >>= 2;
+    for (int n = 0; n < 2; n++)
+    {
+        while (bit != 0U)
+        {
+            if (num >= result + bit)
+            {
+                num -= result + bit;
+                result = (result >> 1) + bit;
+            }
+            else
+            {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        if (n == 0)
+        {
+            if (num > 65535U)
+            {
+                num    = ((num - result) << 16) - 0x8000U;
+                result = (result << 16) + 0x8000U;
+            }
+            else
+            {
+                num <<= 16;
+                result <<= 16;
+            }
+            bit = 1U << 14;
+        }
+    }
+#ifndef FIXMATH_NO_ROUNDING
+    if (num > result)
+        result++;
+#endif
+    return ((inValue < 0) ? -(fix16_t)result : (fix16_t)result);
+}
+
+int test_sqrt_reference_match()
+{
+    for (uint32_t u = 0; u < 0xFFFFFFFFU - 9999; u += 997)
+        ASSERT_EQ_INT(fix16_sqrt((fix16_t)u), test_sqrt_reference((fix16_t)u));
+    for (fix16_t x = 0; x < 0x40000; ++x)
+        ASSERT_EQ_INT(fix16_sqrt(x), test_sqrt_reference(x));
+    for (fix16_t x = fix16_maximum; x > fix16_maximum - 0x10000; --x)
+        ASSERT_EQ_INT(fix16_sqrt(x), test_sqrt_reference(x));
+    ASSERT_EQ_INT(fix16_sqrt(fix16_minimum),
+                  test_sqrt_reference(fix16_minimum));
+    return 0;
+}
+
+/* fix16_rsqrt against 2^24 / sqrt(x), rounded or truncated. */
+int test_rsqrt()
+{
+    for (uint32_t u = 1; u < 0x80000000U; u += (u >> 10) + 1U)
+    {
+        fix16_t x   = (fix16_t)u;
+        double  ref = 16777216.0 / sqrt((double)u);
+#ifndef FIXMATH_NO_ROUNDING
+        ref = floor(ref + 0.5);
+#else
+        ref = floor(ref);
+#endif
+        ASSERT_EQ_INT(fix16_rsqrt(x), (fix16_t)ref);
+        ASSERT_EQ_INT(fix16_rsqrt(-x), -(fix16_t)ref);
+    }
+    ASSERT_EQ_INT(fix16_rsqrt(fix16_one), fix16_one);
+    ASSERT_EQ_INT(fix16_rsqrt(fix16_from_int(4)), fix16_one / 2);
+    ASSERT_EQ_INT(fix16_rsqrt(1), fix16_from_int(256));
+    ASSERT_EQ_INT(fix16_rsqrt(0), fix16_overflow);
+    return 0;
+}
+
+/* The components within 1/2 LSB plus 2^-9, less than 1 LSB with
+ * FIXMATH_NO_ROUNDING, of the unit vector, and the length as rounded by
+ * fix16_sqrt(). Compared in fix16_t units.
+ */
+int test_normalize()
+{
+#ifndef FIXMATH_NO_ROUNDING
+    const double eps = (0.5 + 1.0 / 512) / fix16_one;
+#else
+    const double eps = 1.0 / fix16_one;
+#endif
+    const double max  = fix16_to_dbl(fix16_maximum);
+    uint32_t     seed = 1U;
+    for (int i = 0; i < 100000; ++i)
+    {
+        fix16_t v[3];
+        for (int k = 0; k < 3; ++k)
+        {
+            seed = seed * 1664525U + 1013904223U;
+            v[k] = (fix16_t)seed >> (seed & 31U);
+        }
+        if ((v[0] | v[1] | v[2]) == 0)
+            continue;
+
+        double  x = fix16_to_dbl(v[0]);
+        double  y = fix16_to_dbl(v[1]);
+        double  z = fix16_to_dbl(v[2]);
+        double  l = sqrt(x * x + y * y + z * z);
+        fix16_t n[3] = {v[0], v[1], v[2]};
+        fix16_t length = fix16_normalize3(&n[0], &n[1], &n[2]);
+        ASSERT_NEAR_DOUBLE((l > max) ? max : l, fix16_to_dbl(length), eps,
+                           "length %i %i %i", v[0], v[1], v[2]);
+        ASSERT_NEAR_DOUBLE(x / l, fix16_to_dbl(n[0]), eps, "x %i", v[0]);
+        ASSERT_NEAR_DOUBLE(y / l, fix16_to_dbl(n[1]), eps, "y %i", v[1]);
+        ASSERT_NEAR_DOUBLE(z / l, fix16_to_dbl(n[2]), eps, "z %i", v[2]);
+
+        l      = sqrt(x * x + y * y);
+        n[0]   = v[0];
+        n[1]   = v[1];
+        length = fix16_normalize2(&n[0], &n[1]);
+        if (l == 0.0)
+            continue;
+        ASSERT_NEAR_DOUBLE((l > max) ? max : l, fix16_to_dbl(length), eps,
+                           "length %i %i", v[0], v[1]);
+        ASSERT_NEAR_DOUBLE(x / l, fix16_to_dbl(n[0]), eps, "x %i", v[0]);
+        ASSERT_NEAR_DOUBLE(y / l, fix16_to_dbl(n[1]), eps, "y %i", v[1]);
+    }
+    return 0;
+}
+
+int test_normalize_limits()
+{
+    fix16_t x = 0, y = 0, z = 0;
+    ASSERT_EQ_INT(fix16_normalize3(&x, &y, &z), 0);
+    ASSERT_EQ_INT(x | y | z, 0);
+
+    x = fix16_from_int(3);
+    y = fix16_from_int(-4);
+    ASSERT_EQ_INT(fix16_normalize2(&x, &y), fix16_from_int(5));
+#ifndef FIXMATH_NO_ROUNDING
+    ASSERT_EQ_INT(x, 39322);
+    ASSERT_EQ_INT(y, -52429);
+#else
+    ASSERT_EQ_INT(x, 39321);
+    ASSERT_EQ_INT(y, -52428);
+#endif
+
+    x = 1;
+    y = 0;
+    z = 0;
+    ASSERT_EQ_INT(fix16_normalize3(&x, &y, &z), 1);
+    ASSERT_EQ_INT(x, fix16_one);
+
+    x = fix16_minimum;
+    y = fix16_minimum;
+    z = fix16_minimum;
+    ASSERT_EQ_INT(fix16_normalize3(&x, &y, &z), fix16_maximum);
+    ASSERT_EQ_INT(x, -37837);
+    ASSERT_EQ_INT(z, -37837);
+    return 0;
+}
+
+int test_sqrt_batch()
+{
+    fix16_t in[37];
+    fix16_t out[37];
+    fix16_t x[37], y[37], z[37];
+    for (int i = 0; i < 37; ++i)
+        in[i] = fix16_from_int(i - 18) * 99 + i;
+    for (int i = 0; i < 37; ++i)
+    {
+        x[i] = in[i];
+        y[i] = in[36 - i];
+        z[i] = i * 1000;
+    }
+
+    fix16_rsqrt_array(out, in, 37);
+    for (int i = 0; i < 37; ++i)
+        ASSERT_EQ_INT(out[i], fix16_rsqrt(in[i]));
+
+    fix16_normalize3_array(x, y, z, 37);
+    for (int i = 0; i < 37; ++i)
+    {
+        fix16_t a = in[i], b = in[36 - i], c = i * 1000;
+        fix16_normalize3(&a, &b, &c);
+        ASSERT_EQ_INT(x[i], a);
+        ASSERT_EQ_INT(y[i], b);
+        ASSERT_EQ_INT(z[i], c);
+    }
+
+    for (int i = 0; i < 37; ++i)
+    {
+        x[i] = in[i];
+        y[i] = in[36 - i];
+    }
+    fix16_normalize2_array(x, y, 37);
+    for (int i = 0; i < 37; ++i)
+    {
+        fix16_t a = in[i], b = in[36 - i];
+        fix16_normalize2(&a, &b);
+        ASSERT_EQ_INT(x[i], a);
+        ASSERT_EQ_INT(y[i], b);
+    }
+    return 0;
+}
+
+/* fix16_sqrt_array against fix16_sqrt at every SIMD level, over lengths
+ * that end in a partial block.
+ */
+int test_sqrt_array_level(fix16_simd_e level)
+{
+    printf("%*s simd: %s\n", stack_depth, "", fix16_simd_name(level));
+    fix16_simd_force(level);
+
+    static fix16_t in[1027];
+    static fix16_t out[1027];
+    uint32_t       seed = 7U;
+    for (int i = 0; i < 1027; ++i)
+    {
+        seed  = seed * 1664525U + 1013904223U;
+        in[i] = (fix16_t)seed >> (seed & 31U);
+    }
+    in[0] = 0;
+    in[1] = fix16_minimum;
+    in[2] = fix16_maximum;
+    in[3] = -1;
+
+    for (uint32_t u = 0; u < 0xFFFFFFFFU - 1027U * 4099U; u += 1027U * 4099U)
+    {
+        for (int i = 4; i < 1027; ++i)
+            in[i] = (fix16_t)(u + (uint32_t)i * 4099U);
+        fix16_sqrt_array(out, in, 1027);
+        for (int i = 0; i < 1027; ++i)
+            ASSERT_EQ_INT(out[i], fix16_sqrt(in[i]));
+    }
+
+    fix16_sqrt_array(in, in, 13);
+    for (int i = 0; i < 13; ++i)
+        ASSERT_EQ_INT(in[i], out[i]);
+    return 0;
+}
+
+int test_sqrt_array()
+{
+    fix16_simd_e initial = fix16_simd_level();
+    for (unsigned l = 0; l <= (unsigned)fix16_simd_supported(); ++l)
+        TEST(test_sqrt_array_level((fix16_simd_e)l));
+    fix16_simd_force(initial);
+    return 0;
+}
+
 int test_sqrt()
 {
     TEST(test_sqrt_specific());
     TEST(test_sqrt_short());
+    TEST(test_sqrt_reference_match());
+    TEST(test_rsqrt());
+    TEST(test_normalize());
+    TEST(test_normalize_limits());
+    TEST(test_sqrt_batch());
+    TEST(test_sqrt_array());
     return 0;
 }
@@ -0,0 +1,142 @@
+#include "tests_sticky.h"
+#include "tests.h"
+#include <libfixmath/fix16_array.h>
+
+#ifdef FIXMATH_STICKY_OVERFLOW
+
+int test_sticky_flag()
+{
+    fix16_overflow_clear();
+    ASSERT_EQ_INT(fix16_overflow_status(), 0);
+
+    // In range results, including fix16_minimum itself, leave it clear.
+    ASSERT_EQ_INT(fix16_add(fix16_one, fix16_one), 2 * fix16_one);
+    ASSERT_EQ_INT(fix16_add(fix16_minimum, 0), fix16_minimum);
+    ASSERT_EQ_INT(fix16_sub(-1, fix16_maximum), fix16_minimum);
+#ifndef FIXMATH_OPTIMIZE_8BIT
+    // The 8-bit fix16_mul treats a magnitude of 2^31 as overflow.
+    ASSERT_EQ_INT(fix16_mul(fix16_from_int(-256), fix16_from_int(128)),
+                  fix16_minimum);
+#endif
+    ASSERT_EQ_INT(fix16_div(fix16_one, fix16_from_int(4)), fix16_one / 4);
+    ASSERT_EQ_INT(fix16_overflow_status(), 0);
+
+    ASSERT_EQ_INT(fix16_add(fix16_maximum, 1), fix16_overflow);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+
+    // The flag stays set until it is cleared.
+    ASSERT_EQ_INT(fix16_add(1, 1), 2);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+    fix16_overflow_clear();
+    ASSERT_EQ_INT(fix16_overflow_status(), 0);
+
+    ASSERT_EQ_INT(fix16_sub(fix16_minimum, 1), fix16_overflow);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+    fix16_overflow_clear();
+
+    ASSERT_EQ_INT(fix16_mul(fix16_maximum, fix16_from_int(2)), fix16_overflow);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+    fix16_overflow_clear();
+
+    ASSERT_EQ_INT(fix16_div(fix16_maximum, fix16_one / 2), fix16_overflow);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+    fix16_overflow_clear();
+
+    ASSERT_EQ_INT(fix16_div(fix16_one, 0), fix16_minimum);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+    fix16_overflow_clear();
+    return 0;
+}
+
+int test_sticky_saturate()
+{
+    fix16_overflow_clear();
+    ASSERT_EQ_INT(fix16_sadd(0, fix16_minimum), fix16_minimum);
+    ASSERT_EQ_INT(fix16_ssub(fix16_minimum, 0), fix16_minimum);
+    ASSERT_EQ_INT(fix16_overflow_status(), 0);
+
+    ASSERT_EQ_INT(fix16_sadd(fix16_maximum, 1), fix16_maximum);
+    ASSERT_EQ_INT(fix16_sadd(fix16_minimum, -1), fix16_minimum);
+    ASSERT_EQ_INT(fix16_ssub(fix16_maximum, -1), fix16_maximum);
+    ASSERT_EQ_INT(fix16_ssub(fix16_minimum, 1), fix16_minimum);
+    ASSERT_EQ_INT(fix16_smul(fix16_maximum, fix16_maximum), fix16_maximum);
+    ASSERT_EQ_INT(fix16_smul(fix16_maximum, -fix16_maximum), fix16_minimum);
+    ASSERT_EQ_INT(fix16_smul(fix16_minimum, fix16_minimum), fix16_maximum);
+    ASSERT_EQ_INT(fix16_sdiv(-fix16_maximum, fix16_one / 2), fix16_minimum);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+    fix16_overflow_clear();
+    return 0;
+}
+
+/* Each operation sets the flag exactly when its exact result does not fit. */
+int test_sticky_pairs()
+{
+    for (unsigned i = 0; i < TESTCASES_COUNT; ++i)
+    {
+        for (unsigned j = 0; j < TESTCASES_COUNT; ++j)
+        {
+            fix16_t a   = testcases[i];
+            fix16_t b   = testcases[j];
+            double  max = fix16_to_dbl(fix16_maximum);
+            double  min = fix16_to_dbl(fix16_minimum);
+
+            fix16_overflow_clear();
+            double sum = fix16_to_dbl(a) + fix16_to_dbl(b);
+            fix16_add(a, b);
+            ASSERT_EQ_INT(fix16_overflow_status(), (sum > max || sum < min));
+
+            fix16_overflow_clear();
+            double diff = fix16_to_dbl(a) - fix16_to_dbl(b);
+            fix16_sub(a, b);
+            ASSERT_EQ_INT(fix16_overflow_status(),
+                          (diff > max || diff < min));
+
+            // Leave out products within rounding distance of the limits.
+            double product = fix16_to_dbl(a) * fix16_to_dbl(b);
+            if (fabs(product) < 32767.0 || fabs(product) > 32769.0)
+            {
+                fix16_overflow_clear();
+                fix16_mul(a, b);
+                ASSERT_EQ_INT(fix16_overflow_status(),
+                              (fabs(product) > 32769.0));
+            }
+        }
+    }
+    fix16_overflow_clear();
+    return 0;
+}
+
+int test_sticky_array()
+{
+    fix16_t a[5] = {fix16_one, -fix16_one, fix16_maximum, 0, fix16_minimum};
+    fix16_t b[5] = {fix16_one, fix16_one, fix16_one, fix16_minimum, 0};
+    fix16_t dst[5];
+
+    fix16_overflow_clear();
+    fix16_add_array(dst, a, b, 2);
+    ASSERT_EQ_INT(fix16_overflow_status(), 0);
+    fix16_add_array(dst, a, b, 5);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+    ASSERT_EQ_INT(dst[2], fix16_overflow);
+
+    fix16_overflow_clear();
+    fix16_sadd_array(dst, a, b, 5);
+    ASSERT_EQ_INT(dst[2], fix16_maximum);
+    ASSERT_EQ_INT(dst[3], fix16_minimum);
+    ASSERT_EQ_INT(fix16_overflow_status(), 1);
+    fix16_overflow_clear();
+    return 0;
+}
+
+#endif
+
+int test_sticky()
+{
+#ifdef FIXMATH_STICKY_OVERFLOW
+    TEST(test_sticky_flag());
+    TEST(test_sticky_saturate());
+    TEST(test_sticky_pairs());
+    TEST(test_sticky_array());
+#endif
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef TESTS_STICKY_H
+#define TESTS_STICKY_H
+
+int test_sticky();
+
+#endif // TESTS_STICKY_H
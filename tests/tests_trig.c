@@ -0,0 +1,103 @@
+#include "tests_trig.h"
+#include "tests.h"
+#include <libfixmath/fix16_array.h>
+
+static int sincos_check(fix16_t x)
+{
+    fix16_t s;
+    fix16_t c;
+    fix16_sincos(x, &s, &c);
+    if ((s != fix16_sin(x)) || (c != fix16_cos(x)))
+    {
+        printf("sincos(%i)\n", x);
+        ASSERT_EQ_INT(s, fix16_sin(x));
+        ASSERT_EQ_INT(c, fix16_cos(x));
+    }
+    return 0;
+}
+
+/* fix16_sincos against fix16_sin and fix16_cos over the whole range where
+ * fix16_cos does not wrap around, and next to the multiples of pi for both,
+ * where the reduction decides between pi and -pi.
+ */
+static int test_sincos()
+{
+    const fix16_t last = fix16_maximum - (fix16_pi >> 1);
+
+    for (long long x = fix16_minimum; x <= last; x += 9973)
+    {
+        if (sincos_check((fix16_t)x))
+            return 1;
+    }
+
+    for (int k = -10431; k <= 10431; ++k)
+    {
+        long long pi = (long long)k * fix16_pi;
+        for (int d = -3; d <= 3; ++d)
+        {
+            long long x[2] = {pi + d, pi - (fix16_pi >> 1) + d};
+            for (int i = 0; i < 2; ++i)
+            {
+                if ((x[i] >= fix16_minimum) && (x[i] <= last) &&
+                    sincos_check((fix16_t)x[i]))
+                    return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int test_sincos_array()
+{
+    fix16_t angle[37];
+    fix16_t s[37];
+    fix16_t c[37];
+    for (int i = 0; i < 37; ++i)
+        angle[i] = fix16_from_int(i - 18) * 5 + i;
+
+    fix16_sincos_array(s, c, angle, 37);
+    for (int i = 0; i < 37; ++i)
+    {
+        ASSERT_EQ_INT(s[i], fix16_sin(angle[i]));
+        ASSERT_EQ_INT(c[i], fix16_cos(angle[i]));
+    }
+    return 0;
+}
+
+#ifdef FIXMATH_SIN_LUT_BITS
+/* The interpolated table against libm, over the whole range and at the
+ * multiples of a quarter turn, where it must be exact.
+ */
+static int test_sin_lut_small()
+{
+    for (long long x = fix16_minimum; x <= fix16_maximum; x += 997)
+    {
+        double  a = fix16_to_dbl((fix16_t)x);
+        fix16_t s = fix16_sin((fix16_t)x);
+        fix16_t c = fix16_cos((fix16_t)x);
+        if ((delta(s, fix16_from_dbl(sin(a))) > 1) ||
+            (delta(c, fix16_from_dbl(cos(a))) > 1))
+        {
+            printf("sin/cos(%lli) = %i/%i\n", x, s, c);
+            return 1;
+        }
+    }
+
+    ASSERT_EQ_INT(fix16_sin(0), 0);
+    ASSERT_EQ_INT(fix16_cos(0), fix16_one);
+    ASSERT_EQ_INT(fix16_sin(fix16_pi >> 1), fix16_one);
+    ASSERT_EQ_INT(fix16_sin(-(fix16_pi >> 1)), -fix16_one);
+    ASSERT_EQ_INT(fix16_cos(fix16_pi), -fix16_one);
+    return 0;
+}
+#endif
+
+int test_trig()
+{
+    TEST(test_sincos());
+    TEST(test_sincos_array());
+#ifdef FIXMATH_SIN_LUT_BITS
+    TEST(test_sin_lut_small());
+#endif
+    return 0;
+}
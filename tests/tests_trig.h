@@ -0,0 +1,6 @@
+#ifndef TESTS_TRIG_H
+#define TESTS_TRIG_H
+
+int test_trig();
+
+#endif // TESTS_TRIG_H
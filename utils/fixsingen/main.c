@@ -4,11 +4,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-int main(int argc, char** argv)
+/* Without arguments, writes fix16_trig_sin_lut.h with one entry per LSB of
+ * the angle for FIXMATH_SIN_LUT. With a list of resolutions, e.g.
+ * "fixsingen 8 9 10 11", writes fix16_trig_sin_lut_small.h with a table of
+ * 2^bits + 2 entries for each, for FIXMATH_SIN_LUT_BITS.
+ */
+static int write_full(void)
 {
-    (void)argc;
-    (void)argv;
-
     FILE* fp = fopen("fix16_trig_sin_lut.h", "wb");
     if (fp == NULL)
     {
@@ -51,3 +53,77 @@ int main(int argc, char** argv)
 
     return EXIT_SUCCESS;
 }
+
+/* The sine of a quarter turn in 2^bits steps. The entry after the last
+ * repeats it, so that the interpolation can always read two entries.
+ */
+static void write_small_table(FILE* fp, int bits)
+{
+    const unsigned count = (1U << bits) + 2U;
+    unsigned       i;
+
+    fprintf(fp, "static const fix16_t _fix16_sin_lut_small[%u] = {", count);
+    for (i = 0; i < count; i++)
+    {
+        unsigned step = (i < count - 1U) ? i : (count - 2U);
+        double   x    = (M_PI / 2.0) * step / (double)(1U << bits);
+        if ((i % 10U) == 0)
+            fprintf(fp, "\n   ");
+        fprintf(fp, " %5" PRIi32 ",", fix16_from_dbl(sin(x)));
+    }
+    fprintf(fp, "\n};\n");
+}
+
+static int write_small(int argc, char** argv)
+{
+    // Check every resolution first, so that no partial header is left.
+    for (int arg = 1; arg < argc; arg++)
+    {
+        int bits = atoi(argv[arg]);
+        if ((bits < 2) || (bits > 14))
+        {
+            fprintf(stderr, "Error: resolution %s is not in [2, 14].\n",
+                    argv[arg]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    FILE* fp = fopen("fix16_trig_sin_lut_small.h", "wb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Error: Unable to open file for writing.\n");
+        return EXIT_FAILURE;
+    }
+
+    fprintf(fp, "#ifndef fix16_trig_sin_lut_small_h__\n");
+    fprintf(fp, "#define fix16_trig_sin_lut_small_h__\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "/* Generated by utils/fixsingen, see FIXMATH_SIN_LUT_BITS. "
+                "*/\n");
+    fprintf(fp, "\n");
+
+    for (int arg = 1; arg < argc; arg++)
+    {
+        int bits = atoi(argv[arg]);
+        fprintf(fp, "#%s FIXMATH_SIN_LUT_BITS == %d\n",
+                (arg == 1) ? "if" : "elif", bits);
+        write_small_table(fp, bits);
+    }
+    fprintf(fp, "#else\n");
+    fprintf(fp, "#error \"No table for FIXMATH_SIN_LUT_BITS, run "
+                "utils/fixsingen with it\"\n");
+    fprintf(fp, "#endif\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#endif\n");
+
+    fclose(fp);
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+        return (write_small(argc, argv));
+    return (write_full());
+}